@@ -24,6 +24,7 @@
 
 #include "ulab_tools.h"
 #include "ndarray.h"
+#include "ndarray_expression.h"
 #include "ndarray_operators.h"
 #include "numpy/carray/carray.h"
 #include "numpy/carray/carray_tools.h"
@@ -61,7 +62,7 @@ void ndarray_set_complex_value(void *p, size_t index, mp_obj_t value) {
     }
 }
 
-#ifdef CIRCUITPY
+#if defined(CIRCUITPY) || ULAB_SUPPORTS_FLOAT16
 void ndarray_set_value(char typecode, void *p, size_t index, mp_obj_t val_in) {
     switch (typecode) {
         case NDARRAY_INT8:
@@ -79,6 +80,11 @@ void ndarray_set_value(char typecode, void *p, size_t index, mp_obj_t val_in) {
         case NDARRAY_FLOAT:
             ((mp_float_t *)p)[index] = mp_obj_get_float(val_in);
             break;
+        #if ULAB_SUPPORTS_FLOAT16
+        case NDARRAY_FLOAT16:
+            ndarray_set_float_float16((uint16_t *)p + index, mp_obj_get_float(val_in));
+            break;
+        #endif
         #if ULAB_SUPPORTS_COMPLEX
         case NDARRAY_COMPLEX:
             ndarray_set_complex_value(p, index, val_in);
@@ -256,6 +262,11 @@ void ndarray_dtype_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kin
         mp_print_str(print, "complex')");
     }
     #endif
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(self->dtype == NDARRAY_FLOAT16) {
+        mp_print_str(print, "float16')");
+    }
+    #endif
     else {
         #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
         mp_print_str(print, "float32')");
@@ -290,7 +301,11 @@ mp_obj_t ndarray_dtype_make_new(const mp_obj_type_t *type, size_t n_args, size_t
             _dtype = mp_obj_get_int(_args[0].u_obj);
             if((_dtype != NDARRAY_BOOL) && (_dtype != NDARRAY_UINT8)
                 && (_dtype != NDARRAY_INT8) && (_dtype != NDARRAY_UINT16)
-                && (_dtype != NDARRAY_INT16) && (_dtype != NDARRAY_FLOAT)) {
+                && (_dtype != NDARRAY_INT16) && (_dtype != NDARRAY_FLOAT)
+                #if ULAB_SUPPORTS_FLOAT16
+                && (_dtype != NDARRAY_FLOAT16)
+                #endif
+                ) {
                 mp_raise_TypeError(translate("data type not understood"));
             }
         } else {
@@ -303,7 +318,14 @@ mp_obj_t ndarray_dtype_make_new(const mp_obj_type_t *type, size_t n_args, size_t
                 _dtype = NDARRAY_UINT16;
             } else if(memcmp(_dtype_, "int16", 5) == 0) {
                 _dtype = NDARRAY_INT16;
-            } else if(memcmp(_dtype_, "float", 5) == 0) {
+            }
+            #if ULAB_SUPPORTS_FLOAT16
+            // float16 must be checked before float, whose name is its prefix
+            else if(memcmp(_dtype_, "float16", 7) == 0) {
+                _dtype = NDARRAY_FLOAT16;
+            }
+            #endif
+            else if(memcmp(_dtype_, "float", 5) == 0) {
                 _dtype = NDARRAY_FLOAT;
             }
             #if ULAB_SUPPORTS_COMPLEX
@@ -394,6 +416,11 @@ mp_obj_t ndarray_get_item(ndarray_obj_t *ndarray, void *array) {
             return mp_obj_new_complex(real, imag);
         }
         #endif
+        #if ULAB_SUPPORTS_FLOAT16
+        if(ndarray->dtype == NDARRAY_FLOAT16) {
+            return mp_obj_new_float(ndarray_get_float_float16(array));
+        }
+        #endif
         return mp_binary_get_val_array(ndarray->dtype, array, 0);
     } else {
         if(*(uint8_t *)array) {
@@ -542,6 +569,11 @@ void ndarray_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t ki
         mp_print_str(print, "complex)");
     }
     #endif /* ULAB_SUPPORTS_COMPLEX */
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(self->dtype == NDARRAY_FLOAT16) {
+        mp_print_str(print, "float16)");
+    }
+    #endif /* ULAB_SUPPORTS_FLOAT16 */
     else {
         #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
         mp_print_str(print, "float32)");
@@ -593,16 +625,98 @@ bool ndarray_is_dense(ndarray_obj_t *ndarray) {
     return stride == ndarray->strides[ULAB_MAX_DIMS-ndarray->ndim] ? true : false;
 }
 
+bool ndarray_binary_is_flat(uint8_t ndim, size_t *shape, int32_t *lstrides, uint8_t lsize, int32_t *rstrides, uint8_t rsize) {
+    // returns true, if both stride vectors describe a dense, C-contiguous walk
+    // over an array of the given shape, i.e., if a binary operation can be
+    // carried out in a single flat loop over the underlying buffers
+    int32_t lstride = (int32_t)lsize;
+    int32_t rstride = (int32_t)rsize;
+    for(uint8_t i = 0; i < ndim; i++) {
+        uint8_t index = ULAB_MAX_DIMS - 1 - i;
+        if((lstrides[index] != lstride) || (rstrides[index] != rstride)) {
+            return false;
+        }
+        lstride *= (int32_t)shape[index];
+        rstride *= (int32_t)shape[index];
+    }
+    return true;
+}
+
+#if ULAB_USES_STRIDE_COALESCING
+uint8_t ndarray_coalesce_strides(uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+    // Merges adjacent dimensions, whenever both operands step through them
+    // contiguously, so that the element-wise kernels can run longer inner
+    // loops; e.g., a dense (4, 1024) operation collapses into a single loop
+    // of 4096 elements. The right-aligned shape, and strides arrays are
+    // overwritten in place, and the new number of dimensions is returned.
+    // A dimension of length 1 can always be absorbed, no matter, what its
+    // strides are. A single operand can be coalesced by passing its strides
+    // array in both strides arguments.
+    size_t nshape[ULAB_MAX_DIMS];
+    int32_t nlstrides[ULAB_MAX_DIMS], nrstrides[ULAB_MAX_DIMS];
+    uint8_t index = ULAB_MAX_DIMS - 1;
+    nshape[index] = shape[ULAB_MAX_DIMS - 1];
+    nlstrides[index] = lstrides[ULAB_MAX_DIMS - 1];
+    nrstrides[index] = rstrides[ULAB_MAX_DIMS - 1];
+    for(uint8_t i = 1; i < ndim; i++) {
+        uint8_t d = ULAB_MAX_DIMS - 1 - i;
+        if((shape[d] == 1) ||
+            ((lstrides[d] == nlstrides[index] * (int32_t)nshape[index]) &&
+            (rstrides[d] == nrstrides[index] * (int32_t)nshape[index]))) {
+            nshape[index] *= shape[d];
+        } else {
+            index--;
+            nshape[index] = shape[d];
+            nlstrides[index] = lstrides[d];
+            nrstrides[index] = rstrides[d];
+        }
+    }
+    memset(shape, 0, sizeof(size_t) * ULAB_MAX_DIMS);
+    memset(lstrides, 0, sizeof(int32_t) * ULAB_MAX_DIMS);
+    memset(rstrides, 0, sizeof(int32_t) * ULAB_MAX_DIMS);
+    for(uint8_t d = index; d < ULAB_MAX_DIMS; d++) {
+        shape[d] = nshape[d];
+        lstrides[d] = nlstrides[d];
+        rstrides[d] = nrstrides[d];
+    }
+    return ULAB_MAX_DIMS - index;
+}
+#endif /* ULAB_USES_STRIDE_COALESCING */
+
 
 ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype) {
     // Creates the base ndarray with shape, and initialises the values to straight 0s
-    ndarray_obj_t *ndarray = m_new_obj(ndarray_obj_t);
+    uint8_t itemsize = ulab_binary_get_size(dtype);
+    size_t count = ndim == 0 ? 0 : 1;
+    for(uint8_t i=ULAB_MAX_DIMS; i > ULAB_MAX_DIMS-ndim; i--) {
+        count *= shape[i-1];
+    }
+    // if the length is 0, still allocate a single item, so that contractions can be handled
+    size_t len = itemsize * MAX(1, count);
+
+    ndarray_obj_t *ndarray;
+    uint8_t *array;
+    #if ULAB_COALLOCATION_THRESHOLD > 0
+    if(len <= ULAB_COALLOCATION_THRESHOLD) {
+        // small data buffers live in the same GC block, immediately after the
+        // header, saving one allocation; the offset keeps the buffer aligned
+        // for the widest item
+        ndarray = (ndarray_obj_t *)(void *)m_new0(byte, NDARRAY_COALLOCATION_OFFSET + len);
+        array = (uint8_t *)ndarray + NDARRAY_COALLOCATION_OFFSET;
+    } else
+    #endif
+    {
+        ndarray = m_new_obj(ndarray_obj_t);
+        // this should set all elements to 0, irrespective of the of the dtype (all bits are zero)
+        // we could, perhaps, leave this step out, and initialise the array only, when needed
+        array = m_new0(byte, len);
+    }
     ndarray->base.type = &ulab_ndarray_type;
     ndarray->dtype = dtype == NDARRAY_BOOL ? NDARRAY_UINT8 : dtype;
     ndarray->boolean = dtype == NDARRAY_BOOL ? NDARRAY_BOOLEAN : NDARRAY_NUMERIC;
     ndarray->ndim = ndim;
-    ndarray->len = ndim == 0 ? 0 : 1;
-    ndarray->itemsize = ulab_binary_get_size(dtype);
+    ndarray->len = count;
+    ndarray->itemsize = itemsize;
     int32_t *_strides;
     if(strides == NULL) {
         _strides = strides_from_shape(shape, ndarray->dtype);
@@ -612,16 +726,19 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides
     for(uint8_t i=ULAB_MAX_DIMS; i > ULAB_MAX_DIMS-ndim; i--) {
         ndarray->shape[i-1] = shape[i-1];
         ndarray->strides[i-1] = _strides[i-1];
-        ndarray->len *= shape[i-1];
     }
 
-    // if the length is 0, still allocate a single item, so that contractions can be handled
-    size_t len = ndarray->itemsize * MAX(1, ndarray->len);
-    uint8_t *array = m_new0(byte, len);
-    // this should set all elements to 0, irrespective of the of the dtype (all bits are zero)
-    // we could, perhaps, leave this step out, and initialise the array only, when needed
     ndarray->array = array;
-    ndarray->origin = array;
+    #if ULAB_COALLOCATION_THRESHOLD > 0
+    if(len <= ULAB_COALLOCATION_THRESHOLD) {
+        // the GC marks only pointers to the head of a block, so views into a
+        // co-allocated buffer must anchor the header instead of the buffer
+        ndarray->origin = ndarray;
+    } else
+    #endif
+    {
+        ndarray->origin = array;
+    }
     return ndarray;
 }
 
@@ -777,6 +894,18 @@ ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *source, uint8_t dty
                         }
                     } else {
                     #endif
+                        #if ULAB_SUPPORTS_FLOAT16
+                        if((source->dtype == NDARRAY_FLOAT16) || (dtype == NDARRAY_FLOAT16)) {
+                            // half floats pass through mp_float_t in both directions
+                            mp_float_t f = ndarray_get_float_value(sarray, source->dtype);
+                            if((dtype == NDARRAY_UINT8) || (dtype == NDARRAY_INT8) ||
+                                (dtype == NDARRAY_UINT16) || (dtype == NDARRAY_INT16)) {
+                                item = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(f));
+                            } else {
+                                item = mp_obj_new_float(f);
+                            }
+                        } else
+                        #endif
                         if((source->dtype == NDARRAY_FLOAT) && (dtype != NDARRAY_FLOAT)) {
                             // floats must be treated separately, because they can't directly be converted to integer types
                             mp_float_t f = ndarray_get_float_value(sarray, source->dtype);
@@ -1189,7 +1318,14 @@ void ndarray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values) {
         mp_raise_ValueError(translate("operands could not be broadcast together"));
     } else {
 
-        ndarray_obj_t *ndarray = ndarray_copy_view_convert_type(values, view->dtype);
+        ndarray_obj_t *ndarray;
+        if((values->dtype == view->dtype) && (view->origin != values->origin)) {
+            // matching dtype, and the buffers live in different GC blocks, so
+            // they cannot overlap: the values can be read in place, saving a copy
+            ndarray = values;
+        } else {
+            ndarray = ndarray_copy_view_convert_type(values, view->dtype);
+        }
         // re-calculate rstrides, since the copy operation might have changed the directions of the strides
         ndarray_can_broadcast(view, ndarray, &ndim, shape, lstrides, rstrides);
         uint8_t *rarray = (uint8_t *)ndarray->array;
@@ -1197,6 +1333,12 @@ void ndarray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values) {
 
         uint8_t *larray = (uint8_t *)view->array;
 
+        // if the last dimension is contiguous on both sides, whole rows can be copied in one go
+        size_t copy_size = 0;
+        if((lstrides[ULAB_MAX_DIMS - 1] == (int32_t)view->itemsize) && (rstrides[ULAB_MAX_DIMS - 1] == (int32_t)view->itemsize)) {
+            copy_size = view->shape[ULAB_MAX_DIMS - 1] * view->itemsize;
+        }
+
         #if ULAB_MAX_DIMS > 3
         size_t i = 0;
         do {
@@ -1209,13 +1351,19 @@ void ndarray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values) {
                 size_t k = 0;
                 do {
                 #endif
-                    size_t l = 0;
-                    do {
-                        memcpy(larray, rarray, view->itemsize);
-                        larray += lstrides[ULAB_MAX_DIMS - 1];
-                        rarray += rstrides[ULAB_MAX_DIMS - 1];
-                        l++;
-                    } while(l <  view->shape[ULAB_MAX_DIMS - 1]);
+                    if(copy_size > 0) {
+                        memcpy(larray, rarray, copy_size);
+                        larray += copy_size;
+                        rarray += copy_size;
+                    } else {
+                        size_t l = 0;
+                        do {
+                            memcpy(larray, rarray, view->itemsize);
+                            larray += lstrides[ULAB_MAX_DIMS - 1];
+                            rarray += rstrides[ULAB_MAX_DIMS - 1];
+                            l++;
+                        } while(l <  view->shape[ULAB_MAX_DIMS - 1]);
+                    }
                 #if ULAB_MAX_DIMS > 1
                     larray -= lstrides[ULAB_MAX_DIMS - 1] * view->shape[ULAB_MAX_DIMS-1];
                     larray += lstrides[ULAB_MAX_DIMS - 2];
@@ -1263,17 +1411,39 @@ static mp_obj_t ndarray_from_boolean_index(ndarray_obj_t *ndarray, ndarray_obj_t
     }
     ndarray_obj_t *results = ndarray_new_linear_array(count, ndarray->dtype);
     uint8_t *rarray = (uint8_t *)results->array;
-    uint8_t *array = (uint8_t *)ndarray->array;
     // re-wind the index array
     iarray = index->array;
-    for(size_t i=0; i < index->len; i++) {
-        if(*iarray) {
-            memcpy(rarray, array, results->itemsize);
-            rarray += results->itemsize;
-            count++;
+    int32_t istride = index->strides[ULAB_MAX_DIMS - 1];
+    int32_t lstrides = ndarray->strides[ULAB_MAX_DIMS - 1] / ndarray->itemsize;
+    // the selected items are copied verbatim, so only the width of an item matters
+    switch(ndarray->itemsize) {
+        case 1: {
+            BOOLEAN_GATHER_LOOP(uint8_t, ndarray, lstrides, iarray, istride, rarray);
+            break;
+        }
+        case 2: {
+            BOOLEAN_GATHER_LOOP(uint16_t, ndarray, lstrides, iarray, istride, rarray);
+            break;
+        }
+        case 4: {
+            BOOLEAN_GATHER_LOOP(uint32_t, ndarray, lstrides, iarray, istride, rarray);
+            break;
+        }
+        case 8: {
+            BOOLEAN_GATHER_LOOP(uint64_t, ndarray, lstrides, iarray, istride, rarray);
+            break;
+        }
+        default: { // double-precision complex items are wider than any integer type
+            uint8_t *array = (uint8_t *)ndarray->array;
+            for(size_t i=0; i < index->len; i++) {
+                if(*iarray) {
+                    memcpy(rarray, array, results->itemsize);
+                    rarray += results->itemsize;
+                }
+                array += ndarray->strides[ULAB_MAX_DIMS - 1];
+                iarray += istride;
+            }
         }
-        array += ndarray->strides[ULAB_MAX_DIMS - 1];
-        iarray += index->strides[ULAB_MAX_DIMS - 1];
     }
     return MP_OBJ_FROM_PTR(results);
 }
@@ -1320,6 +1490,26 @@ static mp_obj_t ndarray_assign_from_boolean_index(ndarray_obj_t *ndarray, ndarra
     }
     #endif
 
+    #if ULAB_SUPPORTS_FLOAT16
+    if((ndarray->dtype == NDARRAY_FLOAT16) || (values->dtype == NDARRAY_FLOAT16)) {
+        // bring the values to the target's dtype, so that the assignment
+        // reduces to copying items
+        values = ndarray_copy_view_convert_type(values, ndarray->dtype);
+        varray = (uint8_t *)values->array;
+        vstride = vstride == 0 ? 0 : ndarray->itemsize;
+        uint8_t *array = (uint8_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            if(*iarray) {
+                memcpy(array, varray, ndarray->itemsize);
+                varray += vstride;
+            }
+            array += ndarray->strides[ULAB_MAX_DIMS - 1];
+            iarray += istride;
+        }
+        return MP_OBJ_FROM_PTR(ndarray);
+    }
+    #endif
+
     int32_t lstrides = ndarray->strides[ULAB_MAX_DIMS - 1] / ndarray->itemsize;
 
     if(ndarray->dtype == NDARRAY_UINT8) {
@@ -1391,12 +1581,138 @@ static mp_obj_t ndarray_assign_from_boolean_index(ndarray_obj_t *ndarray, ndarra
     return MP_OBJ_FROM_PTR(ndarray);
 }
 
+#if NDARRAY_HAS_FANCY_INDEXING
+static size_t *ndarray_integer_index_positions(ndarray_obj_t *ndarray, ndarray_obj_t *index) {
+    // first pass of fancy indexing: translates the entries of an integer index
+    // array into positions along the last axis, wrapping negative values, and
+    // raising an exception for out-of-bounds entries
+    if(index->dtype == NDARRAY_FLOAT) {
+        mp_raise_TypeError(translate("wrong index type"));
+    }
+    size_t *positions = m_new(size_t, index->len);
+    uint8_t *iarray = (uint8_t *)index->array;
+    int32_t istride = index->strides[ULAB_MAX_DIMS - 1];
+    for(size_t i=0; i < index->len; i++) {
+        ssize_t value;
+        if(index->dtype == NDARRAY_UINT8) {
+            value = (ssize_t)(*(uint8_t *)iarray);
+        } else if(index->dtype == NDARRAY_INT8) {
+            value = (ssize_t)(*(int8_t *)iarray);
+        } else if(index->dtype == NDARRAY_UINT16) {
+            value = (ssize_t)(*(uint16_t *)iarray);
+        } else {
+            value = (ssize_t)(*(int16_t *)iarray);
+        }
+        if(value < 0) {
+            value += ndarray->len;
+        }
+        if((value < 0) || (value >= (ssize_t)ndarray->len)) {
+            m_del(size_t, positions, index->len);
+            mp_raise_msg(&mp_type_IndexError, translate("index is out of bounds"));
+        }
+        positions[i] = (size_t)value;
+        iarray += istride;
+    }
+    return positions;
+}
+
+static mp_obj_t ndarray_from_integer_index(ndarray_obj_t *ndarray, ndarray_obj_t *index) {
+    // returns a 1D array, gathered at the positions held in an integer index array
+    size_t *positions = ndarray_integer_index_positions(ndarray, index);
+    ndarray_obj_t *results = ndarray_new_linear_array(index->len, ndarray->dtype);
+    uint8_t *rarray = (uint8_t *)results->array;
+    int32_t lstrides = ndarray->strides[ULAB_MAX_DIMS - 1] / ndarray->itemsize;
+    switch(ndarray->itemsize) {
+        case 1: {
+            FANCY_GATHER_LOOP(uint8_t, ndarray, lstrides, positions, index->len, rarray);
+            break;
+        }
+        case 2: {
+            FANCY_GATHER_LOOP(uint16_t, ndarray, lstrides, positions, index->len, rarray);
+            break;
+        }
+        case 4: {
+            FANCY_GATHER_LOOP(uint32_t, ndarray, lstrides, positions, index->len, rarray);
+            break;
+        }
+        case 8: {
+            FANCY_GATHER_LOOP(uint64_t, ndarray, lstrides, positions, index->len, rarray);
+            break;
+        }
+        default: {
+            uint8_t *array = (uint8_t *)ndarray->array;
+            for(size_t i=0; i < index->len; i++) {
+                memcpy(rarray, array + positions[i] * ndarray->strides[ULAB_MAX_DIMS - 1], results->itemsize);
+                rarray += results->itemsize;
+            }
+        }
+    }
+    m_del(size_t, positions, index->len);
+    return MP_OBJ_FROM_PTR(results);
+}
+
+static mp_obj_t ndarray_assign_from_integer_index(ndarray_obj_t *ndarray, ndarray_obj_t *index, ndarray_obj_t *values) {
+    // scatters values at the positions held in an integer index array
+    if((values->len != index->len) && (values->len != 1)) {
+        mp_raise_ValueError(translate("wrong length of value array"));
+    }
+    size_t *positions = ndarray_integer_index_positions(ndarray, index);
+    // bring the values to the dtype of the target, so that the scatter
+    // loop can copy items without type conversion
+    values = ndarray_copy_view_convert_type(values, ndarray->dtype);
+    uint8_t *varray = (uint8_t *)values->array;
+    // the copy is dense; a single value is simply re-read
+    int32_t vstride = values->len == index->len ? 1 : 0;
+    int32_t lstrides = ndarray->strides[ULAB_MAX_DIMS - 1] / ndarray->itemsize;
+    switch(ndarray->itemsize) {
+        case 1: {
+            FANCY_SCATTER_LOOP(uint8_t, ndarray, lstrides, positions, index->len, varray, vstride);
+            break;
+        }
+        case 2: {
+            FANCY_SCATTER_LOOP(uint16_t, ndarray, lstrides, positions, index->len, varray, vstride);
+            break;
+        }
+        case 4: {
+            FANCY_SCATTER_LOOP(uint32_t, ndarray, lstrides, positions, index->len, varray, vstride);
+            break;
+        }
+        case 8: {
+            FANCY_SCATTER_LOOP(uint64_t, ndarray, lstrides, positions, index->len, varray, vstride);
+            break;
+        }
+        default: {
+            uint8_t *array = (uint8_t *)ndarray->array;
+            for(size_t i=0; i < index->len; i++) {
+                memcpy(array + positions[i] * ndarray->strides[ULAB_MAX_DIMS - 1], varray, ndarray->itemsize);
+                varray += vstride * ndarray->itemsize;
+            }
+        }
+    }
+    m_del(size_t, positions, index->len);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+#endif /* NDARRAY_HAS_FANCY_INDEXING */
+
 static mp_obj_t ndarray_get_slice(ndarray_obj_t *ndarray, mp_obj_t index, ndarray_obj_t *values) {
     if(mp_obj_is_type(index, &ulab_ndarray_type)) {
         ndarray_obj_t *nindex = MP_OBJ_TO_PTR(index);
+        #if NDARRAY_HAS_FANCY_INDEXING
+        if(nindex->ndim > 1) {
+            mp_raise_NotImplementedError(translate("operation is implemented for 1D index arrays only"));
+        }
+        if(nindex->boolean == false) { // fancy indexing with an integer index array
+            if(values == NULL) { // return value(s)
+                return ndarray_from_integer_index(ndarray, nindex);
+            } else { // assign value(s)
+                return ndarray_assign_from_integer_index(ndarray, nindex, values);
+            }
+        }
+        #else
         if((nindex->ndim > 1) || (nindex->boolean == false)) {
             mp_raise_NotImplementedError(translate("operation is implemented for 1D Boolean arrays only"));
         }
+        #endif
         if(values == NULL) { // return value(s)
             return ndarray_from_boolean_index(ndarray, nindex);
         } else { // assign value(s)
@@ -1743,6 +2059,12 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t obj, uint8_t other_type) {
 #if NDARRAY_HAS_BINARY_OPS || NDARRAY_HAS_INPLACE_OPS
 mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
     // TODO: implement in-place operators
+    #if ULAB_HAS_EXPRESSION
+    if(mp_obj_is_type(robj, &ulab_expression_type)) {
+        // hand the operation over to the expression type, which records it in its DAG
+        return MP_OBJ_NULL;
+    }
+    #endif
     // if the ndarray stands on the right hand side of the expression, simply swap the operands
     ndarray_obj_t *lhs, *rhs;
     mp_binary_op_t op = _op;
@@ -1767,6 +2089,17 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         op = MP_BINARY_OP_TRUE_DIVIDE;
     }
 
+    #if ULAB_SUPPORTS_FLOAT16
+    // float16 is a storage dtype: arithmetic runs in mp_float_t, so
+    // half-precision operands are widened once, at the operator boundary
+    if(lhs->dtype == NDARRAY_FLOAT16) {
+        lhs = ndarray_copy_view_convert_type(lhs, NDARRAY_FLOAT);
+    }
+    if(rhs->dtype == NDARRAY_FLOAT16) {
+        rhs = ndarray_copy_view_convert_type(rhs, NDARRAY_FLOAT);
+    }
+    #endif
+
     uint8_t ndim = 0;
     size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
     int32_t *lstrides = m_new0(int32_t, ULAB_MAX_DIMS);
@@ -1784,6 +2117,18 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         m_del(int32_t, lstrides, ULAB_MAX_DIMS);
         m_del(int32_t, rstrides, ULAB_MAX_DIMS);
     }
+
+    #if ULAB_USES_STRIDE_COALESCING
+    // save the shape of the result, and merge mergeable dimensions, so that
+    // the operator kernels can run fewer, longer loops; the original shape is
+    // handed back to the result below, once the operator has returned
+    uint8_t result_ndim = ndim;
+    size_t result_shape[ULAB_MAX_DIMS];
+    memcpy(result_shape, shape, sizeof(size_t) * ULAB_MAX_DIMS);
+    if(ndim > 1) {
+        ndim = ndarray_coalesce_strides(ndim, shape, lstrides, rstrides);
+    }
+    #endif
     // the empty arrays have to be treated separately
     uint8_t dtype = NDARRAY_INT16;
     ndarray_obj_t *nd;
@@ -1833,6 +2178,8 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         }
     }
 
+    mp_obj_t results_obj = MP_OBJ_NULL;
+
     switch(op) {
         // first the in-place operators
         #if NDARRAY_HAS_INPLACE_ADD
@@ -1871,69 +2218,82 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         case MP_BINARY_OP_LESS:
             COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
             // here we simply swap the operands
-            return ndarray_binary_more(rhs, lhs, ndim, shape, rstrides, lstrides, MP_BINARY_OP_MORE);
+            results_obj = ndarray_binary_more(rhs, lhs, ndim, shape, rstrides, lstrides, MP_BINARY_OP_MORE);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_LESS_EQUAL
         case MP_BINARY_OP_LESS_EQUAL:
             COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
             // here we simply swap the operands
-            return ndarray_binary_more(rhs, lhs, ndim, shape, rstrides, lstrides, MP_BINARY_OP_MORE_EQUAL);
+            results_obj = ndarray_binary_more(rhs, lhs, ndim, shape, rstrides, lstrides, MP_BINARY_OP_MORE_EQUAL);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_EQUAL
         case MP_BINARY_OP_EQUAL:
-            return ndarray_binary_equality(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_EQUAL);
+            results_obj = ndarray_binary_equality(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_EQUAL);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_NOT_EQUAL
         case MP_BINARY_OP_NOT_EQUAL:
-            return ndarray_binary_equality(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_NOT_EQUAL);
+            results_obj = ndarray_binary_equality(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_NOT_EQUAL);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_ADD
         case MP_BINARY_OP_ADD:
-            return ndarray_binary_add(lhs, rhs, ndim, shape, lstrides, rstrides);
+            results_obj = ndarray_binary_add(lhs, rhs, ndim, shape, lstrides, rstrides);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_MULTIPLY
         case MP_BINARY_OP_MULTIPLY:
-            return ndarray_binary_multiply(lhs, rhs, ndim, shape, lstrides, rstrides);
+            results_obj = ndarray_binary_multiply(lhs, rhs, ndim, shape, lstrides, rstrides);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_MORE
         case MP_BINARY_OP_MORE:
             COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
-            return ndarray_binary_more(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_MORE);
+            results_obj = ndarray_binary_more(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_MORE);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_MORE_EQUAL
         case MP_BINARY_OP_MORE_EQUAL:
             COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
-            return ndarray_binary_more(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_MORE_EQUAL);
+            results_obj = ndarray_binary_more(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_MORE_EQUAL);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_SUBTRACT
         case MP_BINARY_OP_SUBTRACT:
-            return ndarray_binary_subtract(lhs, rhs, ndim, shape, lstrides, rstrides);
+            results_obj = ndarray_binary_subtract(lhs, rhs, ndim, shape, lstrides, rstrides);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_TRUE_DIVIDE
         case MP_BINARY_OP_TRUE_DIVIDE:
-            return ndarray_binary_true_divide(lhs, rhs, ndim, shape, lstrides, rstrides);
+            results_obj = ndarray_binary_true_divide(lhs, rhs, ndim, shape, lstrides, rstrides);
             break;
         #endif
         #if NDARRAY_HAS_BINARY_OP_POWER
         case MP_BINARY_OP_POWER:
             COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
-            return ndarray_binary_power(lhs, rhs, ndim, shape, lstrides, rstrides);
+            results_obj = ndarray_binary_power(lhs, rhs, ndim, shape, lstrides, rstrides);
             break;
         #endif
         default:
             return MP_OBJ_NULL; // op not supported
             break;
     }
-    return MP_OBJ_NULL;
+
+    #if ULAB_USES_STRIDE_COALESCING
+    if((ndim != result_ndim) && (results_obj != MP_OBJ_NULL) && mp_obj_is_type(results_obj, &ulab_ndarray_type)) {
+        // the operator worked with the merged loop shape; hand the original
+        // broadcast shape back to the result
+        ndarray_obj_t *results = MP_OBJ_TO_PTR(results_obj);
+        results->ndim = result_ndim;
+        memcpy(results->shape, result_shape, sizeof(size_t) * ULAB_MAX_DIMS);
+        int32_t *dense_strides = strides_from_shape(results->shape, results->dtype);
+        memcpy(results->strides, dense_strides, sizeof(int32_t) * ULAB_MAX_DIMS);
+        m_del(int32_t, dense_strides, ULAB_MAX_DIMS);
+    }
+    #endif
+    return results_obj;
 }
 #endif /* NDARRAY_HAS_BINARY_OPS || NDARRAY_HAS_INPLACE_OPS */
 
@@ -1964,7 +2324,17 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
                     for(size_t i=0; i < self->len; i++, array++) {
                         if(*array < 0) *array = -(*array);
                     }
-                } else {
+                }
+                #if ULAB_SUPPORTS_FLOAT16
+                else if(self->dtype == NDARRAY_FLOAT16) {
+                    // clearing the sign bit is all it takes
+                    uint16_t *array = (uint16_t *)ndarray->array;
+                    for(size_t i=0; i < self->len; i++, array++) {
+                        *array &= 0x7fff;
+                    }
+                }
+                #endif
+                else {
                     mp_float_t *array = (mp_float_t *)ndarray->array;
                     for(size_t i=0; i < self->len; i++, array++) {
                         if(*array < 0) *array = -(*array);
@@ -1985,6 +2355,11 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             #endif
                 mp_raise_ValueError(translate("operation is not supported for given type"));
             }
+            #if ULAB_SUPPORTS_FLOAT16
+            if(self->dtype == NDARRAY_FLOAT16) {
+                mp_raise_ValueError(translate("operation is not supported for given type"));
+            }
+            #endif
             // we can invert the content byte by byte, no need to distinguish between different dtypes
             ndarray = ndarray_copy_view(self); // from this point, this is a dense copy
             uint8_t *array = (uint8_t *)ndarray->array;
@@ -2017,7 +2392,15 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             } else if(self->dtype == NDARRAY_INT16) {
                 int16_t *array = (int16_t *)ndarray->array;
                 for(size_t i=0; i < self->len; i++, array++) *array = -(*array);
-            } else {
+            }
+            #if ULAB_SUPPORTS_FLOAT16
+            else if(self->dtype == NDARRAY_FLOAT16) {
+                // toggling the sign bit negates the value
+                uint16_t *array = (uint16_t *)ndarray->array;
+                for(size_t i=0; i < self->len; i++, array++) *array ^= 0x8000;
+            }
+            #endif
+            else {
                 mp_float_t *array = (mp_float_t *)ndarray->array;
                 size_t len = self->len;
                 #if ULAB_SUPPORTS_COMPLEX
@@ -102,7 +102,13 @@ typedef struct _mp_obj_slice_t {
 
 #if !CIRCUITPY
 #define translate(x) MP_ERROR_TEXT(x)
+#if ULAB_SUPPORTS_FLOAT16
+// the binary module knows nothing about half floats, so the stores have
+// to go through ulab's own function
+void ndarray_set_value(char , void *, size_t , mp_obj_t );
+#else
 #define ndarray_set_value(a, b, c, d) mp_binary_set_val_array(a, b, c, d)
+#endif
 #else
 void ndarray_set_value(char , void *, size_t , mp_obj_t );
 #endif
@@ -126,6 +132,9 @@ enum NDARRAY_TYPE {
     #if ULAB_SUPPORTS_COMPLEX
         NDARRAY_COMPLEX = 'c',
     #endif
+    #if ULAB_SUPPORTS_FLOAT16
+        NDARRAY_FLOAT16 = 'e',
+    #endif
     NDARRAY_FLOAT = FLOAT_TYPECODE,
 };
 
@@ -142,6 +151,12 @@ typedef struct _ndarray_obj_t {
     void *origin;
 } ndarray_obj_t;
 
+#if ULAB_COALLOCATION_THRESHOLD > 0
+// position of a co-allocated data buffer behind the header, rounded up,
+// so that the buffer is aligned for the widest item type
+#define NDARRAY_COALLOCATION_OFFSET ((sizeof(ndarray_obj_t) + sizeof(mp_float_t) - 1) & ~(sizeof(mp_float_t) - 1))
+#endif
+
 #if ULAB_HAS_DTYPE_OBJECT
 extern const mp_obj_type_t ulab_dtype_type;
 
@@ -187,6 +202,10 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t , size_t *, int32_t *, uint8_t );
 ndarray_obj_t *ndarray_new_linear_array(size_t , uint8_t );
 ndarray_obj_t *ndarray_new_view(ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t );
 bool ndarray_is_dense(ndarray_obj_t *);
+bool ndarray_binary_is_flat(uint8_t , size_t *, int32_t *, uint8_t , int32_t *, uint8_t );
+#if ULAB_USES_STRIDE_COALESCING
+uint8_t ndarray_coalesce_strides(uint8_t , size_t *, int32_t *, int32_t *);
+#endif
 ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *, uint8_t );
 void ndarray_copy_array(ndarray_obj_t *, ndarray_obj_t *, uint8_t );
@@ -268,8 +287,36 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
         (iarray) += (istride);\
     } while(0)
 
+#define BOOLEAN_GATHER_LOOP(type, ndarray, lstrides, iarray, istride, rarray)\
+    type *source = (type *)(ndarray)->array;\
+    type *target = (type *)(rarray);\
+    for(size_t i=0; i < (ndarray)->len; i++) {\
+        if(*(iarray)) {\
+            *target++ = *source;\
+        }\
+        source += (lstrides);\
+        (iarray) += (istride);\
+    } while(0)
+
+#if NDARRAY_HAS_FANCY_INDEXING
+#define FANCY_GATHER_LOOP(type, ndarray, lstrides, positions, count, rarray)\
+    type *source = (type *)(ndarray)->array;\
+    type *target = (type *)(rarray);\
+    for(size_t i=0; i < (count); i++) {\
+        *target++ = *(source + (positions)[i] * (lstrides));\
+    } while(0)
+
+#define FANCY_SCATTER_LOOP(type, ndarray, lstrides, positions, count, varray, vstride)\
+    type *source = (type *)(varray);\
+    type *target = (type *)(ndarray)->array;\
+    for(size_t i=0; i < (count); i++) {\
+        *(target + (positions)[i] * (lstrides)) = *source;\
+        source += (vstride);\
+    } while(0)
+#endif /* NDARRAY_HAS_FANCY_INDEXING */
+
 #if ULAB_HAS_FUNCTION_ITERATOR
-#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+#define BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)(results)->array;\
     size_t *lcoords = ndarray_new_coords((results)->ndim);\
     size_t *rcoords = ndarray_new_coords((results)->ndim);\
@@ -334,7 +381,7 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 #else
 
 #if ULAB_MAX_DIMS == 1
-#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+#define BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)results->array;\
     size_t l = 0;\
     do {\
@@ -375,7 +422,7 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 #endif /* ULAB_MAX_DIMS == 1 */
 
 #if ULAB_MAX_DIMS == 2
-#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+#define BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)(results)->array;\
     size_t k = 0;\
     do {\
@@ -448,7 +495,7 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 #endif /* ULAB_MAX_DIMS == 2 */
 
 #if ULAB_MAX_DIMS == 3
-#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+#define BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)results->array;\
     size_t j = 0;\
     do {\
@@ -553,7 +600,7 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 #endif /* ULAB_MAX_DIMS == 3 */
 
 #if ULAB_MAX_DIMS == 4
-#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+#define BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)results->array;\
     size_t i = 0;\
     do {\
@@ -690,4 +737,39 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 #endif /* ULAB_MAX_DIMS == 4 */
 #endif /* ULAB_HAS_FUNCTION_ITERATOR */
 
+#if NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH
+// If both operands are dense, C-contiguous, and no axis is broadcast, the nested
+// stride loops above collapse into a single flat run over the underlying buffers.
+// The flat loop is unrolled by four, so that the compiler can keep the loads in
+// registers, and vectorise the body on targets with SIMD/DSP extensions.
+#define BINARY_LOOP_FLAT(results, type_out, type_left, type_right, larray, rarray, OPERATOR)\
+    type_out *array = (type_out *)(results)->array;\
+    type_left *lvector = (type_left *)(larray);\
+    type_right *rvector = (type_right *)(rarray);\
+    size_t count = (results)->len;\
+    while(count >= 4) {\
+        array[0] = lvector[0] OPERATOR rvector[0];\
+        array[1] = lvector[1] OPERATOR rvector[1];\
+        array[2] = lvector[2] OPERATOR rvector[2];\
+        array[3] = lvector[3] OPERATOR rvector[3];\
+        array += 4;\
+        lvector += 4;\
+        rvector += 4;\
+        count -= 4;\
+    }\
+    while(count--) {\
+        *array++ = *lvector++ OPERATOR *rvector++;\
+    }
+
+#define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
+    if(ndarray_binary_is_flat((results)->ndim, (results)->shape, (lstrides), sizeof(type_left), (rstrides), sizeof(type_right))) {\
+        BINARY_LOOP_FLAT(results, type_out, type_left, type_right, larray, rarray, OPERATOR);\
+    } else {\
+        BINARY_LOOP_STRIDED(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR);\
+    }
+
+#else
+#define BINARY_LOOP BINARY_LOOP_STRIDED
+#endif /* NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH */
+
 #endif
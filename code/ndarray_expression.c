@@ -0,0 +1,178 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2022 Zoltán Vörös
+*/
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "ndarray.h"
+#include "ndarray_expression.h"
+#include "ulab.h"
+#include "ulab_tools.h"
+
+#if ULAB_HAS_EXPRESSION
+
+/*
+    Deferred evaluation of chained element-wise arithmetic.
+
+    An expression object records the operation DAG, instead of carrying
+    out the operations one by one. Since nothing is calculated before
+    eval() is called, chained expressions get by with a single output
+    allocation, instead of one temporary array per operator:
+
+    a, b, c, d = ...
+    e = ulab.expression(a)
+    results = ((e - b) * c + d).eval()
+
+    Only the four element-wise operators (+, -, *, /) are deferred, the
+    operands must all have the same shape (the expression engine does not
+    broadcast), and the result of eval() is always a float ndarray.
+*/
+
+static ndarray_expression_obj_t *expression_new_node(uint8_t op) {
+    ndarray_expression_obj_t *node = m_new_obj(ndarray_expression_obj_t);
+    node->base.type = &ulab_expression_type;
+    node->op = op;
+    node->lhs = MP_OBJ_NULL;
+    node->rhs = MP_OBJ_NULL;
+    node->leaf = NULL;
+    node->value = MICROPY_FLOAT_CONST(0.0);
+    return node;
+}
+
+static ndarray_expression_obj_t *expression_from_mp_obj(mp_obj_t obj) {
+    // wraps an ndarray or a scalar in a leaf node; expressions pass through
+    if(mp_obj_is_type(obj, &ulab_expression_type)) {
+        return MP_OBJ_TO_PTR(obj);
+    }
+    if(mp_obj_is_type(obj, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(obj);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("expression is not implemented for complex dtype"));
+        }
+        #endif
+        if(!ndarray_is_dense(ndarray)) {
+            // leaves are walked with a flat index, so views have to be copied once here
+            ndarray = ndarray_copy_view(ndarray);
+        }
+        ndarray_expression_obj_t *node = expression_new_node(EXPRESSION_NDARRAY);
+        node->leaf = ndarray;
+        return node;
+    }
+    if(mp_obj_is_int(obj) || mp_obj_is_float(obj)) {
+        ndarray_expression_obj_t *node = expression_new_node(EXPRESSION_SCALAR);
+        node->value = mp_obj_get_float(obj);
+        return node;
+    }
+    mp_raise_TypeError(translate("wrong operand type"));
+}
+
+mp_obj_t expression_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)type;
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    if(!mp_obj_is_type(args[0], &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("expression argument must be an ndarray"));
+    }
+    return MP_OBJ_FROM_PTR(expression_from_mp_obj(args[0]));
+}
+
+void expression_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    ndarray_expression_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(self->leaf != NULL) {
+        mp_printf(print, "expression(size=%d)", self->leaf->len);
+    } else {
+        mp_printf(print, "expression()");
+    }
+}
+
+mp_obj_t expression_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
+    mp_binary_op_t op = _op;
+    // for the reversed operators the expression stands on the right hand side
+    if((op == MP_BINARY_OP_REVERSE_ADD) || (op == MP_BINARY_OP_REVERSE_MULTIPLY) ||
+        (op == MP_BINARY_OP_REVERSE_SUBTRACT) || (op == MP_BINARY_OP_REVERSE_TRUE_DIVIDE)) {
+        mp_obj_t tmp = lobj;
+        lobj = robj;
+        robj = tmp;
+    }
+
+    uint8_t opcode;
+    switch(op) {
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_REVERSE_ADD:
+            opcode = EXPRESSION_ADD;
+            break;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_REVERSE_SUBTRACT:
+            opcode = EXPRESSION_SUBTRACT;
+            break;
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_REVERSE_MULTIPLY:
+            opcode = EXPRESSION_MULTIPLY;
+            break;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+        case MP_BINARY_OP_REVERSE_TRUE_DIVIDE:
+            opcode = EXPRESSION_TRUE_DIVIDE;
+            break;
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+
+    ndarray_expression_obj_t *lhs = expression_from_mp_obj(lobj);
+    ndarray_expression_obj_t *rhs = expression_from_mp_obj(robj);
+
+    if((lhs->leaf != NULL) && (rhs->leaf != NULL)) {
+        if(memcmp(lhs->leaf->shape, rhs->leaf->shape, sizeof(size_t) * ULAB_MAX_DIMS) != 0) {
+            mp_raise_ValueError(translate("operands of an expression must have the same shape"));
+        }
+    }
+
+    ndarray_expression_obj_t *node = expression_new_node(opcode);
+    node->lhs = MP_OBJ_FROM_PTR(lhs);
+    node->rhs = MP_OBJ_FROM_PTR(rhs);
+    node->leaf = lhs->leaf != NULL ? lhs->leaf : rhs->leaf;
+    return MP_OBJ_FROM_PTR(node);
+}
+
+static mp_float_t expression_eval_item(ndarray_expression_obj_t *self, size_t index) {
+    if(self->op == EXPRESSION_NDARRAY) {
+        return ndarray_get_float_index(self->leaf->array, self->leaf->dtype, index);
+    } else if(self->op == EXPRESSION_SCALAR) {
+        return self->value;
+    }
+    mp_float_t lvalue = expression_eval_item(MP_OBJ_TO_PTR(self->lhs), index);
+    mp_float_t rvalue = expression_eval_item(MP_OBJ_TO_PTR(self->rhs), index);
+    if(self->op == EXPRESSION_ADD) {
+        return lvalue + rvalue;
+    } else if(self->op == EXPRESSION_SUBTRACT) {
+        return lvalue - rvalue;
+    } else if(self->op == EXPRESSION_MULTIPLY) {
+        return lvalue * rvalue;
+    }
+    return lvalue / rvalue;
+}
+
+mp_obj_t expression_eval(mp_obj_t self_in) {
+    ndarray_expression_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(self->leaf == NULL) {
+        mp_raise_ValueError(translate("expression has no array leaf"));
+    }
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(self->leaf->ndim, self->leaf->shape, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)results->array;
+    for(size_t i = 0; i < results->len; i++) {
+        *array++ = expression_eval_item(self, i);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(expression_eval_obj, expression_eval);
+
+#endif /* ULAB_HAS_EXPRESSION */
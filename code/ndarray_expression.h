@@ -0,0 +1,50 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2022 Zoltán Vörös
+*/
+
+#ifndef _NDARRAY_EXPRESSION_
+#define _NDARRAY_EXPRESSION_
+
+#include "ulab.h"
+#include "ndarray.h"
+
+#if ULAB_HAS_EXPRESSION
+
+// opcodes of the expression nodes; the first two mark the leaves
+enum EXPRESSION_OPCODE {
+    EXPRESSION_NDARRAY,
+    EXPRESSION_SCALAR,
+    EXPRESSION_ADD,
+    EXPRESSION_SUBTRACT,
+    EXPRESSION_MULTIPLY,
+    EXPRESSION_TRUE_DIVIDE,
+};
+
+extern const mp_obj_type_t ulab_expression_type;
+
+typedef struct _ndarray_expression_obj_t {
+    mp_obj_base_t base;
+    uint8_t op;
+    mp_obj_t lhs;           // a sub-expression for inner nodes, otherwise MP_OBJ_NULL
+    mp_obj_t rhs;           // a sub-expression for inner nodes, otherwise MP_OBJ_NULL
+    ndarray_obj_t *leaf;    // the ndarray of a leaf; fixes the shape of the expression
+    mp_float_t value;       // the payload of a scalar leaf
+} ndarray_expression_obj_t;
+
+void expression_print(const mp_print_t *, mp_obj_t , mp_print_kind_t );
+mp_obj_t expression_make_new(const mp_obj_type_t *, size_t , size_t , const mp_obj_t *);
+mp_obj_t expression_binary_op(mp_binary_op_t , mp_obj_t , mp_obj_t );
+
+mp_obj_t expression_eval(mp_obj_t );
+MP_DECLARE_CONST_FUN_OBJ_1(expression_eval_obj);
+
+#endif /* ULAB_HAS_EXPRESSION */
+
+#endif
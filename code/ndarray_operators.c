@@ -37,6 +37,328 @@
     uint16 + int16 => float
 */
 
+#if NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH && defined(__ARM_FEATURE_SIMD32)
+#include <string.h>
+#include <arm_acle.h>
+
+// Packed-SIMD kernels for the contiguous fast path on Cortex-M4/M7 (ARMv7E-M DSP
+// extension and up). The lane-wise additions wrap modulo the lane width, just as
+// the C integer truncation in the generic loops does, so the results are bit-exact.
+// The words are moved with memcpy, so that the kernels also work for operands
+// that are only aligned to their own itemsize.
+
+static void ndarray_flat_add_int16(int16_t *out, int16_t *larray, int16_t *rarray, size_t count) {
+    while(count >= 2) {
+        uint32_t lword, rword, oword;
+        memcpy(&lword, larray, sizeof(uint32_t));
+        memcpy(&rword, rarray, sizeof(uint32_t));
+        oword = __sadd16(lword, rword);
+        memcpy(out, &oword, sizeof(uint32_t));
+        out += 2;
+        larray += 2;
+        rarray += 2;
+        count -= 2;
+    }
+    if(count) {
+        *out = *larray + *rarray;
+    }
+}
+
+static void ndarray_flat_subtract_int16(int16_t *out, int16_t *larray, int16_t *rarray, size_t count) {
+    while(count >= 2) {
+        uint32_t lword, rword, oword;
+        memcpy(&lword, larray, sizeof(uint32_t));
+        memcpy(&rword, rarray, sizeof(uint32_t));
+        oword = __ssub16(lword, rword);
+        memcpy(out, &oword, sizeof(uint32_t));
+        out += 2;
+        larray += 2;
+        rarray += 2;
+        count -= 2;
+    }
+    if(count) {
+        *out = *larray - *rarray;
+    }
+}
+
+static void ndarray_flat_add_int8(int8_t *out, int8_t *larray, int8_t *rarray, size_t count) {
+    while(count >= 4) {
+        uint32_t lword, rword, oword;
+        memcpy(&lword, larray, sizeof(uint32_t));
+        memcpy(&rword, rarray, sizeof(uint32_t));
+        oword = __sadd8(lword, rword);
+        memcpy(out, &oword, sizeof(uint32_t));
+        out += 4;
+        larray += 4;
+        rarray += 4;
+        count -= 4;
+    }
+    while(count--) {
+        *out++ = *larray++ + *rarray++;
+    }
+}
+
+static void ndarray_flat_subtract_int8(int8_t *out, int8_t *larray, int8_t *rarray, size_t count) {
+    while(count >= 4) {
+        uint32_t lword, rword, oword;
+        memcpy(&lword, larray, sizeof(uint32_t));
+        memcpy(&rword, rarray, sizeof(uint32_t));
+        oword = __ssub8(lword, rword);
+        memcpy(out, &oword, sizeof(uint32_t));
+        out += 4;
+        larray += 4;
+        rarray += 4;
+        count -= 4;
+    }
+    while(count--) {
+        *out++ = *larray++ - *rarray++;
+    }
+}
+
+static void ndarray_flat_subtract_uint8(uint8_t *out, uint8_t *larray, uint8_t *rarray, size_t count) {
+    while(count >= 4) {
+        uint32_t lword, rword, oword;
+        memcpy(&lword, larray, sizeof(uint32_t));
+        memcpy(&rword, rarray, sizeof(uint32_t));
+        oword = __usub8(lword, rword);
+        memcpy(out, &oword, sizeof(uint32_t));
+        out += 4;
+        larray += 4;
+        rarray += 4;
+        count -= 4;
+    }
+    while(count--) {
+        *out++ = *larray++ - *rarray++;
+    }
+}
+#endif /* NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH && __ARM_FEATURE_SIMD32 */
+
+#if ULAB_USES_DTYPE_DISPATCH_TABLES
+
+// Instead of expanding the nested dimension loops for every dtype combination,
+// the arithmetic operators can work from a table of row kernels: one short,
+// tight loop per dtype pair, all emitted back-to-back in flash, with a single
+// shared walker supplying the rows. The output dtypes in the tables follow
+// the upcasting rules listed at the top of this file.
+
+typedef void (*ndarray_row_kernel_t)(uint8_t *, uint8_t *, int32_t , uint8_t *, int32_t , size_t );
+
+typedef struct _ndarray_binary_kernel_t {
+    uint8_t dtype;
+    ndarray_row_kernel_t kernel;
+} ndarray_binary_kernel_t;
+
+static uint8_t ndarray_dtype_index(uint8_t dtype) {
+    if(dtype == NDARRAY_UINT8) {
+        return 0;
+    } else if(dtype == NDARRAY_INT8) {
+        return 1;
+    } else if(dtype == NDARRAY_UINT16) {
+        return 2;
+    } else if(dtype == NDARRAY_INT16) {
+        return 3;
+    }
+    return 4; // NDARRAY_FLOAT
+}
+
+#define BINARY_ROW_KERNEL(name, type_out, type_left, type_right, OPERATOR)\
+static void name(uint8_t *out, uint8_t *larray, int32_t lstride, uint8_t *rarray, int32_t rstride, size_t count) {\
+    type_out *array = (type_out *)out;\
+    while(count--) {\
+        *array++ = *((type_left *)larray) OPERATOR *((type_right *)rarray);\
+        larray += lstride;\
+        rarray += rstride;\
+    }\
+}
+
+#if ULAB_HAS_DUAL_CORE
+typedef struct _ndarray_binary_row_job_t {
+    ndarray_row_kernel_t kernel;
+    uint8_t *out;
+    uint8_t itemsize;
+    uint8_t *larray;
+    int32_t lstride;
+    uint8_t *rarray;
+    int32_t rstride;
+} ndarray_binary_row_job_t;
+
+static void ndarray_binary_row_range(void *job_in, size_t start, size_t end, uint8_t slot) {
+    // runs the elements [start, end) of a single row kernel call, so that a
+    // long contiguous loop can be shared between the two cores
+    (void)slot;
+    ndarray_binary_row_job_t *job = (ndarray_binary_row_job_t *)job_in;
+    job->kernel(job->out + start * job->itemsize, job->larray + start * job->lstride, job->lstride,
+                job->rarray + start * job->rstride, job->rstride, end - start);
+}
+#endif /* ULAB_HAS_DUAL_CORE */
+
+static mp_obj_t ndarray_binary_from_kernel_table(const ndarray_binary_kernel_t kernels[5][5], ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+    const ndarray_binary_kernel_t *entry = &kernels[ndarray_dtype_index(lhs->dtype)][ndarray_dtype_index(rhs->dtype)];
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, entry->dtype);
+    uint8_t *array = (uint8_t *)results->array;
+    uint8_t *larray = (uint8_t *)lhs->array;
+    uint8_t *rarray = (uint8_t *)rhs->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                #if ULAB_HAS_DUAL_CORE
+                ndarray_binary_row_job_t job = {
+                    entry->kernel, array, results->itemsize,
+                    larray, lstrides[ULAB_MAX_DIMS - 1],
+                    rarray, rstrides[ULAB_MAX_DIMS - 1],
+                };
+                ulab_parallel_run(ndarray_binary_row_range, &job, results->shape[ULAB_MAX_DIMS - 1], ULAB_PARALLEL_THRESHOLD);
+                #else
+                entry->kernel(array, larray, lstrides[ULAB_MAX_DIMS - 1], rarray, rstrides[ULAB_MAX_DIMS - 1], results->shape[ULAB_MAX_DIMS - 1]);
+                #endif
+                array += results->shape[ULAB_MAX_DIMS - 1] * results->itemsize;
+            #if ULAB_MAX_DIMS > 1
+                larray += lstrides[ULAB_MAX_DIMS - 2];
+                rarray += rstrides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < results->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            larray -= lstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            larray += lstrides[ULAB_MAX_DIMS - 3];
+            rarray -= rstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            rarray += rstrides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < results->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        larray -= lstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        larray += lstrides[ULAB_MAX_DIMS - 4];
+        rarray -= rstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        rarray += rstrides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < results->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    return MP_OBJ_FROM_PTR(results);
+}
+
+#if NDARRAY_HAS_BINARY_OP_ADD
+BINARY_ROW_KERNEL(ndarray_add_row_uint8_uint8, uint16_t, uint8_t, uint8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint8_int8, int16_t, uint8_t, int8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint8_uint16, uint16_t, uint8_t, uint16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint8_int16, int16_t, uint8_t, int16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint8_float, mp_float_t, uint8_t, mp_float_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int8_uint8, int16_t, int8_t, uint8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int8_int8, int8_t, int8_t, int8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int8_uint16, int16_t, int8_t, uint16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int8_int16, int16_t, int8_t, int16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int8_float, mp_float_t, int8_t, mp_float_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint16_uint8, uint16_t, uint16_t, uint8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint16_int8, int16_t, uint16_t, int8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint16_uint16, uint16_t, uint16_t, uint16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint16_int16, mp_float_t, uint16_t, int16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_uint16_float, mp_float_t, uint16_t, mp_float_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int16_uint8, int16_t, int16_t, uint8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int16_int8, int16_t, int16_t, int8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int16_uint16, mp_float_t, int16_t, uint16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int16_int16, int16_t, int16_t, int16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_int16_float, mp_float_t, int16_t, mp_float_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_float_uint8, mp_float_t, mp_float_t, uint8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_float_int8, mp_float_t, mp_float_t, int8_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_float_uint16, mp_float_t, mp_float_t, uint16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_float_int16, mp_float_t, mp_float_t, int16_t, +)
+BINARY_ROW_KERNEL(ndarray_add_row_float_float, mp_float_t, mp_float_t, mp_float_t, +)
+
+static const ndarray_binary_kernel_t ndarray_add_kernels[5][5] = {
+    { { NDARRAY_UINT16, ndarray_add_row_uint8_uint8 }, { NDARRAY_INT16, ndarray_add_row_uint8_int8 }, { NDARRAY_UINT16, ndarray_add_row_uint8_uint16 }, { NDARRAY_INT16, ndarray_add_row_uint8_int16 }, { NDARRAY_FLOAT, ndarray_add_row_uint8_float } },
+    { { NDARRAY_INT16, ndarray_add_row_int8_uint8 }, { NDARRAY_INT8, ndarray_add_row_int8_int8 }, { NDARRAY_INT16, ndarray_add_row_int8_uint16 }, { NDARRAY_INT16, ndarray_add_row_int8_int16 }, { NDARRAY_FLOAT, ndarray_add_row_int8_float } },
+    { { NDARRAY_UINT16, ndarray_add_row_uint16_uint8 }, { NDARRAY_INT16, ndarray_add_row_uint16_int8 }, { NDARRAY_UINT16, ndarray_add_row_uint16_uint16 }, { NDARRAY_FLOAT, ndarray_add_row_uint16_int16 }, { NDARRAY_FLOAT, ndarray_add_row_uint16_float } },
+    { { NDARRAY_INT16, ndarray_add_row_int16_uint8 }, { NDARRAY_INT16, ndarray_add_row_int16_int8 }, { NDARRAY_FLOAT, ndarray_add_row_int16_uint16 }, { NDARRAY_INT16, ndarray_add_row_int16_int16 }, { NDARRAY_FLOAT, ndarray_add_row_int16_float } },
+    { { NDARRAY_FLOAT, ndarray_add_row_float_uint8 }, { NDARRAY_FLOAT, ndarray_add_row_float_int8 }, { NDARRAY_FLOAT, ndarray_add_row_float_uint16 }, { NDARRAY_FLOAT, ndarray_add_row_float_int16 }, { NDARRAY_FLOAT, ndarray_add_row_float_float } },
+};
+#endif /* NDARRAY_HAS_BINARY_OP_ADD */
+
+#if NDARRAY_HAS_BINARY_OP_SUBTRACT
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint8_uint8, uint8_t, uint8_t, uint8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint8_int8, int16_t, uint8_t, int8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint8_uint16, uint16_t, uint8_t, uint16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint8_int16, int16_t, uint8_t, int16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint8_float, mp_float_t, uint8_t, mp_float_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int8_uint8, int16_t, int8_t, uint8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int8_int8, int8_t, int8_t, int8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int8_uint16, int16_t, int8_t, uint16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int8_int16, int16_t, int8_t, int16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int8_float, mp_float_t, int8_t, mp_float_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint16_uint8, uint16_t, uint16_t, uint8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint16_int8, uint16_t, uint16_t, int8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint16_uint16, uint16_t, uint16_t, uint16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint16_int16, mp_float_t, uint16_t, int16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_uint16_float, mp_float_t, uint16_t, mp_float_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int16_uint8, int16_t, int16_t, uint8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int16_int8, int16_t, int16_t, int8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int16_uint16, mp_float_t, int16_t, uint16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int16_int16, int16_t, int16_t, int16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_int16_float, mp_float_t, int16_t, mp_float_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_float_uint8, mp_float_t, mp_float_t, uint8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_float_int8, mp_float_t, mp_float_t, int8_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_float_uint16, mp_float_t, mp_float_t, uint16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_float_int16, mp_float_t, mp_float_t, int16_t, -)
+BINARY_ROW_KERNEL(ndarray_subtract_row_float_float, mp_float_t, mp_float_t, mp_float_t, -)
+
+static const ndarray_binary_kernel_t ndarray_subtract_kernels[5][5] = {
+    { { NDARRAY_UINT8, ndarray_subtract_row_uint8_uint8 }, { NDARRAY_INT16, ndarray_subtract_row_uint8_int8 }, { NDARRAY_UINT16, ndarray_subtract_row_uint8_uint16 }, { NDARRAY_INT16, ndarray_subtract_row_uint8_int16 }, { NDARRAY_FLOAT, ndarray_subtract_row_uint8_float } },
+    { { NDARRAY_INT16, ndarray_subtract_row_int8_uint8 }, { NDARRAY_INT8, ndarray_subtract_row_int8_int8 }, { NDARRAY_INT16, ndarray_subtract_row_int8_uint16 }, { NDARRAY_INT16, ndarray_subtract_row_int8_int16 }, { NDARRAY_FLOAT, ndarray_subtract_row_int8_float } },
+    { { NDARRAY_UINT16, ndarray_subtract_row_uint16_uint8 }, { NDARRAY_UINT16, ndarray_subtract_row_uint16_int8 }, { NDARRAY_UINT16, ndarray_subtract_row_uint16_uint16 }, { NDARRAY_FLOAT, ndarray_subtract_row_uint16_int16 }, { NDARRAY_FLOAT, ndarray_subtract_row_uint16_float } },
+    { { NDARRAY_INT16, ndarray_subtract_row_int16_uint8 }, { NDARRAY_INT16, ndarray_subtract_row_int16_int8 }, { NDARRAY_FLOAT, ndarray_subtract_row_int16_uint16 }, { NDARRAY_INT16, ndarray_subtract_row_int16_int16 }, { NDARRAY_FLOAT, ndarray_subtract_row_int16_float } },
+    { { NDARRAY_FLOAT, ndarray_subtract_row_float_uint8 }, { NDARRAY_FLOAT, ndarray_subtract_row_float_int8 }, { NDARRAY_FLOAT, ndarray_subtract_row_float_uint16 }, { NDARRAY_FLOAT, ndarray_subtract_row_float_int16 }, { NDARRAY_FLOAT, ndarray_subtract_row_float_float } },
+};
+#endif /* NDARRAY_HAS_BINARY_OP_SUBTRACT */
+
+#if NDARRAY_HAS_BINARY_OP_MULTIPLY
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint8_uint8, uint16_t, uint8_t, uint8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint8_int8, int16_t, uint8_t, int8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint8_uint16, uint16_t, uint8_t, uint16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint8_int16, int16_t, uint8_t, int16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint8_float, mp_float_t, uint8_t, mp_float_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int8_uint8, int16_t, int8_t, uint8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int8_int8, int8_t, int8_t, int8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int8_uint16, int16_t, int8_t, uint16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int8_int16, int16_t, int8_t, int16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int8_float, mp_float_t, int8_t, mp_float_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint16_uint8, uint16_t, uint16_t, uint8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint16_int8, int16_t, uint16_t, int8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint16_uint16, uint16_t, uint16_t, uint16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint16_int16, mp_float_t, uint16_t, int16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_uint16_float, mp_float_t, uint16_t, mp_float_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int16_uint8, int16_t, int16_t, uint8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int16_int8, int16_t, int16_t, int8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int16_uint16, mp_float_t, int16_t, uint16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int16_int16, int16_t, int16_t, int16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_int16_float, mp_float_t, int16_t, mp_float_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_float_uint8, mp_float_t, mp_float_t, uint8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_float_int8, mp_float_t, mp_float_t, int8_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_float_uint16, mp_float_t, mp_float_t, uint16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_float_int16, mp_float_t, mp_float_t, int16_t, *)
+BINARY_ROW_KERNEL(ndarray_multiply_row_float_float, mp_float_t, mp_float_t, mp_float_t, *)
+
+static const ndarray_binary_kernel_t ndarray_multiply_kernels[5][5] = {
+    { { NDARRAY_UINT16, ndarray_multiply_row_uint8_uint8 }, { NDARRAY_INT16, ndarray_multiply_row_uint8_int8 }, { NDARRAY_UINT16, ndarray_multiply_row_uint8_uint16 }, { NDARRAY_INT16, ndarray_multiply_row_uint8_int16 }, { NDARRAY_FLOAT, ndarray_multiply_row_uint8_float } },
+    { { NDARRAY_INT16, ndarray_multiply_row_int8_uint8 }, { NDARRAY_INT8, ndarray_multiply_row_int8_int8 }, { NDARRAY_INT16, ndarray_multiply_row_int8_uint16 }, { NDARRAY_INT16, ndarray_multiply_row_int8_int16 }, { NDARRAY_FLOAT, ndarray_multiply_row_int8_float } },
+    { { NDARRAY_UINT16, ndarray_multiply_row_uint16_uint8 }, { NDARRAY_INT16, ndarray_multiply_row_uint16_int8 }, { NDARRAY_UINT16, ndarray_multiply_row_uint16_uint16 }, { NDARRAY_FLOAT, ndarray_multiply_row_uint16_int16 }, { NDARRAY_FLOAT, ndarray_multiply_row_uint16_float } },
+    { { NDARRAY_INT16, ndarray_multiply_row_int16_uint8 }, { NDARRAY_INT16, ndarray_multiply_row_int16_int8 }, { NDARRAY_FLOAT, ndarray_multiply_row_int16_uint16 }, { NDARRAY_INT16, ndarray_multiply_row_int16_int16 }, { NDARRAY_FLOAT, ndarray_multiply_row_int16_float } },
+    { { NDARRAY_FLOAT, ndarray_multiply_row_float_uint8 }, { NDARRAY_FLOAT, ndarray_multiply_row_float_int8 }, { NDARRAY_FLOAT, ndarray_multiply_row_float_uint16 }, { NDARRAY_FLOAT, ndarray_multiply_row_float_int16 }, { NDARRAY_FLOAT, ndarray_multiply_row_float_float } },
+};
+#endif /* NDARRAY_HAS_BINARY_OP_MULTIPLY */
+
+#endif /* ULAB_USES_DTYPE_DISPATCH_TABLES */
+
 #if NDARRAY_HAS_BINARY_OP_EQUAL | NDARRAY_HAS_BINARY_OP_NOT_EQUAL
 mp_obj_t ndarray_binary_equality(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                                             uint8_t ndim, size_t *shape,  int32_t *lstrides, int32_t *rstrides, mp_binary_op_t op) {
@@ -175,6 +497,23 @@ mp_obj_t ndarray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
     #endif
 
+    #if NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH && defined(__ARM_FEATURE_SIMD32)
+    if((lhs->dtype == rhs->dtype) &&
+        ((lhs->dtype == NDARRAY_INT16) || (lhs->dtype == NDARRAY_INT8)) &&
+        ndarray_binary_is_flat(ndim, shape, lstrides, lhs->itemsize, rstrides, rhs->itemsize)) {
+        ndarray_obj_t *flat = ndarray_new_dense_ndarray(ndim, shape, lhs->dtype);
+        if(lhs->dtype == NDARRAY_INT16) {
+            ndarray_flat_add_int16((int16_t *)flat->array, (int16_t *)lhs->array, (int16_t *)rhs->array, flat->len);
+        } else {
+            ndarray_flat_add_int8((int8_t *)flat->array, (int8_t *)lhs->array, (int8_t *)rhs->array, flat->len);
+        }
+        return MP_OBJ_FROM_PTR(flat);
+    }
+    #endif
+
+    #if ULAB_USES_DTYPE_DISPATCH_TABLES
+    return ndarray_binary_from_kernel_table(ndarray_add_kernels, lhs, rhs, ndim, shape, lstrides, rstrides);
+    #else
     ndarray_obj_t *results = NULL;
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
@@ -245,6 +584,7 @@ mp_obj_t ndarray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
 
     return MP_OBJ_FROM_PTR(results);
+    #endif /* ULAB_USES_DTYPE_DISPATCH_TABLES */
 }
 #endif /* NDARRAY_HAS_BINARY_OP_ADD */
 
@@ -258,6 +598,9 @@ mp_obj_t ndarray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
     #endif
 
+    #if ULAB_USES_DTYPE_DISPATCH_TABLES
+    return ndarray_binary_from_kernel_table(ndarray_multiply_kernels, lhs, rhs, ndim, shape, lstrides, rstrides);
+    #else
     ndarray_obj_t *results = NULL;
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
@@ -328,6 +671,7 @@ mp_obj_t ndarray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
 
     return MP_OBJ_FROM_PTR(results);
+    #endif /* ULAB_USES_DTYPE_DISPATCH_TABLES */
 }
 #endif /* NDARRAY_HAS_BINARY_OP_MULTIPLY */
 
@@ -486,6 +830,25 @@ mp_obj_t ndarray_binary_subtract(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
     #endif
 
+    #if NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH && defined(__ARM_FEATURE_SIMD32)
+    if((lhs->dtype == rhs->dtype) &&
+        ((lhs->dtype == NDARRAY_INT16) || (lhs->dtype == NDARRAY_INT8) || (lhs->dtype == NDARRAY_UINT8)) &&
+        ndarray_binary_is_flat(ndim, shape, lstrides, lhs->itemsize, rstrides, rhs->itemsize)) {
+        ndarray_obj_t *flat = ndarray_new_dense_ndarray(ndim, shape, lhs->dtype);
+        if(lhs->dtype == NDARRAY_INT16) {
+            ndarray_flat_subtract_int16((int16_t *)flat->array, (int16_t *)lhs->array, (int16_t *)rhs->array, flat->len);
+        } else if(lhs->dtype == NDARRAY_INT8) {
+            ndarray_flat_subtract_int8((int8_t *)flat->array, (int8_t *)lhs->array, (int8_t *)rhs->array, flat->len);
+        } else {
+            ndarray_flat_subtract_uint8((uint8_t *)flat->array, (uint8_t *)lhs->array, (uint8_t *)rhs->array, flat->len);
+        }
+        return MP_OBJ_FROM_PTR(flat);
+    }
+    #endif
+
+    #if ULAB_USES_DTYPE_DISPATCH_TABLES
+    return ndarray_binary_from_kernel_table(ndarray_subtract_kernels, lhs, rhs, ndim, shape, lstrides, rstrides);
+    #else
     ndarray_obj_t *results = NULL;
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
@@ -578,6 +941,7 @@ mp_obj_t ndarray_binary_subtract(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
 
     return MP_OBJ_FROM_PTR(results);
+    #endif /* ULAB_USES_DTYPE_DISPATCH_TABLES */
 }
 #endif /* NDARRAY_HAS_BINARY_OP_SUBTRACT */
 
@@ -27,21 +27,68 @@
 
 ULAB_DEFINE_FLOAT_CONST(approx_trapz_dx, MICROPY_FLOAT_CONST(1.0), 0x3f800000UL, 0x3ff0000000000000ULL);
 
+#if ULAB_NUMPY_HAS_INTERP || ULAB_NUMPY_HAS_INTERP_PLAN
+// locates the interval of the increasing grid xp that brackets x_value,
+// which must lie between the first and last grid point; instead of
+// bisecting the whole grid, the search gallops forward from the bracket
+// of the previous query with doubling steps before narrowing down, so
+// for sorted queries the cost is proportional to the distance travelled
+static size_t approx_bracket(ndarray_obj_t *xp, size_t start, mp_float_t x_value) {
+    uint8_t *xparray = (uint8_t *)xp->array;
+    int32_t stride = xp->strides[ULAB_MAX_DIMS - 1];
+    size_t left_index, right_index;
+    uint8_t *temp = xparray + start * stride;
+    if(x_value < ndarray_get_float_value(temp, xp->dtype)) {
+        // the queries stepped backwards; fall back to a full bisection
+        left_index = 0;
+        right_index = xp->len - 1;
+    } else {
+        left_index = start;
+        right_index = left_index + 1;
+        size_t step = 1;
+        temp = xparray + right_index * stride;
+        while((right_index < xp->len - 1) && (ndarray_get_float_value(temp, xp->dtype) < x_value)) {
+            left_index = right_index;
+            step += step;
+            right_index = left_index + step < xp->len - 1 ? left_index + step : xp->len - 1;
+            temp = xparray + right_index * stride;
+        }
+    }
+    while(right_index - left_index > 1) {
+        size_t middle_index = left_index + (right_index - left_index) / 2;
+        temp = xparray + middle_index * stride;
+        if(x_value <= ndarray_get_float_value(temp, xp->dtype)) {
+            right_index = middle_index;
+        } else {
+            left_index = middle_index;
+        }
+    }
+    return left_index;
+}
+#endif
+
 #if ULAB_NUMPY_HAS_INTERP
 //| def interp(
 //|     x: ulab.numpy.ndarray,
-//|     xp: ulab.numpy.ndarray,
+//|     xp: Optional[ulab.numpy.ndarray],
 //|     fp: ulab.numpy.ndarray,
 //|     *,
 //|     left: Optional[_float] = None,
-//|     right: Optional[_float] = None
+//|     right: Optional[_float] = None,
+//|     x0: _float = 0.0,
+//|     dx: _float = 1.0
 //| ) -> ulab.numpy.ndarray:
 //|     """
 //|     :param ulab.numpy.ndarray x: The x-coordinates at which to evaluate the interpolated values.
-//|     :param ulab.numpy.ndarray xp: The x-coordinates of the data points, must be increasing
+//|     :param ulab.numpy.ndarray xp: The x-coordinates of the data points, must be increasing;
+//|       may be ``None`` for a uniform grid described by ``x0`` and ``dx``
 //|     :param ulab.numpy.ndarray fp: The y-coordinates of the data points, same length as xp
 //|     :param left: Value to return for ``x < xp[0]``, default is ``fp[0]``.
 //|     :param right: Value to return for ``x > xp[-1]``, default is ``fp[-1]``.
+//|     :param x0: First point of the uniform grid, when ``xp`` is ``None``.
+//|     :param dx: Spacing of the uniform grid, when ``xp`` is ``None``; in the vein
+//|       of ``trapz``'s ``dx``, this saves materializing an array that is an affine
+//|       function of the index, and replaces the binary search with an index computation.
 //|
 //|     Returns the one-dimensional piecewise linear interpolant to a function with given discrete data points (xp, fp), evaluated at x."""
 //|     ...
@@ -54,27 +101,57 @@ STATIC mp_obj_t approx_interp(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_left, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
         { MP_QSTR_right, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_x0, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_dx, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     ndarray_obj_t *x = ndarray_from_mp_obj(args[0].u_obj, 0);
-    ndarray_obj_t *xp = ndarray_from_mp_obj(args[1].u_obj, 0); // xp must hold an increasing sequence of independent values
     ndarray_obj_t *fp = ndarray_from_mp_obj(args[2].u_obj, 0);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
-    COMPLEX_DTYPE_NOT_IMPLEMENTED(xp->dtype)
     COMPLEX_DTYPE_NOT_IMPLEMENTED(fp->dtype)
-    if((xp->ndim != 1) || (fp->ndim != 1) || (xp->len < 2) || (fp->len < 2) || (xp->len != fp->len)) {
-        mp_raise_ValueError(translate("interp is defined for 1D iterables of equal length"));
+
+    // a uniform grid can be described by the x0/dx scalars alone, in the
+    // vein of trapz's dx argument, so that an axis that is an affine
+    // function of the index never has to be materialized
+    bool uniform = args[1].u_obj == mp_const_none;
+    ndarray_obj_t *xp = NULL;
+    mp_float_t grid_start = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t grid_step = MICROPY_FLOAT_CONST(1.0);
+    mp_float_t xp_left = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t xp_right = MICROPY_FLOAT_CONST(0.0);
+
+    if(uniform) {
+        if(args[5].u_obj != mp_const_none) {
+            grid_start = mp_obj_get_float(args[5].u_obj);
+        }
+        if(args[6].u_obj != mp_const_none) {
+            grid_step = mp_obj_get_float(args[6].u_obj);
+        }
+        if((fp->ndim != 1) || (fp->len < 2) || (grid_step <= MICROPY_FLOAT_CONST(0.0))) {
+            mp_raise_ValueError(translate("interp is defined for 1D iterables of equal length"));
+        }
+        xp_left = grid_start;
+        xp_right = grid_start + (fp->len - 1) * grid_step;
+    } else {
+        xp = ndarray_from_mp_obj(args[1].u_obj, 0); // xp must hold an increasing sequence of independent values
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(xp->dtype)
+        if((xp->ndim != 1) || (fp->ndim != 1) || (xp->len < 2) || (fp->len < 2) || (xp->len != fp->len)) {
+            mp_raise_ValueError(translate("interp is defined for 1D iterables of equal length"));
+        }
     }
 
     ndarray_obj_t *y = ndarray_new_linear_array(x->len, NDARRAY_FLOAT);
     mp_float_t left_value, right_value;
-    uint8_t *xparray = (uint8_t *)xp->array;
+    uint8_t *xparray = NULL;
 
-    mp_float_t xp_left = ndarray_get_float_value(xparray, xp->dtype);
-    xparray += (xp->len-1) * xp->strides[ULAB_MAX_DIMS - 1];
-    mp_float_t xp_right = ndarray_get_float_value(xparray, xp->dtype);
+    if(!uniform) {
+        xparray = (uint8_t *)xp->array;
+        xp_left = ndarray_get_float_value(xparray, xp->dtype);
+        xparray += (xp->len-1) * xp->strides[ULAB_MAX_DIMS - 1];
+        xp_right = ndarray_get_float_value(xparray, xp->dtype);
+    }
 
     uint8_t *fparray = (uint8_t *)fp->array;
 
@@ -90,12 +167,15 @@ STATIC mp_obj_t approx_interp(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         right_value = mp_obj_get_float(args[4].u_obj);
     }
 
-    xparray = xp->array;
+    if(!uniform) {
+        xparray = xp->array;
+    }
     fparray = fp->array;
 
     uint8_t *xarray = (uint8_t *)x->array;
     mp_float_t *yarray = (mp_float_t *)y->array;
     uint8_t *temp;
+    size_t search_index = 0;
 
     for(size_t i=0; i < x->len; i++, yarray++) {
         mp_float_t x_value = ndarray_get_float_value(xarray, x->dtype);
@@ -104,25 +184,31 @@ STATIC mp_obj_t approx_interp(size_t n_args, const mp_obj_t *pos_args, mp_map_t
             *yarray = left_value;
         } else if(x_value > xp_right) {
             *yarray = right_value;
-        } else { // do the binary search here
+        } else {
             mp_float_t xp_left_, xp_right_;
             mp_float_t fp_left, fp_right;
-            size_t left_index = 0, right_index = xp->len - 1, middle_index;
-            while(right_index - left_index > 1) {
-                middle_index = left_index + (right_index - left_index) / 2;
-                temp = xparray + middle_index * xp->strides[ULAB_MAX_DIMS - 1];
-                mp_float_t xp_middle = ndarray_get_float_value(temp, xp->dtype);
-                if(x_value <= xp_middle) {
-                    right_index = middle_index;
-                } else {
-                    left_index = middle_index;
+            size_t left_index = 0, right_index;
+            if(uniform) {
+                // on a uniform grid the bracketing interval follows from
+                // the index computation alone
+                mp_float_t position = (x_value - grid_start) / grid_step;
+                left_index = position <= MICROPY_FLOAT_CONST(0.0) ? 0 : (size_t)position;
+                if(left_index > fp->len - 2) {
+                    left_index = fp->len - 2;
                 }
-            }
-            temp = xparray + left_index * xp->strides[ULAB_MAX_DIMS - 1];
-            xp_left_ = ndarray_get_float_value(temp, xp->dtype);
+                right_index = left_index + 1;
+                xp_left_ = grid_start + left_index * grid_step;
+                xp_right_ = xp_left_ + grid_step;
+            } else { // gallop from the bracket of the previous query point
+                left_index = approx_bracket(xp, search_index, x_value);
+                search_index = left_index;
+                right_index = left_index + 1;
+                temp = xparray + left_index * xp->strides[ULAB_MAX_DIMS - 1];
+                xp_left_ = ndarray_get_float_value(temp, xp->dtype);
 
-            temp = xparray + right_index * xp->strides[ULAB_MAX_DIMS - 1];
-            xp_right_ = ndarray_get_float_value(temp, xp->dtype);
+                temp = xparray + right_index * xp->strides[ULAB_MAX_DIMS - 1];
+                xp_right_ = ndarray_get_float_value(temp, xp->dtype);
+            }
 
             temp = fparray + left_index * fp->strides[ULAB_MAX_DIMS - 1];
             fp_left = ndarray_get_float_value(temp, fp->dtype);
@@ -139,6 +225,123 @@ STATIC mp_obj_t approx_interp(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 MP_DEFINE_CONST_FUN_OBJ_KW(approx_interp_obj, 2, approx_interp);
 #endif
 
+#if ULAB_NUMPY_HAS_INTERP_PLAN
+//| class interp_plan:
+//|     """A precomputed linear interpolation plan. The constructor runs the
+//|     bracket search of ``interp(x, xp, fp)`` once, caching the bracketing
+//|     index and the fractional weight of every query point; evaluate(fp)
+//|     then maps any set of ordinates sampled on the same grid onto the
+//|     query points with a single fused multiply-add per point. Query
+//|     points outside the grid are clamped to the end values, as with
+//|     ``interp``'s defaults."""
+//|     ...
+//|
+
+typedef struct _approx_interp_plan_obj_t {
+    mp_obj_base_t base;
+    size_t len; // the number of query points
+    size_t npoints; // the length of the (xp, fp) grid
+    size_t *index; // left bracketing index of each query point
+    mp_float_t *weight; // fractional position inside the bracket
+} approx_interp_plan_obj_t;
+
+static mp_obj_t approx_interp_plan_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 2, 2, false);
+    ndarray_obj_t *x = ndarray_from_mp_obj(all_args[0], 0);
+    ndarray_obj_t *xp = ndarray_from_mp_obj(all_args[1], 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(xp->dtype)
+    if((xp->ndim != 1) || (xp->len < 2)) {
+        mp_raise_ValueError(translate("interp is defined for 1D iterables of equal length"));
+    }
+
+    approx_interp_plan_obj_t *self = m_new_obj(approx_interp_plan_obj_t);
+    self->base.type = &approx_interp_plan_type;
+    self->len = x->len;
+    self->npoints = xp->len;
+    self->index = m_new(size_t, x->len);
+    self->weight = m_new(mp_float_t, x->len);
+
+    uint8_t *xparray = (uint8_t *)xp->array;
+    mp_float_t xp_left = ndarray_get_float_value(xparray, xp->dtype);
+    xparray += (xp->len-1) * xp->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t xp_right = ndarray_get_float_value(xparray, xp->dtype);
+    xparray = (uint8_t *)xp->array;
+
+    uint8_t *xarray = (uint8_t *)x->array;
+    uint8_t *temp;
+    size_t search_index = 0;
+
+    for(size_t i = 0; i < x->len; i++) {
+        mp_float_t x_value = ndarray_get_float_value(xarray, x->dtype);
+        xarray += x->strides[ULAB_MAX_DIMS - 1];
+        if(x_value < xp_left) {
+            self->index[i] = 0;
+            self->weight[i] = MICROPY_FLOAT_CONST(0.0);
+        } else if(x_value > xp_right) {
+            self->index[i] = xp->len - 2;
+            self->weight[i] = MICROPY_FLOAT_CONST(1.0);
+        } else {
+            size_t left_index = approx_bracket(xp, search_index, x_value);
+            search_index = left_index;
+            temp = xparray + left_index * xp->strides[ULAB_MAX_DIMS - 1];
+            mp_float_t xp_left_ = ndarray_get_float_value(temp, xp->dtype);
+            temp += xp->strides[ULAB_MAX_DIMS - 1];
+            mp_float_t xp_right_ = ndarray_get_float_value(temp, xp->dtype);
+            self->index[i] = left_index;
+            self->weight[i] = (x_value - xp_left_) / (xp_right_ - xp_left_);
+        }
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t approx_interp_plan_evaluate(mp_obj_t self_in, mp_obj_t fp_in) {
+    approx_interp_plan_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    ndarray_obj_t *fp = ndarray_from_mp_obj(fp_in, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(fp->dtype)
+    if((fp->ndim != 1) || (fp->len != self->npoints)) {
+        mp_raise_ValueError(translate("fp must be a 1D iterable of the grid's length"));
+    }
+
+    ndarray_obj_t *y = ndarray_new_linear_array(self->len, NDARRAY_FLOAT);
+    mp_float_t *yarray = (mp_float_t *)y->array;
+
+    if((fp->dtype == NDARRAY_FLOAT) && ndarray_is_dense(fp)) {
+        mp_float_t *fparray = (mp_float_t *)fp->array;
+        for(size_t i = 0; i < self->len; i++) {
+            mp_float_t fp_left = fparray[self->index[i]];
+            *yarray++ = fp_left + self->weight[i] * (fparray[self->index[i] + 1] - fp_left);
+        }
+    } else {
+        uint8_t *fparray = (uint8_t *)fp->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(fp->dtype);
+        for(size_t i = 0; i < self->len; i++) {
+            uint8_t *temp = fparray + self->index[i] * fp->strides[ULAB_MAX_DIMS - 1];
+            mp_float_t fp_left = func(temp);
+            mp_float_t fp_right = func(temp + fp->strides[ULAB_MAX_DIMS - 1]);
+            *yarray++ = fp_left + self->weight[i] * (fp_right - fp_left);
+        }
+    }
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(approx_interp_plan_evaluate_obj, approx_interp_plan_evaluate);
+
+static const mp_rom_map_elem_t approx_interp_plan_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_evaluate), MP_ROM_PTR(&approx_interp_plan_evaluate_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(approx_interp_plan_locals_dict, approx_interp_plan_locals_dict_table);
+
+const mp_obj_type_t approx_interp_plan_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_interp_plan,
+    .make_new = approx_interp_plan_make_new,
+    .locals_dict = (mp_obj_dict_t*)&approx_interp_plan_locals_dict,
+};
+#endif
+
 #if ULAB_NUMPY_HAS_TRAPZ
 //| def trapz(y: ulab.numpy.ndarray, x: Optional[ulab.numpy.ndarray] = None, dx: _float = 1.0) -> _float:
 //|     """
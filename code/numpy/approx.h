@@ -23,6 +23,8 @@
 #define     APPROX_GAMMA        MICROPY_FLOAT_CONST(0.5)
 #define     APPROX_DELTA        MICROPY_FLOAT_CONST(0.5)
 
+extern const mp_obj_type_t approx_interp_plan_type;
+
 MP_DECLARE_CONST_FUN_OBJ_KW(approx_interp_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(approx_trapz_obj);
 
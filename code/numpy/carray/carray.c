@@ -214,6 +214,21 @@ mp_obj_t carray_abs(ndarray_obj_t *source, ndarray_obj_t *target) {
     mp_float_t *tarray = (mp_float_t *)target->array;
     uint8_t itemsize = mp_binary_get_size('@', NDARRAY_FLOAT, NULL);
 
+    #if ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+    if(ndarray_is_dense(source)) {
+        // the interleaved buffer can be walked as a flat float vector
+        mp_float_t *farray = (mp_float_t *)source->array;
+        size_t len = source->len;
+        while(len--) {
+            mp_float_t rvalue = farray[0];
+            mp_float_t ivalue = farray[1];
+            *tarray++ = MICROPY_FLOAT_C_FUN(sqrt)(rvalue * rvalue + ivalue * ivalue);
+            farray += 2;
+        }
+        return MP_OBJ_FROM_PTR(target);
+    }
+    #endif
+
     #if ULAB_MAX_DIMS > 3
     size_t i = 0;
     do {
@@ -255,6 +270,96 @@ mp_obj_t carray_abs(ndarray_obj_t *source, ndarray_obj_t *target) {
     return MP_OBJ_FROM_PTR(target);
 }
 
+#if ULAB_NUMPY_HAS_MAGPHASE
+//| def magphase(a: ulab.numpy.ndarray) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     .. param: a
+//|       a complex ndarray
+//|
+//|     Return the magnitude and the phase of a complex ndarray as a
+//|     (magnitude, phase) tuple of dense float arrays; the two values
+//|     are calculated from each element in a single pass."""
+//|     ...
+//|
+
+mp_obj_t carray_magphase(mp_obj_t _source) {
+    if(!mp_obj_is_type(_source, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *source = MP_OBJ_TO_PTR(_source);
+    if(source->dtype != NDARRAY_COMPLEX) {
+        mp_raise_TypeError(translate("input must be a complex ndarray"));
+    }
+    ndarray_obj_t *magnitude = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    ndarray_obj_t *phase = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    mp_float_t *marray = (mp_float_t *)magnitude->array;
+    mp_float_t *parray = (mp_float_t *)phase->array;
+    mp_obj_t items[2] = { MP_OBJ_FROM_PTR(magnitude), MP_OBJ_FROM_PTR(phase) };
+
+    #if ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+    if(ndarray_is_dense(source)) {
+        // the interleaved buffer can be walked as a flat float vector
+        mp_float_t *farray = (mp_float_t *)source->array;
+        size_t len = source->len;
+        while(len--) {
+            mp_float_t rvalue = farray[0];
+            mp_float_t ivalue = farray[1];
+            *marray++ = MICROPY_FLOAT_C_FUN(sqrt)(rvalue * rvalue + ivalue * ivalue);
+            *parray++ = MICROPY_FLOAT_C_FUN(atan2)(ivalue, rvalue);
+            farray += 2;
+        }
+        return mp_obj_new_tuple(2, items);
+    }
+    #endif
+
+    uint8_t *sarray = (uint8_t *)source->array;
+    uint8_t itemsize = mp_binary_get_size('@', NDARRAY_FLOAT, NULL);
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    mp_float_t rvalue = *(mp_float_t *)sarray;
+                    mp_float_t ivalue = *(mp_float_t *)(sarray + itemsize);
+                    *marray++ = MICROPY_FLOAT_C_FUN(sqrt)(rvalue * rvalue + ivalue * ivalue);
+                    *parray++ = MICROPY_FLOAT_C_FUN(atan2)(ivalue, rvalue);
+                    sarray += source->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < source->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                sarray -= source->strides[ULAB_MAX_DIMS - 1] * source->shape[ULAB_MAX_DIMS-1];
+                sarray += source->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < source->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            sarray -= source->strides[ULAB_MAX_DIMS - 2] * source->shape[ULAB_MAX_DIMS-2];
+            sarray += source->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < source->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        sarray -= source->strides[ULAB_MAX_DIMS - 3] * source->shape[ULAB_MAX_DIMS-3];
+        sarray += source->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < source->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+    return mp_obj_new_tuple(2, items);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(carray_magphase_obj, carray_magphase);
+#endif
+
 static void carray_copy_part(uint8_t *tarray, uint8_t *sarray, size_t *shape, int32_t *strides) {
     // copies the real or imaginary part of an array
     // into the respective part of a dense complex array
@@ -407,6 +512,28 @@ mp_obj_t carray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         mp_float_t *larray = (mp_float_t *)lhs->array;
         mp_float_t *rarray = (mp_float_t *)rhs->array;
 
+        #if ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+        if(ndarray_is_dense(lhs) && ndarray_is_dense(rhs) &&
+            (lhs->len == results->len) && (rhs->len == results->len)) {
+            // no broadcasting is taking place, and both operands are contiguous,
+            // so the interleaved buffers can be added as flat float vectors
+            size_t n = 2 * results->len;
+            size_t l = 0;
+            while(l + 4 <= n) { // unrolled by two complex elements
+                resarray[l] = larray[l] + rarray[l];
+                resarray[l + 1] = larray[l + 1] + rarray[l + 1];
+                resarray[l + 2] = larray[l + 2] + rarray[l + 2];
+                resarray[l + 3] = larray[l + 3] + rarray[l + 3];
+                l += 4;
+            }
+            while(l < n) {
+                resarray[l] = larray[l] + rarray[l];
+                l++;
+            }
+            return MP_OBJ_FROM_PTR(results);
+        }
+        #endif
+
         ulab_rescale_float_strides(lstrides);
         ulab_rescale_float_strides(rstrides);
 
@@ -527,6 +654,31 @@ mp_obj_t carray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         mp_float_t *larray = (mp_float_t *)lhs->array;
         mp_float_t *rarray = (mp_float_t *)rhs->array;
 
+        #if ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+        if(ndarray_is_dense(lhs) && ndarray_is_dense(rhs) &&
+            (lhs->len == results->len) && (rhs->len == results->len)) {
+            // no broadcasting is taking place, and both operands are contiguous,
+            // so the interleaved buffers can be multiplied as flat float pairs
+            size_t len = results->len;
+            size_t l = 0;
+            while(l + 2 <= len) { // unrolled by two complex elements
+                resarray[0] = larray[0] * rarray[0] - larray[1] * rarray[1];
+                resarray[1] = larray[0] * rarray[1] + larray[1] * rarray[0];
+                resarray[2] = larray[2] * rarray[2] - larray[3] * rarray[3];
+                resarray[3] = larray[2] * rarray[3] + larray[3] * rarray[2];
+                resarray += 4;
+                larray += 4;
+                rarray += 4;
+                l += 2;
+            }
+            if(l < len) {
+                resarray[0] = larray[0] * rarray[0] - larray[1] * rarray[1];
+                resarray[1] = larray[0] * rarray[1] + larray[1] * rarray[0];
+            }
+            return MP_OBJ_FROM_PTR(results);
+        }
+        #endif
+
         ulab_rescale_float_strides(lstrides);
         ulab_rescale_float_strides(rstrides);
 
@@ -619,6 +771,28 @@ mp_obj_t carray_binary_subtract(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         mp_float_t *larray = (mp_float_t *)lhs->array;
         mp_float_t *rarray = (mp_float_t *)rhs->array;
 
+        #if ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+        if(ndarray_is_dense(lhs) && ndarray_is_dense(rhs) &&
+            (lhs->len == results->len) && (rhs->len == results->len)) {
+            // no broadcasting is taking place, and both operands are contiguous,
+            // so the interleaved buffers can be subtracted as flat float vectors
+            size_t n = 2 * results->len;
+            size_t l = 0;
+            while(l + 4 <= n) { // unrolled by two complex elements
+                resarray[l] = larray[l] - rarray[l];
+                resarray[l + 1] = larray[l + 1] - rarray[l + 1];
+                resarray[l + 2] = larray[l + 2] - rarray[l + 2];
+                resarray[l + 3] = larray[l + 3] - rarray[l + 3];
+                l += 4;
+            }
+            while(l < n) {
+                resarray[l] = larray[l] - rarray[l];
+                l++;
+            }
+            return MP_OBJ_FROM_PTR(results);
+        }
+        #endif
+
         ulab_rescale_float_strides(lstrides);
         ulab_rescale_float_strides(rstrides);
 
@@ -823,4 +997,64 @@ mp_obj_t carray_binary_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     return MP_OBJ_FROM_PTR(results);
 }
 
+#if ULAB_NUMPY_HAS_CMAC
+//| def cmac(x: ulab.numpy.ndarray, h: ulab.numpy.ndarray, out: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     .. param: x
+//|       a dense complex ndarray
+//|     .. param: h
+//|       a dense complex ndarray of the same length
+//|     .. param: out
+//|       a dense complex ndarray of the same length, holding the accumulator
+//|
+//|     Multiply two complex arrays elementwise, and add the products to out
+//|     in a single fused pass, i.e., calculate out += x * h without an
+//|     intermediate array. Returns out."""
+//|     ...
+//|
+
+mp_obj_t carray_cmac(mp_obj_t _x, mp_obj_t _h, mp_obj_t _out) {
+    if(!mp_obj_is_type(_x, &ulab_ndarray_type) || !mp_obj_is_type(_h, &ulab_ndarray_type) ||
+        !mp_obj_is_type(_out, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("arguments must be ndarrays"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(_x);
+    ndarray_obj_t *h = MP_OBJ_TO_PTR(_h);
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(_out);
+    if((x->dtype != NDARRAY_COMPLEX) || (h->dtype != NDARRAY_COMPLEX) || (out->dtype != NDARRAY_COMPLEX)) {
+        mp_raise_TypeError(translate("arguments must be complex ndarrays"));
+    }
+    if(!ndarray_is_dense(x) || !ndarray_is_dense(h) || !ndarray_is_dense(out)) {
+        mp_raise_ValueError(translate("arguments must be dense ndarrays"));
+    }
+    if((x->len != out->len) || (h->len != out->len)) {
+        mp_raise_ValueError(translate("arguments must be of equal length"));
+    }
+
+    mp_float_t *xarray = (mp_float_t *)x->array;
+    mp_float_t *harray = (mp_float_t *)h->array;
+    mp_float_t *oarray = (mp_float_t *)out->array;
+
+    size_t len = out->len;
+    size_t l = 0;
+    while(l + 2 <= len) { // unrolled by two complex elements
+        oarray[0] += xarray[0] * harray[0] - xarray[1] * harray[1];
+        oarray[1] += xarray[0] * harray[1] + xarray[1] * harray[0];
+        oarray[2] += xarray[2] * harray[2] - xarray[3] * harray[3];
+        oarray[3] += xarray[2] * harray[3] + xarray[3] * harray[2];
+        oarray += 4;
+        xarray += 4;
+        harray += 4;
+        l += 2;
+    }
+    if(l < len) {
+        oarray[0] += xarray[0] * harray[0] - xarray[1] * harray[1];
+        oarray[1] += xarray[0] * harray[1] + xarray[1] * harray[0];
+    }
+    return _out;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_3(carray_cmac_obj, carray_cmac);
+#endif
+
 #endif
@@ -139,11 +139,40 @@ static mp_obj_t compare_equal_helper(mp_obj_t x1, mp_obj_t x2, uint8_t comptype)
 
 #if ULAB_NUMPY_HAS_CLIP
 
-mp_obj_t compare_clip(mp_obj_t x1, mp_obj_t x2, mp_obj_t x3) {
+// bounded update with a branchless min/max pair; the bounds are expected
+// to have been clamped into the dtype's range beforehand
+#define CLIP_SCALAR_LOOP(type, sarray, oarray, lo, hi, len)\
+do {\
+    type *_s = (type *)(sarray);\
+    type *_o = (type *)(oarray);\
+    type _lo = (type)(lo);\
+    type _hi = (type)(hi);\
+    for(size_t _i = 0; _i < (len); _i++) {\
+        type _v = _s[_i];\
+        _v = _v < _lo ? _lo : _v;\
+        _o[_i] = _v > _hi ? _hi : _v;\
+    }\
+} while(0)
+
+mp_obj_t compare_clip(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     // Note: this function could be made faster by implementing a single-loop comparison in
     // RUN_COMPARE_LOOP. However, that would add around 2 kB of compile size, while we
     // would not gain a factor of two in speed, since the two comparisons should still be
     // evaluated. In contrast, calling the function twice adds only 140 bytes to the firmware
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t x1 = args[0].u_obj;
+    mp_obj_t x2 = args[1].u_obj;
+    mp_obj_t x3 = args[2].u_obj;
+
     if(mp_obj_is_int(x1) || mp_obj_is_float(x1)) {
         mp_float_t v1 = mp_obj_get_float(x1);
         mp_float_t v2 = mp_obj_get_float(x2);
@@ -155,12 +184,61 @@ mp_obj_t compare_clip(mp_obj_t x1, mp_obj_t x2, mp_obj_t x3) {
         } else {
             return x1;
         }
-    } else { // assume ndarrays
-        return compare_function(x2, compare_function(x1, x3, COMPARE_MINIMUM), COMPARE_MAXIMUM);
     }
+
+    // scalar-bound specialization: a dense array clipped between two
+    // scalars needs no broadcasting at all, the items can be pinned with a
+    // branchless min/max pair; out=a updates the array in place, without
+    // touching the heap. The path is entered only when the caller supplies
+    // a buffer of the input's dtype, so that the default path keeps its
+    // upcasting behavior
+    if((args[3].u_obj != mp_const_none) &&
+        mp_obj_is_type(x1, &ulab_ndarray_type) &&
+        mp_obj_is_type(args[3].u_obj, &ulab_ndarray_type) &&
+        (mp_obj_is_int(x2) || mp_obj_is_float(x2)) &&
+        (mp_obj_is_int(x3) || mp_obj_is_float(x3))) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(x1);
+        ndarray_obj_t *buffer = MP_OBJ_TO_PTR(args[3].u_obj);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            NOT_IMPLEMENTED_FOR_COMPLEX()
+        }
+        #endif
+        if((buffer->dtype == ndarray->dtype) && ndarray_is_dense(ndarray)) {
+            ndarray_obj_t *out = tools_validate_out(args[3].u_obj, ndarray->ndim, ndarray->shape, ndarray->dtype);
+            mp_float_t lo = mp_obj_get_float(x2);
+            mp_float_t hi = mp_obj_get_float(x3);
+            // pin the bounds to the dtype's range, so that the cast in the
+            // loop cannot wrap; in-range items are unaffected by this
+            if(ndarray->dtype == NDARRAY_UINT8) {
+                CLIP_SCALAR_LOOP(uint8_t, ndarray->array, out->array, MAX(lo, MICROPY_FLOAT_CONST(0.0)), MIN(hi, MICROPY_FLOAT_CONST(255.0)), ndarray->len);
+            } else if(ndarray->dtype == NDARRAY_INT8) {
+                CLIP_SCALAR_LOOP(int8_t, ndarray->array, out->array, MAX(lo, MICROPY_FLOAT_CONST(-128.0)), MIN(hi, MICROPY_FLOAT_CONST(127.0)), ndarray->len);
+            } else if(ndarray->dtype == NDARRAY_UINT16) {
+                CLIP_SCALAR_LOOP(uint16_t, ndarray->array, out->array, MAX(lo, MICROPY_FLOAT_CONST(0.0)), MIN(hi, MICROPY_FLOAT_CONST(65535.0)), ndarray->len);
+            } else if(ndarray->dtype == NDARRAY_INT16) {
+                CLIP_SCALAR_LOOP(int16_t, ndarray->array, out->array, MAX(lo, MICROPY_FLOAT_CONST(-32768.0)), MIN(hi, MICROPY_FLOAT_CONST(32767.0)), ndarray->len);
+            } else {
+                CLIP_SCALAR_LOOP(mp_float_t, ndarray->array, out->array, lo, hi, ndarray->len);
+            }
+            return MP_OBJ_FROM_PTR(out);
+        }
+    }
+
+    // assume ndarrays
+    mp_obj_t result = compare_function(x2, compare_function(x1, x3, COMPARE_MINIMUM), COMPARE_MAXIMUM);
+    if(args[3].u_obj != mp_const_none) {
+        // the generic path allocates in compare_function anyway, but the
+        // caller's buffer is still honored
+        ndarray_obj_t *source = MP_OBJ_TO_PTR(result);
+        ndarray_obj_t *out = tools_validate_out(args[3].u_obj, source->ndim, source->shape, source->dtype);
+        memcpy(out->array, source->array, source->len * source->itemsize);
+        return MP_OBJ_FROM_PTR(out);
+    }
+    return result;
 }
 
-MP_DEFINE_CONST_FUN_OBJ_3(compare_clip_obj, compare_clip);
+MP_DEFINE_CONST_FUN_OBJ_KW(compare_clip_obj, 3, compare_clip);
 #endif
 
 #if ULAB_NUMPY_HAS_EQUAL
@@ -314,11 +392,35 @@ MP_DEFINE_CONST_FUN_OBJ_2(compare_minimum_obj, compare_minimum);
 
 #if ULAB_NUMPY_HAS_WHERE
 
-mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
+// branchless select for the integer dtypes: the condition byte is turned
+// into an all-ones/all-zeros mask, so the loop carries no data-dependent
+// branch
+#define WHERE_SELECT_LOOP(type, carray, xarray, yarray, oarray, len)\
+do {\
+    type *_x = (type *)(xarray);\
+    type *_y = (type *)(yarray);\
+    type *_o = (type *)(oarray);\
+    for(size_t _i = 0; _i < (len); _i++) {\
+        type _mask = (type)(-(type)((carray)[_i] != 0));\
+        _o[_i] = (type)((_x[_i] & _mask) | (_y[_i] & ~_mask));\
+    }\
+} while(0)
+
+mp_obj_t compare_where(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     // this implementation will work with ndarrays, and scalars only
-    ndarray_obj_t *c = ndarray_from_mp_obj(_condition, 0);
-    ndarray_obj_t *x = ndarray_from_mp_obj(_x, 0);
-    ndarray_obj_t *y = ndarray_from_mp_obj(_y, 0);
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *c = ndarray_from_mp_obj(args[0].u_obj, 0);
+    ndarray_obj_t *x = ndarray_from_mp_obj(args[1].u_obj, 0);
+    ndarray_obj_t *y = ndarray_from_mp_obj(args[2].u_obj, 0);
 
     COMPLEX_DTYPE_NOT_IMPLEMENTED(c->dtype)
     COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
@@ -351,7 +453,29 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
     }
 
     uint8_t out_dtype = ndarray_upcast_dtype(x->dtype, y->dtype);
-    ndarray_obj_t *out = ndarray_new_dense_ndarray(ndim, oshape, out_dtype);
+    ndarray_obj_t *out = tools_validate_out(args[3].u_obj, ndim, oshape, out_dtype);
+
+    // typed fast path: when nothing is broadcast and all operands are
+    // dense and of a common dtype, cond/x/y can be read linearly, and the
+    // integer dtypes can be selected without a data-dependent branch
+    if((x->dtype == y->dtype) && (c->itemsize == 1) &&
+        ndarray_is_dense(c) && ndarray_is_dense(x) && ndarray_is_dense(y) &&
+        (c->len == out->len) && (x->len == out->len) && (y->len == out->len)) {
+        uint8_t *ca = (uint8_t *)c->array;
+        if(out_dtype == NDARRAY_FLOAT) {
+            mp_float_t *xa = (mp_float_t *)x->array;
+            mp_float_t *ya = (mp_float_t *)y->array;
+            mp_float_t *oa = (mp_float_t *)out->array;
+            for(size_t idx = 0; idx < out->len; idx++) {
+                oa[idx] = ca[idx] != 0 ? xa[idx] : ya[idx];
+            }
+        } else if((out_dtype == NDARRAY_UINT8) || (out_dtype == NDARRAY_INT8)) {
+            WHERE_SELECT_LOOP(uint8_t, ca, x->array, y->array, out->array, out->len);
+        } else { // NDARRAY_UINT16, NDARRAY_INT16
+            WHERE_SELECT_LOOP(uint16_t, ca, x->array, y->array, out->array, out->len);
+        }
+        return MP_OBJ_FROM_PTR(out);
+    }
 
     mp_float_t (*cfunc)(void *) = ndarray_get_float_function(c->dtype);
     mp_float_t (*xfunc)(void *) = ndarray_get_float_function(x->dtype);
@@ -424,5 +548,5 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
     return MP_OBJ_FROM_PTR(out);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_3(compare_where_obj, compare_where);
+MP_DEFINE_CONST_FUN_OBJ_KW(compare_where_obj, 3, compare_where);
 #endif
@@ -220,33 +220,16 @@ mp_obj_t create_asarray(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 MP_DEFINE_CONST_FUN_OBJ_KW(create_asarray_obj, 1, create_asarray);
 #endif
 
-#if ULAB_NUMPY_HAS_CONCATENATE
-//| def concatenate(arrays: Tuple[ulab.numpy.ndarray], *, axis: int = 0) -> ulab.numpy.ndarray:
-//|     """
-//|     .. param: arrays
-//|       tuple of ndarrays
-//|     .. param: axis
-//|       axis along which the arrays will be joined
-//|
-//|     Join a sequence of arrays along an existing axis."""
-//|     ...
-//|
-
-mp_obj_t create_concatenate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 0 } },
-    };
-
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-
-    if(!mp_obj_is_type(args[0].u_obj, &mp_type_tuple)) {
+#if ULAB_NUMPY_HAS_CONCATENATE || ULAB_NUMPY_HAS_VSTACK || ULAB_NUMPY_HAS_HSTACK
+static mp_obj_t create_concatenate_core(mp_obj_t arrays, int8_t axis) {
+    // joins a tuple of arrays along the given axis: the final shape is
+    // computed up front, the target is allocated once, and each source is
+    // copied a single time
+    if(!mp_obj_is_type(arrays, &mp_type_tuple)) {
         mp_raise_TypeError(translate("first argument must be a tuple of ndarrays"));
     }
-    int8_t axis = (int8_t)args[1].u_int;
     size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-    mp_obj_tuple_t *ndarrays = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_obj_tuple_t *ndarrays = MP_OBJ_TO_PTR(arrays);
 
     // first check, whether the arrays are compatible
     ndarray_obj_t *_ndarray = MP_OBJ_TO_PTR(ndarrays->items[0]);
@@ -303,13 +286,21 @@ mp_obj_t create_concatenate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
                 size_t k = 0;
                 do {
                 #endif
-                    size_t l = 0;
-                    do {
-                        memcpy(tarray, sarray, source->itemsize);
-                        tarray += target->strides[ULAB_MAX_DIMS - 1];
-                        sarray += source->strides[ULAB_MAX_DIMS - 1];
-                        l++;
-                    } while(l < source->shape[ULAB_MAX_DIMS - 1]);
+                    if(source->strides[ULAB_MAX_DIMS - 1] == (int32_t)source->itemsize) {
+                        // the row is contiguous in the source, and always
+                        // in the dense target, so it can be copied in one go
+                        memcpy(tarray, sarray, source->shape[ULAB_MAX_DIMS - 1] * source->itemsize);
+                        tarray += target->strides[ULAB_MAX_DIMS - 1] * source->shape[ULAB_MAX_DIMS - 1];
+                        sarray += source->strides[ULAB_MAX_DIMS - 1] * source->shape[ULAB_MAX_DIMS - 1];
+                    } else {
+                        size_t l = 0;
+                        do {
+                            memcpy(tarray, sarray, source->itemsize);
+                            tarray += target->strides[ULAB_MAX_DIMS - 1];
+                            sarray += source->strides[ULAB_MAX_DIMS - 1];
+                            l++;
+                        } while(l < source->shape[ULAB_MAX_DIMS - 1]);
+                    }
                 #if ULAB_MAX_DIMS > 1
                     tarray -= target->strides[ULAB_MAX_DIMS - 1] * source->shape[ULAB_MAX_DIMS-1];
                     tarray += target->strides[ULAB_MAX_DIMS - 2];
@@ -340,10 +331,109 @@ mp_obj_t create_concatenate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     }
     return MP_OBJ_FROM_PTR(target);
 }
+#endif /* ULAB_NUMPY_HAS_CONCATENATE || ULAB_NUMPY_HAS_VSTACK || ULAB_NUMPY_HAS_HSTACK */
+
+#if ULAB_NUMPY_HAS_CONCATENATE
+//| def concatenate(arrays: Tuple[ulab.numpy.ndarray], *, axis: int = 0) -> ulab.numpy.ndarray:
+//|     """
+//|     .. param: arrays
+//|       tuple of ndarrays
+//|     .. param: axis
+//|       axis along which the arrays will be joined
+//|
+//|     Join a sequence of arrays along an existing axis."""
+//|     ...
+//|
+
+mp_obj_t create_concatenate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 0 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return create_concatenate_core(args[0].u_obj, (int8_t)args[1].u_int);
+}
 
 MP_DEFINE_CONST_FUN_OBJ_KW(create_concatenate_obj, 1, create_concatenate);
 #endif
 
+#if ULAB_NUMPY_HAS_VSTACK & (ULAB_MAX_DIMS > 1)
+//| def vstack(arrays: Tuple[ulab.numpy.ndarray]) -> ulab.numpy.ndarray:
+//|     """
+//|     .. param: arrays
+//|       tuple of ndarrays
+//|
+//|     Stack arrays in sequence vertically (row wise); 1D arrays are treated as rows."""
+//|     ...
+//|
+
+mp_obj_t create_vstack(mp_obj_t arrays) {
+    if(!mp_obj_is_type(arrays, &mp_type_tuple)) {
+        mp_raise_TypeError(translate("first argument must be a tuple of ndarrays"));
+    }
+    mp_obj_tuple_t *ndarrays = MP_OBJ_TO_PTR(arrays);
+
+    bool promote = false;
+    for(size_t i = 0; i < ndarrays->len; i++) {
+        ndarray_obj_t *source = MP_OBJ_TO_PTR(ndarrays->items[i]);
+        if(source->ndim == 1) {
+            promote = true;
+            break;
+        }
+    }
+    if(promote) {
+        // replace 1D arrays by single-row 2D views, so that the concatenate
+        // core can join everything along the vertical axis without copying
+        // the inputs first
+        mp_obj_t *items = m_new(mp_obj_t, ndarrays->len);
+        for(size_t i = 0; i < ndarrays->len; i++) {
+            ndarray_obj_t *source = MP_OBJ_TO_PTR(ndarrays->items[i]);
+            if(source->ndim == 1) {
+                size_t shape[ULAB_MAX_DIMS] = { 0 };
+                int32_t strides[ULAB_MAX_DIMS] = { 0 };
+                shape[ULAB_MAX_DIMS - 1] = source->shape[ULAB_MAX_DIMS - 1];
+                shape[ULAB_MAX_DIMS - 2] = 1;
+                strides[ULAB_MAX_DIMS - 1] = source->strides[ULAB_MAX_DIMS - 1];
+                strides[ULAB_MAX_DIMS - 2] = (int32_t)source->shape[ULAB_MAX_DIMS - 1] * source->strides[ULAB_MAX_DIMS - 1];
+                items[i] = MP_OBJ_FROM_PTR(ndarray_new_view(source, 2, shape, strides, 0));
+            } else {
+                items[i] = ndarrays->items[i];
+            }
+        }
+        arrays = mp_obj_new_tuple(ndarrays->len, items);
+        m_del(mp_obj_t, items, ndarrays->len);
+    }
+    return create_concatenate_core(arrays, 0);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(create_vstack_obj, create_vstack);
+#endif
+
+#if ULAB_NUMPY_HAS_HSTACK
+//| def hstack(arrays: Tuple[ulab.numpy.ndarray]) -> ulab.numpy.ndarray:
+//|     """
+//|     .. param: arrays
+//|       tuple of ndarrays
+//|
+//|     Stack arrays in sequence horizontally (column wise); 1D arrays are joined end to end."""
+//|     ...
+//|
+
+mp_obj_t create_hstack(mp_obj_t arrays) {
+    if(!mp_obj_is_type(arrays, &mp_type_tuple)) {
+        mp_raise_TypeError(translate("first argument must be a tuple of ndarrays"));
+    }
+    mp_obj_tuple_t *ndarrays = MP_OBJ_TO_PTR(arrays);
+    ndarray_obj_t *first = MP_OBJ_TO_PTR(ndarrays->items[0]);
+    return create_concatenate_core(arrays, first->ndim == 1 ? 0 : 1);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(create_hstack_obj, create_hstack);
+#endif
+
 #if ULAB_MAX_DIMS > 1
 #if ULAB_NUMPY_HAS_DIAG
 //| def diag(a: ulab.numpy.ndarray, *, k: int = 0) -> ulab.numpy.ndarray:
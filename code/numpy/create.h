@@ -30,6 +30,16 @@ mp_obj_t create_concatenate(size_t , const mp_obj_t *, mp_map_t *);
 MP_DECLARE_CONST_FUN_OBJ_KW(create_concatenate_obj);
 #endif
 
+#if ULAB_NUMPY_HAS_VSTACK & (ULAB_MAX_DIMS > 1)
+mp_obj_t create_vstack(mp_obj_t );
+MP_DECLARE_CONST_FUN_OBJ_1(create_vstack_obj);
+#endif
+
+#if ULAB_NUMPY_HAS_HSTACK
+mp_obj_t create_hstack(mp_obj_t );
+MP_DECLARE_CONST_FUN_OBJ_1(create_hstack_obj);
+#endif
+
 #if ULAB_NUMPY_HAS_DIAG
 mp_obj_t create_diag(size_t , const mp_obj_t *, mp_map_t *);
 MP_DECLARE_CONST_FUN_OBJ_KW(create_diag_obj);
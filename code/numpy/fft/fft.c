@@ -31,8 +31,8 @@
 
 //| def fft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
 //|     """
-//|     :param ulab.numpy.ndarray r: A 1-dimension array of values whose size is a power of 2
-//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of values
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values, giving the complex part of the value
 //|     :return tuple (r, c): The real and complex parts of the FFT
 //|
 //|     Perform a Fast Fourier Transform from the time domain into the frequency domain
@@ -61,8 +61,8 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_fft_obj, 1, 2, fft_fft);
 
 //| def ifft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
 //|     """
-//|     :param ulab.numpy.ndarray r: A 1-dimension array of values whose size is a power of 2
-//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of values
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values, giving the complex part of the value
 //|     :return tuple (r, c): The real and complex parts of the inverse FFT
 //|
 //|     Perform an Inverse Fast Fourier Transform from the frequeny domain into the time domain"""
@@ -88,10 +88,72 @@ static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj, 1, 2, fft_ifft);
 #endif
 
+//| def rfft(r: ulab.numpy.ndarray) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of real values whose size is a power of 2
+//|     :return tuple (r, c): The real and complex parts of the n/2 + 1 unique bins of the FFT
+//|
+//|     Perform a Fast Fourier Transform of a real signal; the conjugate
+//|     symmetry of the spectrum is exploited, so only half the points are
+//|     transformed, and only the unique half of the spectrum is returned."""
+//|     ...
+//|
+
+#if ULAB_FFT_HAS_RFFT
+#if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+static mp_obj_t fft_rfft(mp_obj_t arg) {
+    return fft_rfft_irfft(arg, FFT_RFFT);
+}
+#else
+static mp_obj_t fft_rfft(mp_obj_t arg) {
+    return fft_rfft_irfft(1, arg, mp_const_none, FFT_RFFT);
+}
+#endif
+
+MP_DEFINE_CONST_FUN_OBJ_1(fft_rfft_obj, fft_rfft);
+#endif /* ULAB_FFT_HAS_RFFT */
+
+//| def irfft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ulab.numpy.ndarray r: The real part of a half-spectrum of n/2 + 1 bins
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array, giving the complex part of the half-spectrum
+//|     :return ulab.numpy.ndarray: The real signal of length n
+//|
+//|     Perform an Inverse Fast Fourier Transform of a half-spectrum, as
+//|     returned by `rfft`; the output is the real signal itself."""
+//|     ...
+//|
+
+#if ULAB_FFT_HAS_IRFFT
+#if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+static mp_obj_t fft_irfft(mp_obj_t arg) {
+    return fft_rfft_irfft(arg, FFT_IRFFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(fft_irfft_obj, fft_irfft);
+#else
+static mp_obj_t fft_irfft(size_t n_args, const mp_obj_t *args) {
+    if(n_args == 2) {
+        return fft_rfft_irfft(n_args, args[0], args[1], FFT_IRFFT);
+    } else {
+        return fft_rfft_irfft(n_args, args[0], mp_const_none, FFT_IRFFT);
+    }
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_irfft_obj, 1, 2, fft_irfft);
+#endif
+#endif /* ULAB_FFT_HAS_IRFFT */
+
 STATIC const mp_rom_map_elem_t ulab_fft_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fft) },
     { MP_ROM_QSTR(MP_QSTR_fft), MP_ROM_PTR(&fft_fft_obj) },
     { MP_ROM_QSTR(MP_QSTR_ifft), MP_ROM_PTR(&fft_ifft_obj) },
+    #if ULAB_FFT_HAS_IRFFT
+    { MP_ROM_QSTR(MP_QSTR_irfft), MP_ROM_PTR(&fft_irfft_obj) },
+    #endif
+    #if ULAB_FFT_HAS_RFFT
+    { MP_ROM_QSTR(MP_QSTR_rfft), MP_ROM_PTR(&fft_rfft_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ulab_fft_globals, ulab_fft_globals_table);
@@ -22,9 +22,12 @@ extern const mp_obj_module_t ulab_fft_module;
 #if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
 MP_DECLARE_CONST_FUN_OBJ_3(fft_fft_obj);
 MP_DECLARE_CONST_FUN_OBJ_3(fft_ifft_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(fft_irfft_obj);
 #else
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fft_fft_obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj);
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fft_irfft_obj);
 #endif
+MP_DECLARE_CONST_FUN_OBJ_1(fft_rfft_obj);
 
 #endif
@@ -24,6 +24,26 @@
 #define MP_E MICROPY_FLOAT_CONST(2.71828182845904523536)
 #endif
 
+#if ULAB_FFT_USES_TWIDDLE_CACHE
+static mp_float_t fft_twiddle_cache[ULAB_FFT_TWIDDLE_CACHE_LENGTH];
+static size_t fft_twiddle_cache_n = 0;
+
+// fills the cache with exp(-2 pi i k / n) for k < n/2; the cache is keyed
+// by a single length, so mixed workloads refill it, but repeated
+// transforms of one fixed block size compute their factors only once
+static void fft_fill_twiddle_cache(size_t n) {
+    if(fft_twiddle_cache_n == n) {
+        return;
+    }
+    mp_float_t theta = MICROPY_FLOAT_CONST(-2.0) * MP_PI / n;
+    for(size_t k = 0; k < n / 2; k++) {
+        fft_twiddle_cache[2*k] = MICROPY_FLOAT_C_FUN(cos)(theta * k);
+        fft_twiddle_cache[2*k+1] = MICROPY_FLOAT_C_FUN(sin)(theta * k);
+    }
+    fft_twiddle_cache_n = n;
+}
+#endif /* ULAB_FFT_USES_TWIDDLE_CACHE */
+
 /* Kernel implementation for the case, when ulab has no complex support
 
  * The following function takes two arrays, namely, the real and imaginary
@@ -64,16 +84,39 @@ void fft_kernel_complex(mp_float_t *data, size_t n, int isign) {
         j += m;
     }
 
+    #if ULAB_FFT_USES_TWIDDLE_CACHE
+    uint8_t cached = n <= (size_t)ULAB_FFT_TWIDDLE_CACHE_LENGTH ? 1 : 0;
+    if(cached) {
+        fft_fill_twiddle_cache(n);
+    }
+    #endif
+
     mmax = 1;
     while (n > mmax) {
         istep = mmax << 1;
+        #if ULAB_FFT_USES_TWIDDLE_CACHE
+        size_t kstep = n / istep;
+        if(!cached) {
+        #endif
         theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
         wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
         wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
         wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        #if ULAB_FFT_USES_TWIDDLE_CACHE
+        }
+        #endif
         wr = MICROPY_FLOAT_CONST(1.0);
         wi = MICROPY_FLOAT_CONST(0.0);
         for(m = 0; m < mmax; m++) {
+            #if ULAB_FFT_USES_TWIDDLE_CACHE
+            if(cached) {
+                wr = fft_twiddle_cache[2 * m * kstep];
+                wi = fft_twiddle_cache[2 * m * kstep + 1];
+                if(isign < 0) {
+                    wi = -wi;
+                }
+            }
+            #endif
             for(size_t i = m; i < n; i += istep) {
                 j = i + mmax;
                 tempr = wr * data[2*j] - wi * data[2*j+1];
@@ -83,14 +126,93 @@ void fft_kernel_complex(mp_float_t *data, size_t n, int isign) {
                 data[2*i] += tempr;
                 data[2*i+1] += tempi;
             }
-            wtemp = wr;
-            wr = wr*wpr - wi*wpi + wr;
-            wi = wi*wpr + wtemp*wpi + wi;
+            #if ULAB_FFT_USES_TWIDDLE_CACHE
+            if(!cached)
+            #endif
+            {
+                wtemp = wr;
+                wr = wr*wpr - wi*wpi + wr;
+                wi = wi*wpr + wtemp*wpi + wi;
+            }
         }
         mmax = istep;
     }
 }
 
+#if ULAB_FFT_USES_BLUESTEIN
+/*
+ * Bluestein's (chirp-z) algorithm for lengths that are not powers of two:
+ * with the chirp c[k] = exp(-isign i pi k^2 / n), the transform can be
+ * written as X[k] = c[k] * (a (*) b)[k], where a[j] = x[j] c[j] and
+ * b[j] = conj(c[j]), so a single circular convolution of power-of-two
+ * length m >= 2n - 1, evaluated with the ordinary kernel, yields the
+ * transform of the natural length n.
+ */
+static void fft_kernel_bluestein_complex(mp_float_t *data, size_t n, int isign) {
+    size_t m = 1;
+    while(m < 2 * n - 1) {
+        m <<= 1;
+    }
+    SCRATCH_ACQUIRE();
+    mp_float_t *chirp = SCRATCH_NEW(mp_float_t, 2 * n);
+    mp_float_t *a = SCRATCH_NEW(mp_float_t, 2 * m);
+    mp_float_t *b = SCRATCH_NEW(mp_float_t, 2 * m);
+
+    mp_float_t theta = MICROPY_FLOAT_CONST(-1.0) * isign * MP_PI / n;
+    // q = k^2 mod 2n, updated incrementally, so that the arguments of the
+    // trigonometric functions stay small even for long transforms
+    size_t q = 0;
+    for(size_t k = 0; k < n; k++) {
+        mp_float_t cr = MICROPY_FLOAT_C_FUN(cos)(theta * q);
+        mp_float_t ci = MICROPY_FLOAT_C_FUN(sin)(theta * q);
+        chirp[2*k] = cr;
+        chirp[2*k+1] = ci;
+        a[2*k] = data[2*k] * cr - data[2*k+1] * ci;
+        a[2*k+1] = data[2*k] * ci + data[2*k+1] * cr;
+        // b is an even function of its index, so the negative indices of the
+        // convolution wrap around to the far end of the buffer
+        b[2*k] = cr;
+        b[2*k+1] = -ci;
+        if(k > 0) {
+            b[2*(m - k)] = cr;
+            b[2*(m - k) + 1] = -ci;
+        }
+        q += 2 * k + 1;
+        if(q >= 2 * n) {
+            q -= 2 * n;
+        }
+    }
+    // the padding of a and b is already in place: SCRATCH_NEW zeroes
+
+    fft_kernel_complex(a, m, 1);
+    fft_kernel_complex(b, m, 1);
+    for(size_t k = 0; k < m; k++) {
+        mp_float_t tempr = a[2*k] * b[2*k] - a[2*k+1] * b[2*k+1];
+        a[2*k+1] = a[2*k] * b[2*k+1] + a[2*k+1] * b[2*k];
+        a[2*k] = tempr;
+    }
+    fft_kernel_complex(a, m, -1);
+
+    for(size_t k = 0; k < n; k++) {
+        data[2*k] = (a[2*k] * chirp[2*k] - a[2*k+1] * chirp[2*k+1]) / m;
+        data[2*k+1] = (a[2*k] * chirp[2*k+1] + a[2*k+1] * chirp[2*k]) / m;
+    }
+    SCRATCH_RELEASE();
+}
+#endif /* ULAB_FFT_USES_BLUESTEIN */
+
+// runs the direct kernel for power-of-two lengths, and Bluestein's
+// algorithm for all others
+static void fft_run_complex(mp_float_t *data, size_t n, int isign) {
+    #if ULAB_FFT_USES_BLUESTEIN
+    if((n & (n - 1)) != 0) {
+        fft_kernel_bluestein_complex(data, n, isign);
+        return;
+    }
+    #endif
+    fft_kernel_complex(data, n, isign);
+}
+
 /*
  * The following function is a helper interface to the python side.
  * It has been factored out from fft.c, so that the same argument parsing
@@ -107,18 +229,29 @@ mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t data_in, uint8_t type) {
     }
     #endif
     size_t len = in->len;
+    #if !ULAB_FFT_USES_BLUESTEIN
     // Check if input is of length of power of 2
     if((len & (len-1)) != 0) {
         mp_raise_ValueError(translate("input array length must be power of 2"));
     }
+    #endif
 
-    ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_COMPLEX);
-    mp_float_t *data = (mp_float_t *)out->array;
+    SCRATCH_ACQUIRE();
+    ndarray_obj_t *out = NULL;
+    mp_float_t *data;
+    if(type == FFT_SPECTROGRAM) {
+        // the complex transform is only an intermediate result here,
+        // so keep it in the scratch pool, instead of a full ndarray
+        data = SCRATCH_NEW(mp_float_t, 2 * len);
+    } else {
+        out = ndarray_new_linear_array(len, NDARRAY_COMPLEX);
+        data = (mp_float_t *)out->array;
+    }
     uint8_t *array = (uint8_t *)in->array;
 
     if(in->dtype == NDARRAY_COMPLEX) {
         uint8_t sz = 2 * sizeof(mp_float_t);
-        uint8_t *data_ = (uint8_t *)out->array;
+        uint8_t *data_ = (uint8_t *)data;
         for(size_t i = 0; i < len; i++) {
             memcpy(data_, array, sz);
             array += in->strides[ULAB_MAX_DIMS - 1];
@@ -135,7 +268,7 @@ mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t data_in, uint8_t type) {
     data -= 2 * len;
 
     if((type == FFT_FFT) || (type == FFT_SPECTROGRAM)) {
-        fft_kernel_complex(data, len, 1);
+        fft_run_complex(data, len, 1);
         if(type == FFT_SPECTROGRAM) {
             ndarray_obj_t *spectrum = ndarray_new_linear_array(len, NDARRAY_FLOAT);
             mp_float_t *sarray = (mp_float_t *)spectrum->array;
@@ -143,18 +276,146 @@ mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t data_in, uint8_t type) {
                 *sarray++ = MICROPY_FLOAT_C_FUN(sqrt)(data[0] * data[0] + data[1] * data[1]);
                 data += 2;
             }
-            m_del(mp_float_t, data, 2 * len);
+            SCRATCH_RELEASE();
             return MP_OBJ_FROM_PTR(spectrum);
         }
     } else { // inverse transform
-        fft_kernel_complex(data, len, -1);
+        fft_run_complex(data, len, -1);
         // TODO: numpy accepts the norm keyword argument
         for(size_t i = 0; i < len; i++) {
             *data++ /= len;
         }
     }
+    SCRATCH_RELEASE();
     return MP_OBJ_FROM_PTR(out);
 }
+
+#if ULAB_FFT_HAS_RFFT | ULAB_FFT_HAS_IRFFT
+/*
+ * Transforms of real signals: a real sequence of length n is packed into a
+ * complex sequence of length n/2, which is transformed with the ordinary
+ * kernel, and the n/2 + 1 unique bins are then recovered from the conjugate
+ * symmetry of the spectrum, so the butterflies run on half the points.
+ * The inverse transform performs the same steps backwards.
+ */
+mp_obj_t fft_rfft_irfft(mp_obj_t data_in, uint8_t type) {
+    if(!mp_obj_is_type(data_in, &ulab_ndarray_type)) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *in = MP_OBJ_TO_PTR(data_in);
+    #if ULAB_MAX_DIMS > 1
+    if(in->ndim != 1) {
+        mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+    }
+    #endif
+
+    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+
+    if(type == FFT_RFFT) {
+        if(in->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("rfft is defined for real arrays"));
+        }
+        size_t len = in->len;
+        if((len < 2) || ((len & (len-1)) != 0)) {
+            mp_raise_ValueError(translate("input array length must be power of 2"));
+        }
+        size_t half = len >> 1;
+        ndarray_obj_t *out = ndarray_new_linear_array(half + 1, NDARRAY_COMPLEX);
+        mp_float_t *data = (mp_float_t *)out->array;
+        uint8_t *array = (uint8_t *)in->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(in->dtype);
+        // the even samples become the real, the odd samples the imaginary
+        // part of the half-length complex sequence
+        for(size_t i = 0; i < len; i++) {
+            data[i] = func(array);
+            array += in->strides[ULAB_MAX_DIMS - 1];
+        }
+        fft_kernel_complex(data, half, 1);
+        // unpack the unique bins in place
+        mp_float_t z0r = data[0];
+        mp_float_t z0i = data[1];
+        data[0] = z0r + z0i;
+        data[1] = MICROPY_FLOAT_CONST(0.0);
+        data[2*half] = z0r - z0i;
+        data[2*half+1] = MICROPY_FLOAT_CONST(0.0);
+        theta = -MP_PI/half;
+        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        wr = MICROPY_FLOAT_CONST(1.0);
+        wi = MICROPY_FLOAT_CONST(0.0);
+        for(size_t k = 1; k <= half/2; k++) {
+            wtemp = wr;
+            wr = wr*wpr - wi*wpi + wr;
+            wi = wi*wpr + wtemp*wpi + wi;
+            size_t j = half - k;
+            mp_float_t h1r = MICROPY_FLOAT_CONST(0.5) * (data[2*k] + data[2*j]);
+            mp_float_t h1i = MICROPY_FLOAT_CONST(0.5) * (data[2*k+1] - data[2*j+1]);
+            mp_float_t h2r = MICROPY_FLOAT_CONST(0.5) * (data[2*k+1] + data[2*j+1]);
+            mp_float_t h2i = MICROPY_FLOAT_CONST(-0.5) * (data[2*k] - data[2*j]);
+            mp_float_t tr = wr*h2r - wi*h2i;
+            mp_float_t ti = wr*h2i + wi*h2r;
+            data[2*k] = h1r + tr;
+            data[2*k+1] = h1i + ti;
+            data[2*j] = h1r - tr;
+            data[2*j+1] = -h1i + ti;
+        }
+        return MP_OBJ_FROM_PTR(out);
+    }
+
+    // inverse transform of a half-spectrum of n/2 + 1 bins
+    size_t len = in->len;
+    size_t half = len - 1;
+    if((len < 2) || ((half & (half-1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be a power of 2 + 1"));
+    }
+    ndarray_obj_t *out = ndarray_new_linear_array(2 * half, NDARRAY_FLOAT);
+    mp_float_t *data = (mp_float_t *)out->array;
+    uint8_t *array = (uint8_t *)in->array;
+    int32_t stride = in->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t (*func)(void *) = NULL;
+    if(in->dtype != NDARRAY_COMPLEX) {
+        func = ndarray_get_float_function(in->dtype);
+    }
+    theta = MP_PI/half;
+    wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+    wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+    wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+    wr = MICROPY_FLOAT_CONST(1.0);
+    wi = MICROPY_FLOAT_CONST(0.0);
+    for(size_t k = 0; k < half; k++) {
+        size_t j = half - k;
+        mp_float_t xkr, xki, xjr, xji;
+        if(in->dtype == NDARRAY_COMPLEX) {
+            mp_float_t *x = (mp_float_t *)(array + (int32_t)k * stride);
+            xkr = x[0];
+            xki = x[1];
+            x = (mp_float_t *)(array + (int32_t)j * stride);
+            xjr = x[0];
+            xji = x[1];
+        } else {
+            xkr = func(array + (int32_t)k * stride);
+            xki = MICROPY_FLOAT_CONST(0.0);
+            xjr = func(array + (int32_t)j * stride);
+            xji = MICROPY_FLOAT_CONST(0.0);
+        }
+        mp_float_t h1r = MICROPY_FLOAT_CONST(0.5) * (xkr + xjr);
+        mp_float_t h1i = MICROPY_FLOAT_CONST(0.5) * (xki - xji);
+        mp_float_t h2r = MICROPY_FLOAT_CONST(-0.5) * (xki + xji);
+        mp_float_t h2i = MICROPY_FLOAT_CONST(0.5) * (xkr - xjr);
+        data[2*k] = h1r + wr*h2r - wi*h2i;
+        data[2*k+1] = h1i + wr*h2i + wi*h2r;
+        wtemp = wr;
+        wr = wr*wpr - wi*wpi + wr;
+        wi = wi*wpr + wtemp*wpi + wi;
+    }
+    fft_kernel_complex(data, half, -1);
+    for(size_t i = 0; i < 2*half; i++) {
+        data[i] /= half;
+    }
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif /* ULAB_FFT_HAS_RFFT | ULAB_FFT_HAS_IRFFT */
 #else /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
 void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
     size_t j, m, mmax, istep;
@@ -175,16 +436,39 @@ void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
         j += m;
     }
 
+    #if ULAB_FFT_USES_TWIDDLE_CACHE
+    uint8_t cached = n <= (size_t)ULAB_FFT_TWIDDLE_CACHE_LENGTH ? 1 : 0;
+    if(cached) {
+        fft_fill_twiddle_cache(n);
+    }
+    #endif
+
     mmax = 1;
     while (n > mmax) {
         istep = mmax << 1;
+        #if ULAB_FFT_USES_TWIDDLE_CACHE
+        size_t kstep = n / istep;
+        if(!cached) {
+        #endif
         theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
         wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
         wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
         wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        #if ULAB_FFT_USES_TWIDDLE_CACHE
+        }
+        #endif
         wr = MICROPY_FLOAT_CONST(1.0);
         wi = MICROPY_FLOAT_CONST(0.0);
         for(m = 0; m < mmax; m++) {
+            #if ULAB_FFT_USES_TWIDDLE_CACHE
+            if(cached) {
+                wr = fft_twiddle_cache[2 * m * kstep];
+                wi = fft_twiddle_cache[2 * m * kstep + 1];
+                if(isign < 0) {
+                    wi = -wi;
+                }
+            }
+            #endif
             for(size_t i = m; i < n; i += istep) {
                 j = i + mmax;
                 tempr = wr * real[j] - wi * imag[j];
@@ -194,14 +478,241 @@ void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
                 real[i] += tempr;
                 imag[i] += tempi;
             }
+            #if ULAB_FFT_USES_TWIDDLE_CACHE
+            if(!cached)
+            #endif
+            {
+                wtemp = wr;
+                wr = wr*wpr - wi*wpi + wr;
+                wi = wi*wpr + wtemp*wpi + wi;
+            }
+        }
+        mmax = istep;
+    }
+}
+
+#if ULAB_FFT_USES_BLUESTEIN
+/*
+ * Bluestein's (chirp-z) algorithm for lengths that are not powers of two:
+ * with the chirp c[k] = exp(-isign i pi k^2 / n), the transform can be
+ * written as X[k] = c[k] * (a (*) b)[k], where a[j] = x[j] c[j] and
+ * b[j] = conj(c[j]), so a single circular convolution of power-of-two
+ * length m >= 2n - 1, evaluated with the ordinary kernel, yields the
+ * transform of the natural length n.
+ */
+static void fft_kernel_bluestein(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
+    size_t m = 1;
+    while(m < 2 * n - 1) {
+        m <<= 1;
+    }
+    SCRATCH_ACQUIRE();
+    mp_float_t *chirp_re = SCRATCH_NEW(mp_float_t, n);
+    mp_float_t *chirp_im = SCRATCH_NEW(mp_float_t, n);
+    mp_float_t *a_re = SCRATCH_NEW(mp_float_t, m);
+    mp_float_t *a_im = SCRATCH_NEW(mp_float_t, m);
+    mp_float_t *b_re = SCRATCH_NEW(mp_float_t, m);
+    mp_float_t *b_im = SCRATCH_NEW(mp_float_t, m);
+
+    mp_float_t theta = MICROPY_FLOAT_CONST(-1.0) * isign * MP_PI / n;
+    // q = k^2 mod 2n, updated incrementally, so that the arguments of the
+    // trigonometric functions stay small even for long transforms
+    size_t q = 0;
+    for(size_t k = 0; k < n; k++) {
+        mp_float_t cr = MICROPY_FLOAT_C_FUN(cos)(theta * q);
+        mp_float_t ci = MICROPY_FLOAT_C_FUN(sin)(theta * q);
+        chirp_re[k] = cr;
+        chirp_im[k] = ci;
+        a_re[k] = real[k] * cr - imag[k] * ci;
+        a_im[k] = real[k] * ci + imag[k] * cr;
+        // b is an even function of its index, so the negative indices of the
+        // convolution wrap around to the far end of the buffer
+        b_re[k] = cr;
+        b_im[k] = -ci;
+        if(k > 0) {
+            b_re[m - k] = cr;
+            b_im[m - k] = -ci;
+        }
+        q += 2 * k + 1;
+        if(q >= 2 * n) {
+            q -= 2 * n;
+        }
+    }
+    // the padding of a and b is already in place: SCRATCH_NEW zeroes
+
+    fft_kernel(a_re, a_im, m, 1);
+    fft_kernel(b_re, b_im, m, 1);
+    for(size_t k = 0; k < m; k++) {
+        mp_float_t tempr = a_re[k] * b_re[k] - a_im[k] * b_im[k];
+        a_im[k] = a_re[k] * b_im[k] + a_im[k] * b_re[k];
+        a_re[k] = tempr;
+    }
+    fft_kernel(a_re, a_im, m, -1);
+
+    for(size_t k = 0; k < n; k++) {
+        real[k] = (a_re[k] * chirp_re[k] - a_im[k] * chirp_im[k]) / m;
+        imag[k] = (a_re[k] * chirp_im[k] + a_im[k] * chirp_re[k]) / m;
+    }
+    SCRATCH_RELEASE();
+}
+#endif /* ULAB_FFT_USES_BLUESTEIN */
+
+// runs the direct kernel for power-of-two lengths, and Bluestein's
+// algorithm for all others
+static void fft_run(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
+    #if ULAB_FFT_USES_BLUESTEIN
+    if((n & (n - 1)) != 0) {
+        fft_kernel_bluestein(real, imag, n, isign);
+        return;
+    }
+    #endif
+    fft_kernel(real, imag, n, isign);
+}
+
+#if ULAB_FFT_USES_Q15
+/*
+ * Q15 fixed-point kernel with block-floating-point scaling: before each
+ * stage, whenever a butterfly could overflow the int16 range, the whole
+ * block is scaled down by one bit, and the accumulated shift count is
+ * returned, so the caller can restore the magnitudes. The twiddle factors
+ * are carried in the float recurrence of the ordinary kernel, and
+ * quantised to Q15 once per butterfly group; the butterflies themselves,
+ * which dominate the cost, run in integer arithmetic only.
+ */
+static int fft_kernel_q15(int16_t *real, int16_t *imag, size_t n, int isign) {
+    size_t j, m, mmax, istep;
+    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+    int shifts = 0;
+
+    j = 0;
+    for(size_t i = 0; i < n; i++) {
+        if (j > i) {
+            SWAP(int16_t, real[i], real[j]);
+            SWAP(int16_t, imag[i], imag[j]);
+        }
+        m = n >> 1;
+        while (j >= m && m > 0) {
+            j -= m;
+            m >>= 1;
+        }
+        j += m;
+    }
+
+    mmax = 1;
+    while (n > mmax) {
+        istep = mmax << 1;
+        // a butterfly can double the magnitude at most, so scaling down by
+        // one bit, whenever a value reaches half the range, is sufficient
+        int32_t peak = 0;
+        for(size_t i = 0; i < n; i++) {
+            int32_t a = real[i] < 0 ? -(int32_t)real[i] : (int32_t)real[i];
+            int32_t b = imag[i] < 0 ? -(int32_t)imag[i] : (int32_t)imag[i];
+            if(a > peak) {
+                peak = a;
+            }
+            if(b > peak) {
+                peak = b;
+            }
+        }
+        if(peak >= 16384) {
+            for(size_t i = 0; i < n; i++) {
+                real[i] >>= 1;
+                imag[i] >>= 1;
+            }
+            shifts++;
+        }
+        theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
+        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        wr = MICROPY_FLOAT_CONST(1.0);
+        wi = MICROPY_FLOAT_CONST(0.0);
+        for(m = 0; m < mmax; m++) {
+            int32_t qwr = (int32_t)MICROPY_FLOAT_C_FUN(round)(wr * MICROPY_FLOAT_CONST(32767.0));
+            int32_t qwi = (int32_t)MICROPY_FLOAT_C_FUN(round)(wi * MICROPY_FLOAT_CONST(32767.0));
+            for(size_t i = m; i < n; i += istep) {
+                j = i + mmax;
+                int32_t tempr = (qwr * real[j] - qwi * imag[j] + 0x4000) >> 15;
+                int32_t tempi = (qwr * imag[j] + qwi * real[j] + 0x4000) >> 15;
+                real[j] = (int16_t)(real[i] - tempr);
+                imag[j] = (int16_t)(imag[i] - tempi);
+                real[i] = (int16_t)(real[i] + tempr);
+                imag[i] = (int16_t)(imag[i] + tempi);
+            }
             wtemp = wr;
             wr = wr*wpr - wi*wpi + wr;
             wi = wi*wpr + wtemp*wpi + wi;
         }
         mmax = istep;
     }
+    return shifts;
 }
 
+static mp_obj_t fft_fft_ifft_spectrogram_q15(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type) {
+    ndarray_obj_t *re = MP_OBJ_TO_PTR(arg_re);
+    size_t len = re->len;
+    ndarray_obj_t *im = NULL;
+    if(n_args == 2) {
+        im = MP_OBJ_TO_PTR(arg_im);
+        #if ULAB_MAX_DIMS > 1
+        if(im->ndim != 1) {
+            mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+        }
+        #endif
+        if(re->len != im->len) {
+            mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+        }
+    }
+
+    SCRATCH_ACQUIRE();
+    int16_t *qre = SCRATCH_NEW(int16_t, len);
+    int16_t *qim = SCRATCH_NEW(int16_t, len);
+
+    uint8_t *array = (uint8_t *)re->array;
+    for(size_t i = 0; i < len; i++) {
+        qre[i] = *(int16_t *)array;
+        array += re->strides[ULAB_MAX_DIMS - 1];
+    }
+    if(im != NULL) {
+        array = (uint8_t *)im->array;
+        for(size_t i = 0; i < len; i++) {
+            qim[i] = *(int16_t *)array;
+            array += im->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+
+    int shifts = fft_kernel_q15(qre, qim, len, type == FFT_IFFT ? -1 : 1);
+    mp_float_t scale = (mp_float_t)((uint32_t)1 << shifts);
+    if(type == FFT_IFFT) {
+        scale /= (mp_float_t)len;
+    }
+
+    if(type == FFT_SPECTROGRAM) {
+        ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        mp_float_t *oarray = (mp_float_t *)out->array;
+        for(size_t i = 0; i < len; i++) {
+            mp_float_t r = (mp_float_t)qre[i];
+            mp_float_t j = (mp_float_t)qim[i];
+            *oarray++ = MICROPY_FLOAT_C_FUN(sqrt)(r * r + j * j) * scale;
+        }
+        SCRATCH_RELEASE();
+        return MP_OBJ_FROM_PTR(out);
+    }
+    ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    ndarray_obj_t *out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    for(size_t i = 0; i < len; i++) {
+        *data_re++ = (mp_float_t)qre[i] * scale;
+        *data_im++ = (mp_float_t)qim[i] * scale;
+    }
+    SCRATCH_RELEASE();
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out_re);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
+}
+#endif /* ULAB_FFT_USES_Q15 */
+
 mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type) {
     if(!mp_obj_is_type(arg_re, &ulab_ndarray_type)) {
         mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
@@ -219,11 +730,23 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
     }
     #endif
     size_t len = re->len;
+    #if !ULAB_FFT_USES_BLUESTEIN
     // Check if input is of length of power of 2
     if((len & (len-1)) != 0) {
         mp_raise_ValueError(translate("input array length must be power of 2"));
     }
+    #endif
+
+    #if ULAB_FFT_USES_Q15
+    // int16 arrays of power-of-two length take the fixed-point kernel
+    if((re->dtype == NDARRAY_INT16) && (len > 1) && ((len & (len - 1)) == 0)) {
+        if((n_args == 1) || (((ndarray_obj_t *)MP_OBJ_TO_PTR(arg_im))->dtype == NDARRAY_INT16)) {
+            return fft_fft_ifft_spectrogram_q15(n_args, arg_re, arg_im, type);
+        }
+    }
+    #endif
 
+    SCRATCH_ACQUIRE();
     ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
     mp_float_t *data_re = (mp_float_t *)out_re->array;
 
@@ -235,18 +758,27 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
         array += re->strides[ULAB_MAX_DIMS - 1];
     }
     data_re -= len;
-    ndarray_obj_t *out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
-    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    ndarray_obj_t *out_im = NULL;
+    mp_float_t *data_im;
+    if(type == FFT_SPECTROGRAM) {
+        // the imaginary part is needed only while the spectrum is calculated
+        data_im = SCRATCH_NEW(mp_float_t, len);
+    } else {
+        out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        data_im = (mp_float_t *)out_im->array;
+    }
 
     if(n_args == 2) {
         ndarray_obj_t *im = MP_OBJ_TO_PTR(arg_im);
         #if ULAB_MAX_DIMS > 1
         if(im->ndim != 1) {
+            SCRATCH_RELEASE();
             COMPLEX_DTYPE_NOT_IMPLEMENTED(im->dtype)
             mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
         }
         #endif
         if (re->len != im->len) {
+            SCRATCH_RELEASE();
             mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
         }
         array = (uint8_t *)im->array;
@@ -259,7 +791,7 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
     }
 
     if((type == FFT_FFT) || (type == FFT_SPECTROGRAM)) {
-        fft_kernel(data_re, data_im, len, 1);
+        fft_run(data_re, data_im, len, 1);
         if(type == FFT_SPECTROGRAM) {
             for(size_t i=0; i < len; i++) {
                 *data_re = MICROPY_FLOAT_C_FUN(sqrt)(*data_re * *data_re + *data_im * *data_im);
@@ -268,13 +800,14 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
             }
         }
     } else { // inverse transform
-        fft_kernel(data_re, data_im, len, -1);
+        fft_run(data_re, data_im, len, -1);
         // TODO: numpy accepts the norm keyword argument
         for(size_t i=0; i < len; i++) {
             *data_re++ /= len;
             *data_im++ /= len;
         }
     }
+    SCRATCH_RELEASE();
     if(type == FFT_SPECTROGRAM) {
         return MP_OBJ_FROM_PTR(out_re);
     } else {
@@ -284,4 +817,161 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
         return mp_obj_new_tuple(2, tuple);
     }
 }
+
+#if ULAB_FFT_HAS_RFFT | ULAB_FFT_HAS_IRFFT
+/*
+ * Transforms of real signals: a real sequence of length n is packed into a
+ * complex sequence of length n/2, which is transformed with the ordinary
+ * kernel, and the n/2 + 1 unique bins are then recovered from the conjugate
+ * symmetry of the spectrum, so the butterflies run on half the points.
+ * The inverse transform performs the same steps backwards, and returns the
+ * real signal as a single array.
+ */
+mp_obj_t fft_rfft_irfft(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type) {
+    if(!mp_obj_is_type(arg_re, &ulab_ndarray_type)) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *re = MP_OBJ_TO_PTR(arg_re);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(re->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(re->ndim != 1) {
+        mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+    }
+    #endif
+
+    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+
+    if(type == FFT_RFFT) {
+        size_t len = re->len;
+        if((len < 2) || ((len & (len-1)) != 0)) {
+            mp_raise_ValueError(translate("input array length must be power of 2"));
+        }
+        size_t half = len >> 1;
+        ndarray_obj_t *out_re = ndarray_new_linear_array(half + 1, NDARRAY_FLOAT);
+        ndarray_obj_t *out_im = ndarray_new_linear_array(half + 1, NDARRAY_FLOAT);
+        mp_float_t *real = (mp_float_t *)out_re->array;
+        mp_float_t *imag = (mp_float_t *)out_im->array;
+        uint8_t *array = (uint8_t *)re->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(re->dtype);
+        // the even samples become the real, the odd samples the imaginary
+        // part of the half-length complex sequence
+        for(size_t i = 0; i < half; i++) {
+            real[i] = func(array);
+            array += re->strides[ULAB_MAX_DIMS - 1];
+            imag[i] = func(array);
+            array += re->strides[ULAB_MAX_DIMS - 1];
+        }
+        fft_kernel(real, imag, half, 1);
+        // unpack the unique bins in place
+        mp_float_t z0r = real[0];
+        mp_float_t z0i = imag[0];
+        real[0] = z0r + z0i;
+        imag[0] = MICROPY_FLOAT_CONST(0.0);
+        real[half] = z0r - z0i;
+        imag[half] = MICROPY_FLOAT_CONST(0.0);
+        theta = -MP_PI/half;
+        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        wr = MICROPY_FLOAT_CONST(1.0);
+        wi = MICROPY_FLOAT_CONST(0.0);
+        for(size_t k = 1; k <= half/2; k++) {
+            wtemp = wr;
+            wr = wr*wpr - wi*wpi + wr;
+            wi = wi*wpr + wtemp*wpi + wi;
+            size_t j = half - k;
+            mp_float_t h1r = MICROPY_FLOAT_CONST(0.5) * (real[k] + real[j]);
+            mp_float_t h1i = MICROPY_FLOAT_CONST(0.5) * (imag[k] - imag[j]);
+            mp_float_t h2r = MICROPY_FLOAT_CONST(0.5) * (imag[k] + imag[j]);
+            mp_float_t h2i = MICROPY_FLOAT_CONST(-0.5) * (real[k] - real[j]);
+            mp_float_t tr = wr*h2r - wi*h2i;
+            mp_float_t ti = wr*h2i + wi*h2r;
+            real[k] = h1r + tr;
+            imag[k] = h1i + ti;
+            real[j] = h1r - tr;
+            imag[j] = -h1i + ti;
+        }
+        mp_obj_t tuple[2];
+        tuple[0] = MP_OBJ_FROM_PTR(out_re);
+        tuple[1] = MP_OBJ_FROM_PTR(out_im);
+        return mp_obj_new_tuple(2, tuple);
+    }
+
+    // inverse transform of a half-spectrum of n/2 + 1 bins
+    ndarray_obj_t *im = NULL;
+    if(n_args == 2) {
+        if(!mp_obj_is_type(arg_im, &ulab_ndarray_type)) {
+            mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+        }
+        im = MP_OBJ_TO_PTR(arg_im);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(im->dtype)
+        #if ULAB_MAX_DIMS > 1
+        if(im->ndim != 1) {
+            mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+        }
+        #endif
+        if(re->len != im->len) {
+            mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+        }
+    }
+    size_t len = re->len;
+    size_t half = len - 1;
+    if((len < 2) || ((half & (half-1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be a power of 2 + 1"));
+    }
+    ndarray_obj_t *out = ndarray_new_linear_array(2 * half, NDARRAY_FLOAT);
+    mp_float_t *data = (mp_float_t *)out->array;
+
+    SCRATCH_ACQUIRE();
+    mp_float_t *real = SCRATCH_NEW(mp_float_t, half);
+    mp_float_t *imag = SCRATCH_NEW(mp_float_t, half);
+
+    uint8_t *rearray = (uint8_t *)re->array;
+    int32_t restride = re->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t (*refunc)(void *) = ndarray_get_float_function(re->dtype);
+    uint8_t *imarray = NULL;
+    int32_t imstride = 0;
+    mp_float_t (*imfunc)(void *) = NULL;
+    if(im != NULL) {
+        imarray = (uint8_t *)im->array;
+        imstride = im->strides[ULAB_MAX_DIMS - 1];
+        imfunc = ndarray_get_float_function(im->dtype);
+    }
+
+    theta = MP_PI/half;
+    wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+    wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+    wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+    wr = MICROPY_FLOAT_CONST(1.0);
+    wi = MICROPY_FLOAT_CONST(0.0);
+    for(size_t k = 0; k < half; k++) {
+        size_t j = half - k;
+        mp_float_t xkr = refunc(rearray + (int32_t)k * restride);
+        mp_float_t xjr = refunc(rearray + (int32_t)j * restride);
+        mp_float_t xki = MICROPY_FLOAT_CONST(0.0);
+        mp_float_t xji = MICROPY_FLOAT_CONST(0.0);
+        if(im != NULL) {
+            xki = imfunc(imarray + (int32_t)k * imstride);
+            xji = imfunc(imarray + (int32_t)j * imstride);
+        }
+        mp_float_t h1r = MICROPY_FLOAT_CONST(0.5) * (xkr + xjr);
+        mp_float_t h1i = MICROPY_FLOAT_CONST(0.5) * (xki - xji);
+        mp_float_t h2r = MICROPY_FLOAT_CONST(-0.5) * (xki + xji);
+        mp_float_t h2i = MICROPY_FLOAT_CONST(0.5) * (xkr - xjr);
+        real[k] = h1r + wr*h2r - wi*h2i;
+        imag[k] = h1i + wr*h2i + wi*h2r;
+        wtemp = wr;
+        wr = wr*wpr - wi*wpi + wr;
+        wi = wi*wpr + wtemp*wpi + wi;
+    }
+    fft_kernel(real, imag, half, -1);
+    // interleave the complex sequence back into the real signal
+    for(size_t k = 0; k < half; k++) {
+        data[2*k] = real[k] / half;
+        data[2*k+1] = imag[k] / half;
+    }
+    SCRATCH_RELEASE();
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif /* ULAB_FFT_HAS_RFFT | ULAB_FFT_HAS_IRFFT */
 #endif  /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
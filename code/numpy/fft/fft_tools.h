@@ -15,14 +15,18 @@ enum FFT_TYPE {
     FFT_FFT,
     FFT_IFFT,
     FFT_SPECTROGRAM,
+    FFT_RFFT,
+    FFT_IRFFT,
 };
 
 #if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
-void fft_kernel(mp_float_t *, size_t , int );
+void fft_kernel_complex(mp_float_t *, size_t , int );
 mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t , uint8_t );
+mp_obj_t fft_rfft_irfft(mp_obj_t , uint8_t );
 #else
 void fft_kernel(mp_float_t *, mp_float_t *, size_t , int );
 mp_obj_t fft_fft_ifft_spectrogram(size_t , mp_obj_t , mp_obj_t , uint8_t );
+mp_obj_t fft_rfft_irfft(size_t , mp_obj_t , mp_obj_t , uint8_t );
 #endif /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
 
 #endif /* _FFT_TOOLS_ */
@@ -20,12 +20,91 @@
 #include "py/misc.h"
 
 #include "../ulab.h"
+#include "../ulab_tools.h"
 #include "../scipy/signal/signal.h"
 #include "carray/carray_tools.h"
+#include "fft/fft_tools.h"
 #include "filter.h"
 
 #if ULAB_NUMPY_HAS_CONVOLVE
 
+#if ULAB_NUMPY_CONVOLVE_USES_FFT
+/*
+ * Overlap-add convolution for long kernels: the kernel spectrum is computed
+ * once, the input is processed in power-of-two blocks of at least twice the
+ * kernel length, and the tails of consecutive blocks are added into the
+ * output, so the cost drops from O(n m) to O(n log m).
+ */
+static void filter_convolve_fft(uint8_t *aarray, uint8_t adtype, int32_t as,
+            uint8_t *carray, uint8_t cdtype, int32_t cs,
+            mp_float_t *out, size_t len_a, size_t len_c) {
+    size_t n = 1;
+    while(n < 2 * len_c) {
+        n <<= 1;
+    }
+    size_t step = n - (len_c - 1); // number of new input samples per block
+    size_t total = len_a + len_c - 1;
+
+    SCRATCH_ACQUIRE();
+    #if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+    mp_float_t *cdata = SCRATCH_NEW(mp_float_t, 2 * n);
+    mp_float_t *data = SCRATCH_NEW(mp_float_t, 2 * n);
+    for(size_t i = 0; i < len_c; i++) {
+        cdata[2*i] = ndarray_get_float_index(carray, cdtype, i * cs);
+    }
+    fft_kernel_complex(cdata, n, 1);
+    for(size_t start = 0; start < len_a; start += step) {
+        size_t count = MIN(step, len_a - start);
+        for(size_t i = 0; i < count; i++) {
+            data[2*i] = ndarray_get_float_index(aarray, adtype, (start + i) * as);
+            data[2*i+1] = MICROPY_FLOAT_CONST(0.0);
+        }
+        memset(data + 2 * count, 0, 2 * (n - count) * sizeof(mp_float_t));
+        fft_kernel_complex(data, n, 1);
+        for(size_t i = 0; i < n; i++) {
+            mp_float_t tempr = data[2*i] * cdata[2*i] - data[2*i+1] * cdata[2*i+1];
+            data[2*i+1] = data[2*i] * cdata[2*i+1] + data[2*i+1] * cdata[2*i];
+            data[2*i] = tempr;
+        }
+        fft_kernel_complex(data, n, -1);
+        size_t tail = MIN(count + len_c - 1, total - start);
+        for(size_t i = 0; i < tail; i++) {
+            out[start + i] += data[2*i] / n;
+        }
+    }
+    #else
+    mp_float_t *cre = SCRATCH_NEW(mp_float_t, n);
+    mp_float_t *cim = SCRATCH_NEW(mp_float_t, n);
+    mp_float_t *re = SCRATCH_NEW(mp_float_t, n);
+    mp_float_t *im = SCRATCH_NEW(mp_float_t, n);
+    for(size_t i = 0; i < len_c; i++) {
+        cre[i] = ndarray_get_float_index(carray, cdtype, i * cs);
+    }
+    fft_kernel(cre, cim, n, 1);
+    for(size_t start = 0; start < len_a; start += step) {
+        size_t count = MIN(step, len_a - start);
+        for(size_t i = 0; i < count; i++) {
+            re[i] = ndarray_get_float_index(aarray, adtype, (start + i) * as);
+        }
+        memset(re + count, 0, (n - count) * sizeof(mp_float_t));
+        memset(im, 0, n * sizeof(mp_float_t));
+        fft_kernel(re, im, n, 1);
+        for(size_t i = 0; i < n; i++) {
+            mp_float_t tempr = re[i] * cre[i] - im[i] * cim[i];
+            im[i] = re[i] * cim[i] + im[i] * cre[i];
+            re[i] = tempr;
+        }
+        fft_kernel(re, im, n, -1);
+        size_t tail = MIN(count + len_c - 1, total - start);
+        for(size_t i = 0; i < tail; i++) {
+            out[start + i] += re[i] / n;
+        }
+    }
+    #endif
+    SCRATCH_RELEASE();
+}
+#endif /* ULAB_NUMPY_CONVOLVE_USES_FFT */
+
 mp_obj_t filter_convolve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
@@ -111,6 +190,38 @@ mp_obj_t filter_convolve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_a
     }
     #endif
 
+    if(len_c <= 4) {
+        // short FIR stencil: the kernel is loaded into registers once, and the
+        // (virtually zero-padded) input slides through a register window, so
+        // that each element of a is read from memory exactly once
+        mp_float_t c0, c1, c2, c3;
+        c0 = ndarray_get_float_index(carray, c->dtype, 0);
+        c1 = len_c > 1 ? ndarray_get_float_index(carray, c->dtype, cs) : MICROPY_FLOAT_CONST(0.0);
+        c2 = len_c > 2 ? ndarray_get_float_index(carray, c->dtype, 2 * cs) : MICROPY_FLOAT_CONST(0.0);
+        c3 = len_c > 3 ? ndarray_get_float_index(carray, c->dtype, 3 * cs) : MICROPY_FLOAT_CONST(0.0);
+        mp_float_t w0 = MICROPY_FLOAT_CONST(0.0);
+        mp_float_t w1 = w0, w2 = w0, w3 = w0;
+        for(int32_t k = 0; k < len; k++) {
+            w3 = w2;
+            w2 = w1;
+            w1 = w0;
+            w0 = k < (int32_t)len_a ? ndarray_get_float_index(aarray, a->dtype, k * as) : MICROPY_FLOAT_CONST(0.0);
+            mp_float_t accum = c3 * w3;
+            accum += c2 * w2;
+            accum += c1 * w1;
+            accum += c0 * w0;
+            *array++ = accum;
+        }
+        return MP_OBJ_FROM_PTR(ndarray);
+    }
+
+    #if ULAB_NUMPY_CONVOLVE_USES_FFT
+    if(len_c > ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD) {
+        filter_convolve_fft(aarray, a->dtype, as, carray, c->dtype, cs, array, len_a, len_c);
+        return MP_OBJ_FROM_PTR(ndarray);
+    }
+    #endif
+
     for(int32_t k = -off; k < len-off; k++) {
         mp_float_t accum = MICROPY_FLOAT_CONST(0.0);
         int32_t top_n = MIN(len_c, len_a - k);
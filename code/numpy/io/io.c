@@ -27,10 +27,60 @@
 #define ULAB_IO_CLIPBOARD_SIZE      32
 #define ULAB_IO_MAX_ROWS            65535
 
+// loadtxt reads the stream in blocks of this size; on block devices with a
+// high per-call cost (SD cards) larger blocks speed up the import considerably
+#ifndef ULAB_IO_LOADTXT_BUFFER_SIZE
+#define ULAB_IO_LOADTXT_BUFFER_SIZE 512
+#endif
+
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+#define ULAB_IO_DEC_VAL_MAX         MICROPY_FLOAT_CONST(1e20)
+#define ULAB_IO_EXACT_POWER_OF_10   (9)
+#else
+#define ULAB_IO_DEC_VAL_MAX         MICROPY_FLOAT_CONST(1e200)
+#define ULAB_IO_EXACT_POWER_OF_10   (22)
+#endif
+
 #define ULAB_IO_NULL_ENDIAN         0
 #define ULAB_IO_LITTLE_ENDIAN       1
 #define ULAB_IO_BIG_ENDIAN          2
 
+#if ULAB_NUMPY_HAS_LOAD || ULAB_NUMPY_HAS_SAVE
+static void io_convert_value(mp_float_t value, uint8_t dtype, void *item) {
+    // stores a scaled value as the given dtype; integer targets are rounded
+    // and saturated, so that quantization overflows clip instead of wrapping
+    if(dtype == NDARRAY_FLOAT) {
+        *(mp_float_t *)item = value;
+        return;
+    }
+    value = MICROPY_FLOAT_C_FUN(round)(value);
+    if(dtype == NDARRAY_UINT8) {
+        *(uint8_t *)item = value <= MICROPY_FLOAT_CONST(0.0) ? 0 : (value >= MICROPY_FLOAT_CONST(255.0) ? 255 : (uint8_t)value);
+    } else if(dtype == NDARRAY_INT8) {
+        *(int8_t *)item = value <= MICROPY_FLOAT_CONST(-128.0) ? -128 : (value >= MICROPY_FLOAT_CONST(127.0) ? 127 : (int8_t)value);
+    } else if(dtype == NDARRAY_UINT16) {
+        *(uint16_t *)item = value <= MICROPY_FLOAT_CONST(0.0) ? 0 : (value >= MICROPY_FLOAT_CONST(65535.0) ? 65535 : (uint16_t)value);
+    } else { // NDARRAY_INT16
+        *(int16_t *)item = value <= MICROPY_FLOAT_CONST(-32768.0) ? -32768 : (value >= MICROPY_FLOAT_CONST(32767.0) ? 32767 : (int16_t)value);
+    }
+}
+
+static void io_check_conversion_dtypes(uint8_t source, uint8_t target) {
+    if((target != NDARRAY_UINT8) && (target != NDARRAY_INT8) &&
+        (target != NDARRAY_UINT16) && (target != NDARRAY_INT16) &&
+        (target != NDARRAY_FLOAT)) {
+        mp_raise_TypeError(translate("wrong dtype"));
+    }
+    #if ULAB_SUPPORTS_COMPLEX
+    if(source == NDARRAY_COMPLEX) {
+        mp_raise_TypeError(translate("wrong dtype"));
+    }
+    #else
+    (void)source;
+    #endif
+}
+#endif /* ULAB_NUMPY_HAS_LOAD || ULAB_NUMPY_HAS_SAVE */
+
 #if ULAB_NUMPY_HAS_LOAD
 static void io_read_(mp_obj_t stream, const mp_stream_p_t *stream_p, char *buffer, const char *string, uint16_t len, int *error) {
     size_t read = stream_p->read(stream, buffer, len, error);
@@ -50,7 +100,18 @@ static void io_read_(mp_obj_t stream, const mp_stream_p_t *stream_p, char *buffe
     }
 }
 
-static mp_obj_t io_load(mp_obj_t file) {
+static mp_obj_t io_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_mmap, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_FALSE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = -1 } },
+        { MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t file = args[0].u_obj;
     if(!mp_obj_is_str(file)) {
         mp_raise_TypeError(translate("wrong input type"));
     }
@@ -182,6 +243,101 @@ static mp_obj_t io_load(mp_obj_t file) {
         io_read_(stream, stream_p, buffer, NULL, header_length - (bytes_to_read + 51), &error);
     }
 
+    // an explicit dtype, or a bare scale, requests element-wise conversion
+    // while reading; a bare scale implies a float result
+    uint8_t target_dtype = args[2].u_int < 0 ? dtype : (uint8_t)args[2].u_int;
+    if((args[2].u_int < 0) && (args[3].u_obj != mp_const_none)) {
+        target_dtype = NDARRAY_FLOAT;
+    }
+    bool convert = (target_dtype != dtype) || (args[3].u_obj != mp_const_none);
+    if(convert) {
+        io_check_conversion_dtypes(dtype, target_dtype);
+    }
+
+    #ifdef MP_STREAM_GET_BUFFER_INFO
+    // a converted copy cannot alias the mapped payload, so conversion
+    // overrides the mmap request
+    if(mp_obj_is_true(args[1].u_obj) && !convert) {
+        // zero-copy mode: if the stream exposes its backing buffer (e.g., a
+        // file on a memory-mapped romfs partition), return an ndarray whose
+        // data pointer aliases the mapped payload bytes directly, instead of
+        // copying them onto the heap; the mapping is usually flash, so the
+        // returned array must be treated as read-only
+        uint8_t itemsize = ulab_binary_get_size(dtype);
+        size_t count = 1;
+        for(uint8_t i = 0; i < ndim; i++) {
+            count *= shape[ULAB_MAX_DIMS - 1 - i];
+        }
+        mp_buffer_info_t bufinfo;
+        // byte-swapped payloads cannot be fixed up in place, so they take the copying path
+        if(((native_endianness == endianness) || (itemsize == 1) || (endianness == ULAB_IO_NULL_ENDIAN)) &&
+            (stream_p->ioctl(stream, MP_STREAM_GET_BUFFER_INFO, (uintptr_t)&bufinfo, &error) != MP_STREAM_ERROR)) {
+            uint8_t *data = (uint8_t *)bufinfo.buf + 10 + header_length;
+            if((bufinfo.len >= 10 + header_length + count * itemsize) &&
+                ((uintptr_t)data % itemsize == 0)) {
+                ndarray_obj_t *ndarray = m_new_obj(ndarray_obj_t);
+                ndarray->base.type = &ulab_ndarray_type;
+                ndarray->dtype = dtype;
+                ndarray->boolean = NDARRAY_NUMERIC;
+                ndarray->ndim = ndim;
+                ndarray->len = count;
+                ndarray->itemsize = itemsize;
+                int32_t stride = (int32_t)itemsize;
+                for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndim; i--) {
+                    ndarray->shape[i - 1] = shape[i - 1];
+                    ndarray->strides[i - 1] = stride;
+                    stride *= (int32_t)shape[i - 1];
+                }
+                ndarray->array = data;
+                // the stream is left open, and anchored through origin, so that
+                // the mapping stays valid for the lifetime of the array
+                ndarray->origin = MP_OBJ_TO_PTR(stream);
+                m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
+                m_del(size_t, shape, ULAB_MAX_DIMS);
+                return MP_OBJ_FROM_PTR(ndarray);
+            }
+        }
+        // the stream is not mappable: fall through to the copying path
+    }
+    #endif /* MP_STREAM_GET_BUFFER_INFO */
+
+    if(convert) {
+        // stream-convert the payload in buffer-sized chunks, so that no
+        // temporary array of the on-disk dtype has to be materialized
+        mp_float_t scale = args[3].u_obj == mp_const_none ? MICROPY_FLOAT_CONST(1.0) : mp_obj_get_float(args[3].u_obj);
+        uint8_t sz = ulab_binary_get_size(dtype);
+        ndarray_obj_t *target = ndarray_new_dense_ndarray(ndim, shape, target_dtype);
+        uint8_t *titem = (uint8_t *)target->array;
+        size_t remaining = target->len * sz;
+        while(remaining > 0) {
+            uint16_t chunk = (uint16_t)MIN((size_t)ULAB_IO_BUFFER_SIZE, remaining);
+            if(stream_p->read(stream, buffer, chunk, &error) != chunk) {
+                stream_p->ioctl(stream, MP_STREAM_CLOSE, 0, &error);
+                mp_raise_msg(&mp_type_RuntimeError, translate("corrupted file"));
+            }
+            if((native_endianness != endianness) && (endianness != ULAB_IO_NULL_ENDIAN) && (sz > 1)) {
+                char *p = buffer;
+                for(uint16_t i = 0; i < chunk; i += sz) {
+                    for(uint8_t j = 0; j < sz / 2; j++) {
+                        char tmp = p[j];
+                        p[j] = p[sz - 1 - j];
+                        p[sz - 1 - j] = tmp;
+                    }
+                    p += sz;
+                }
+            }
+            for(uint16_t i = 0; i < chunk; i += sz) {
+                io_convert_value(ndarray_get_float_value(buffer + i, dtype) * scale, target_dtype, titem);
+                titem += target->itemsize;
+            }
+            remaining -= chunk;
+        }
+        stream_p->ioctl(stream, MP_STREAM_CLOSE, 0, &error);
+        m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
+        m_del(size_t, shape, ULAB_MAX_DIMS);
+        return MP_OBJ_FROM_PTR(target);
+    }
+
     ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(ndim, shape, dtype);
     char *array = (char *)ndarray->array;
 
@@ -234,17 +390,100 @@ static mp_obj_t io_load(mp_obj_t file) {
     return MP_OBJ_FROM_PTR(ndarray);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(io_load_obj, io_load);
+MP_DEFINE_CONST_FUN_OBJ_KW(io_load_obj, 1, io_load);
 #endif /* ULAB_NUMPY_HAS_LOAD */
 
 #if ULAB_NUMPY_HAS_LOADTXT
+static bool io_parse_float(const char *str, uint8_t len, mp_float_t *value) {
+    // fast parser for the plain decimal tokens that make up practically all
+    // of a numeric text file; it mirrors the accumulation scheme of
+    // mp_parse_num_decimal, so that the values are identical to those of
+    // the generic parser, but without boxing each number into an object
+    const char *top = str + len;
+    bool negative = false;
+
+    if((str < top) && ((*str == '+') || (*str == '-'))) {
+        negative = *str == '-';
+        str++;
+    }
+
+    mp_float_t dec_val = MICROPY_FLOAT_CONST(0.0);
+    int32_t exp_extra = 0;
+    bool in_frac = false;
+    bool has_digits = false;
+
+    while(str < top) {
+        if((*str >= '0') && (*str <= '9')) {
+            if(dec_val < ULAB_IO_DEC_VAL_MAX) {
+                dec_val = MICROPY_FLOAT_CONST(10.0) * dec_val + (mp_float_t)(*str - '0');
+                if(in_frac) {
+                    exp_extra--;
+                }
+            } else if(!in_frac) {
+                exp_extra++;
+            }
+            has_digits = true;
+            str++;
+        } else if(!in_frac && (*str == '.')) {
+            in_frac = true;
+            str++;
+        } else {
+            break;
+        }
+    }
+
+    int32_t exp_val = 0;
+    if((str < top) && ((*str == 'e') || (*str == 'E'))) {
+        str++;
+        bool exp_negative = false;
+        if((str < top) && ((*str == '+') || (*str == '-'))) {
+            exp_negative = *str == '-';
+            str++;
+        }
+        bool has_exp_digits = false;
+        while((str < top) && (*str >= '0') && (*str <= '9')) {
+            exp_val = 10 * exp_val + (*str - '0');
+            has_exp_digits = true;
+            str++;
+        }
+        if(!has_exp_digits) {
+            return false;
+        }
+        if(exp_negative) {
+            exp_val = -exp_val;
+        }
+    }
+
+    if(!has_digits || (str != top)) {
+        // inf, nan, or malformed input: leave it to the generic parser
+        return false;
+    }
+
+    // scale by the base-10 exponent the same way mp_parse_num_decimal does:
+    // small negative exponents are applied as a division by an exactly
+    // representable power of 10, so that the result is correctly rounded
+    exp_val += exp_extra;
+    if((exp_val < 0) && (exp_val >= -ULAB_IO_EXACT_POWER_OF_10)) {
+        dec_val /= MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_CONST(10.0), (mp_float_t)(-exp_val));
+    } else if(exp_val != 0) {
+        dec_val *= MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_CONST(10.0), (mp_float_t)exp_val);
+    }
+
+    *value = negative ? -dec_val : dec_val;
+    return true;
+}
+
 static void io_assign_value(const char *clipboard, uint8_t len, ndarray_obj_t *ndarray, size_t *idx, uint8_t dtype) {
-    mp_obj_t value = mp_parse_num_decimal(clipboard, len, false, false, NULL);
-    if(dtype != NDARRAY_FLOAT) {
-        mp_float_t _value = mp_obj_get_float(value);
-        value = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(_value));
+    mp_float_t _value;
+    if(!io_parse_float(clipboard, len, &_value)) {
+        _value = mp_obj_get_float(mp_parse_num_decimal(clipboard, len, false, false, NULL));
+    }
+    if(dtype == NDARRAY_FLOAT) {
+        ((mp_float_t *)ndarray->array)[(*idx)++] = _value;
+    } else {
+        mp_obj_t value = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(_value));
+        ndarray_set_value(dtype, ndarray->array, (*idx)++, value);
     }
-    ndarray_set_value(dtype, ndarray->array, (*idx)++, value);
 }
 
 static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -256,6 +495,7 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         { MP_QSTR_usecols, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = NDARRAY_FLOAT } },
         { MP_QSTR_skiprows, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_rows, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = -1 } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -269,7 +509,7 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
     mp_obj_t stream = mp_builtin_open_obj.fun.kw(2, open_args, (mp_map_t *)&mp_const_empty_map);
     const mp_stream_p_t *stream_p = mp_get_stream(stream);
 
-    char *buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
+    char *buffer = m_new(char, ULAB_IO_LOADTXT_BUFFER_SIZE);
     int error;
 
     char delimiter = ' ';
@@ -294,6 +534,16 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         max_rows = args[3].u_int + skiprows;
     }
 
+    // rows is a pre-allocation hint: when given, the counting pass is cut
+    // short after the first data row (which still supplies the column
+    // count), and the output is allocated for the hinted number of rows at
+    // once; a too-large hint is trimmed back after parsing, a too-small
+    // one truncates the input, just as max_rows does
+    int32_t rows_hint = args[7].u_int;
+    if((rows_hint > 0) && (rows_hint + skiprows < max_rows)) {
+        max_rows = rows_hint + skiprows;
+    }
+
     uint16_t *cols = NULL;
     uint8_t used_columns = 0;
     if(args[4].u_obj != mp_const_none) {
@@ -326,11 +576,11 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
     // i.e., that each row has the same number of columns
     char *offset;
     uint16_t rows = 0, items = 0, all_rows = 0;
-    uint8_t read;
+    size_t read;
     uint8_t len = 0;
 
     do {
-        read = (uint8_t)stream_p->read(stream, buffer, ULAB_IO_BUFFER_SIZE - 1, &error);
+        read = stream_p->read(stream, buffer, ULAB_IO_LOADTXT_BUFFER_SIZE - 1, &error);
         buffer[read] = '\0';
         offset = buffer;
         while(*offset != '\0') {
@@ -357,6 +607,11 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
                 if(all_rows == max_rows) {
                     break;
                 }
+                if((rows_hint > 0) && (rows > 0)) {
+                    // the first data row is complete, and fixes the column
+                    // count; the hint supplies the rest
+                    break;
+                }
             }
 
             if((*offset == ' ') || (*offset == '\t') || (*offset == '\v') ||
@@ -376,12 +631,15 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
                 len++;
             }
         }
-    } while((read > 0) && (all_rows < max_rows));
+    } while((read > 0) && (all_rows < max_rows) && !((rows_hint > 0) && (rows > 0)));
 
     if(rows == 0) {
         mp_raise_ValueError(translate("empty file"));
     }
     uint16_t columns = items / rows;
+    if(rows_hint > 0) {
+        rows = (uint16_t)rows_hint;
+    }
 
     if(columns < used_columns) {
         mp_raise_ValueError(translate("usecols is too high"));
@@ -416,7 +674,7 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
 
     size_t idx = 0;
     do {
-        read = stream_p->read(stream, buffer, ULAB_IO_BUFFER_SIZE - 1, &error);
+        read = stream_p->read(stream, buffer, ULAB_IO_LOADTXT_BUFFER_SIZE - 1, &error);
         buffer[read] = '\0';
         offset = buffer;
 
@@ -481,8 +739,27 @@ static mp_obj_t io_loadtxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
 
     stream_p->ioctl(stream, MP_STREAM_CLOSE, 0, &error);
 
+    if(rows_hint > 0) {
+        // an over-estimated hint leaves unfilled rows at the end; trim the
+        // shape back to what was actually read (the surplus allocation is
+        // the price of the bad hint)
+        #if ULAB_MAX_DIMS == 1
+        if(idx < ndarray->len) {
+            ndarray->shape[ULAB_MAX_DIMS - 1] = idx;
+            ndarray->len = idx;
+        }
+        #else
+        size_t line = ndarray->shape[ULAB_MAX_DIMS - 1];
+        size_t filled = idx / line;
+        if(filled < ndarray->shape[ULAB_MAX_DIMS - 2]) {
+            ndarray->shape[ULAB_MAX_DIMS - 2] = filled;
+            ndarray->len = filled * line;
+        }
+        #endif
+    }
+
     m_del(size_t, shape, ULAB_MAX_DIMS);
-    m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
+    m_del(char, buffer, ULAB_IO_LOADTXT_BUFFER_SIZE);
     m_del(char, clipboard, ULAB_IO_CLIPBOARD_SIZE);
     m_del(uint16_t, cols, used_columns);
 
@@ -493,7 +770,77 @@ MP_DEFINE_CONST_FUN_OBJ_KW(io_loadtxt_obj, 1, io_loadtxt);
 #endif /* ULAB_NUMPY_HAS_LOADTXT */
 
 
-#if ULAB_NUMPY_HAS_SAVE
+#if ULAB_NUMPY_HAS_SAVE || ULAB_NUMPY_HAS_SAVETXT || ULAB_NUMPY_HAS_NPYWRITER
+// Block writer shared by the save functions: output is collected in a block
+// buffer, and complete blocks are handed to the stream in one go. With
+// ULAB_IO_HAS_ASYNC_WRITE the buffer is split into two ping-pong halves:
+// one half is filled while the port's background writer drains the other,
+// so that formatting and the (slow) medium overlap.
+typedef struct _io_block_writer_t {
+    mp_obj_t stream;
+    const mp_stream_p_t *stream_p;
+    char *buffer;
+    char *block; // the half currently being filled
+    size_t offset;
+} io_block_writer_t;
+
+static void io_block_writer_init(io_block_writer_t *writer, mp_obj_t stream, const mp_stream_p_t *stream_p) {
+    writer->stream = stream;
+    writer->stream_p = stream_p;
+    #if ULAB_IO_HAS_ASYNC_WRITE
+    writer->buffer = m_new(char, 2 * ULAB_IO_BUFFER_SIZE);
+    #else
+    writer->buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
+    #endif
+    writer->block = writer->buffer;
+    writer->offset = 0;
+}
+
+static void io_block_writer_flush(io_block_writer_t *writer) {
+    if(writer->offset == 0) {
+        return;
+    }
+    #if ULAB_IO_HAS_ASYNC_WRITE
+    // at most one block is ever in flight, so once the port reports the
+    // previous submission drained, the other half is free to be re-filled
+    while(!ulab_io_async_poll()) { }
+    ulab_io_async_submit(writer->stream, writer->block, writer->offset);
+    writer->block = writer->block == writer->buffer ? writer->buffer + ULAB_IO_BUFFER_SIZE : writer->buffer;
+    #else
+    int error;
+    writer->stream_p->write(writer->stream, writer->block, writer->offset, &error);
+    #endif
+    writer->offset = 0;
+}
+
+static void io_block_writer_append(io_block_writer_t *writer, const char *data, size_t len) {
+    while(len > 0) {
+        size_t space = ULAB_IO_BUFFER_SIZE - writer->offset;
+        size_t count = len < space ? len : space;
+        memcpy(writer->block + writer->offset, data, count);
+        writer->offset += count;
+        data += count;
+        len -= count;
+        if(writer->offset == ULAB_IO_BUFFER_SIZE) {
+            io_block_writer_flush(writer);
+        }
+    }
+}
+
+static void io_block_writer_end(io_block_writer_t *writer) {
+    // flush the remainder, and wait till the last block has hit the medium,
+    // so that the caller can safely close or seek the stream
+    io_block_writer_flush(writer);
+    #if ULAB_IO_HAS_ASYNC_WRITE
+    while(!ulab_io_async_poll()) { }
+    m_del(char, writer->buffer, 2 * ULAB_IO_BUFFER_SIZE);
+    #else
+    m_del(char, writer->buffer, ULAB_IO_BUFFER_SIZE);
+    #endif
+}
+#endif /* ULAB_NUMPY_HAS_SAVE || ULAB_NUMPY_HAS_SAVETXT || ULAB_NUMPY_HAS_NPYWRITER */
+
+#if ULAB_NUMPY_HAS_SAVE || ULAB_NUMPY_HAS_NPYWRITER
 static uint8_t io_sprintf(char *buffer, const char *comma, size_t x) {
     uint8_t offset = 1;
     char *buf = buffer;
@@ -524,41 +871,28 @@ static uint8_t io_sprintf(char *buffer, const char *comma, size_t x) {
     return offset - 1;
 }
 
-static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
-    if(!mp_obj_is_str(file) || !mp_obj_is_type(ndarray_, &ulab_ndarray_type)) {
-        mp_raise_TypeError(translate("wrong input type"));
-    }
-
-    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(ndarray_);
+static void io_write_npy_header(mp_obj_t stream, const mp_stream_p_t *stream_p, char *buffer, uint8_t dtype, uint8_t ndim, size_t *shape) {
+    // writes the fixed, 128-byte .npy header for an array of the given
+    // dtype and shape into the stream
     int error;
-    char *buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
     uint8_t offset = 0;
 
     // test for endianness
     uint16_t x = 1;
     int8_t native_endianness = (x >> 8) == 1 ? '>' : '<';
 
-    mp_obj_t open_args[2] = {
-        file,
-        MP_OBJ_NEW_QSTR(MP_QSTR_wb)
-    };
-
-    mp_obj_t stream = mp_builtin_open_obj.fun.kw(2, open_args, (mp_map_t *)&mp_const_empty_map);
-    const mp_stream_p_t *stream_p = mp_get_stream(stream);
-
-    // write header;
     // magic string + header length, which is always 128 - 10 = 118, represented as a little endian uint16 (0x76, 0x00)
     // + beginning of the dictionary describing the array
     memcpy(buffer, "\x93NUMPY\x01\x00\x76\x00{'descr': '", 21);
     offset += 21;
 
     buffer[offset] = native_endianness;
-    if((ndarray->dtype == NDARRAY_UINT8) || (ndarray->dtype == NDARRAY_INT8)) {
+    if((dtype == NDARRAY_UINT8) || (dtype == NDARRAY_INT8)) {
         // for single-byte data, the endianness doesn't matter
         buffer[offset] = '|';
     }
     offset++;
-    switch(ndarray->dtype) {
+    switch(dtype) {
         case NDARRAY_UINT8:
             memcpy(buffer+offset, "u1", 2);
             break;
@@ -594,13 +928,13 @@ static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
     memcpy(buffer+offset, "', 'fortran_order': False, 'shape': (", 37);
     offset += 37;
 
-    if(ndarray->ndim == 1) {
-        offset += io_sprintf(buffer+offset, ",\0", ndarray->shape[ULAB_MAX_DIMS - 1]);
+    if(ndim == 1) {
+        offset += io_sprintf(buffer+offset, ",\0", shape[ULAB_MAX_DIMS - 1]);
     } else {
-        for(uint8_t i = ndarray->ndim; i > 1; i--) {
-            offset += io_sprintf(buffer+offset, ", \0", ndarray->shape[ULAB_MAX_DIMS - i]);
+        for(uint8_t i = ndim; i > 1; i--) {
+            offset += io_sprintf(buffer+offset, ", \0", shape[ULAB_MAX_DIMS - i]);
         }
-        offset += io_sprintf(buffer+offset, "\0", ndarray->shape[ULAB_MAX_DIMS - 1]);
+        offset += io_sprintf(buffer+offset, "\0", shape[ULAB_MAX_DIMS - 1]);
     }
     memcpy(buffer+offset, "), }", 4);
     offset += 4;
@@ -608,10 +942,62 @@ static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
     memset(buffer+offset, 32, ULAB_IO_BUFFER_SIZE - offset - 1);
     buffer[ULAB_IO_BUFFER_SIZE - 1] = '\n';
     stream_p->write(stream, buffer, ULAB_IO_BUFFER_SIZE, &error);
+}
+#endif /* ULAB_NUMPY_HAS_SAVE || ULAB_NUMPY_HAS_NPYWRITER */
+
+#if ULAB_NUMPY_HAS_SAVE
+static mp_obj_t io_save(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = -1 } },
+        { MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t file = args[0].u_obj;
+    if(!mp_obj_is_str(file) || !mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[1].u_obj);
+    int error;
+
+    // an explicit dtype, or a bare scale, requests element-wise conversion
+    // while writing; items are divided by scale and quantized to the target
+    // dtype, so that load(scale=...) restores the original values
+    uint8_t target_dtype = args[2].u_int < 0 ? ndarray->dtype : (uint8_t)args[2].u_int;
+    bool convert = (target_dtype != ndarray->dtype) || (args[3].u_obj != mp_const_none);
+    mp_float_t scale = MICROPY_FLOAT_CONST(1.0);
+    mp_float_t (*func)(void *) = NULL;
+    if(convert) {
+        io_check_conversion_dtypes(ndarray->dtype, target_dtype);
+        if(args[3].u_obj != mp_const_none) {
+            scale = mp_obj_get_float(args[3].u_obj);
+        }
+        func = ndarray_get_float_function(ndarray->dtype);
+    }
+
+    mp_obj_t open_args[2] = {
+        file,
+        MP_OBJ_NEW_QSTR(MP_QSTR_wb)
+    };
+
+    mp_obj_t stream = mp_builtin_open_obj.fun.kw(2, open_args, (mp_map_t *)&mp_const_empty_map);
+    const mp_stream_p_t *stream_p = mp_get_stream(stream);
+
+    io_block_writer_t writer;
+    io_block_writer_init(&writer, stream, stream_p);
+
+    // nothing has been appended yet, so the empty block can double as the
+    // header's scratch buffer; the header itself is written synchronously
+    io_write_npy_header(stream, stream_p, writer.block, target_dtype, ndarray->ndim, ndarray->shape);
 
     // write the array data
     uint8_t sz = ndarray->itemsize;
-    offset = 0;
+    uint8_t target_sz = ulab_binary_get_size(target_dtype);
 
     uint8_t *array = (uint8_t *)ndarray->array;
 
@@ -629,11 +1015,12 @@ static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
             #endif
                 size_t l = 0;
                 do {
-                    memcpy(buffer+offset, array, sz);
-                    offset += sz;
-                    if(offset == ULAB_IO_BUFFER_SIZE) {
-                        stream_p->write(stream, buffer, offset, &error);
-                        offset = 0;
+                    if(convert) {
+                        uint8_t item[sizeof(mp_float_t)];
+                        io_convert_value(func(array) / scale, target_dtype, item);
+                        io_block_writer_append(&writer, (const char *)item, target_sz);
+                    } else {
+                        io_block_writer_append(&writer, (const char *)array, sz);
                     }
                     array += ndarray->strides[ULAB_MAX_DIMS - 1];
                     l++;
@@ -657,16 +1044,199 @@ static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
     } while(i <  ndarray->shape[ULAB_MAX_DIMS - 4]);
     #endif
 
-    stream_p->write(stream, buffer, offset, &error);
+    io_block_writer_end(&writer);
     stream_p->ioctl(stream, MP_STREAM_CLOSE, 0, &error);
 
-    m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
     return mp_const_none;
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(io_save_obj, io_save);
+MP_DEFINE_CONST_FUN_OBJ_KW(io_save_obj, 2, io_save);
 #endif /* ULAB_NUMPY_HAS_SAVE */
 
+#if ULAB_NUMPY_HAS_NPYWRITER & (ULAB_MAX_DIMS > 1)
+//| class NpyWriter:
+//|     """A streaming .npy writer for continuous logging. The file is opened
+//|     once with the number of columns and the dtype; append() then streams
+//|     row batches straight from the source array into the file, so the
+//|     capture never has to be held in memory as a whole. close() patches
+//|     the row count into the header and closes the file."""
+//|     ...
+//|
+
+typedef struct _io_npywriter_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t stream;
+    const mp_stream_p_t *stream_p;
+    size_t cols;
+    size_t rows; // rows written so far; patched into the header on close
+    uint8_t dtype;
+    uint8_t itemsize;
+    bool closed;
+} io_npywriter_obj_t;
+
+extern const mp_obj_type_t io_npywriter_type;
+
+static mp_obj_t io_npywriter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 2, 3, false);
+
+    if(!mp_obj_is_str(all_args[0])) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    mp_int_t cols = mp_obj_get_int(all_args[1]);
+    if(cols < 1) {
+        mp_raise_ValueError(translate("number of columns must be positive"));
+    }
+    uint8_t dtype = NDARRAY_FLOAT;
+    if(n_args == 3) {
+        dtype = (uint8_t)mp_obj_get_int(all_args[2]);
+    }
+    if((dtype != NDARRAY_UINT8) && (dtype != NDARRAY_INT8) &&
+        (dtype != NDARRAY_UINT16) && (dtype != NDARRAY_INT16) &&
+        #if ULAB_SUPPORTS_COMPLEX
+        (dtype != NDARRAY_COMPLEX) &&
+        #endif
+        (dtype != NDARRAY_FLOAT)) {
+        mp_raise_TypeError(translate("wrong dtype"));
+    }
+
+    mp_obj_t open_args[2] = {
+        all_args[0],
+        MP_OBJ_NEW_QSTR(MP_QSTR_wb)
+    };
+
+    io_npywriter_obj_t *self = m_new_obj(io_npywriter_obj_t);
+    self->base.type = &io_npywriter_type;
+    self->stream = mp_builtin_open_obj.fun.kw(2, open_args, (mp_map_t *)&mp_const_empty_map);
+    self->stream_p = mp_get_stream(self->stream);
+    self->cols = (size_t)cols;
+    self->rows = 0;
+    self->dtype = dtype;
+    self->itemsize = ulab_binary_get_size(dtype);
+    self->closed = false;
+
+    // write a provisional header with zero rows, so that the file is a
+    // valid (empty) .npy at all times; close() patches in the final count
+    char *buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
+    shape[ULAB_MAX_DIMS - 1] = self->cols;
+    io_write_npy_header(self->stream, self->stream_p, buffer, dtype, 2, shape);
+    m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t io_npywriter_append(mp_obj_t self_in, mp_obj_t ndarray_) {
+    io_npywriter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(self->closed) {
+        mp_raise_ValueError(translate("writer is closed"));
+    }
+    if(!mp_obj_is_type(ndarray_, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(ndarray_);
+    if(ndarray->dtype != self->dtype) {
+        mp_raise_TypeError(translate("wrong dtype"));
+    }
+    if((ndarray->len == 0) || (ndarray->len % self->cols != 0)) {
+        mp_raise_ValueError(translate("input length must be a multiple of the number of columns"));
+    }
+
+    io_block_writer_t writer;
+    io_block_writer_init(&writer, self->stream, self->stream_p);
+    uint8_t sz = self->itemsize;
+
+    uint8_t *array = (uint8_t *)ndarray->array;
+
+    // stream the items in logical order through the block buffer, exactly
+    // as io_save does, so that non-dense sources also work
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    io_block_writer_append(&writer, (const char *)array, sz);
+                    array += ndarray->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < ndarray->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                array -= ndarray->strides[ULAB_MAX_DIMS - 1] * ndarray->shape[ULAB_MAX_DIMS-1];
+                array += ndarray->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < ndarray->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= ndarray->strides[ULAB_MAX_DIMS - 2] * ndarray->shape[ULAB_MAX_DIMS-2];
+            array += ndarray->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < ndarray->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= ndarray->strides[ULAB_MAX_DIMS - 3] * ndarray->shape[ULAB_MAX_DIMS-3];
+        array += ndarray->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < ndarray->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    io_block_writer_end(&writer);
+
+    self->rows += ndarray->len / self->cols;
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(io_npywriter_append_obj, io_npywriter_append);
+
+static mp_obj_t io_npywriter_close(mp_obj_t self_in) {
+    io_npywriter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(self->closed) {
+        return mp_const_none;
+    }
+
+    int error;
+    struct mp_stream_seek_t seek_s;
+    seek_s.offset = 0;
+    seek_s.whence = MP_SEEK_SET;
+    self->stream_p->ioctl(self->stream, MP_STREAM_SEEK, (mp_uint_t)(uintptr_t)&seek_s, &error);
+
+    // re-write the header with the final row count
+    char *buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
+    shape[ULAB_MAX_DIMS - 1] = self->cols;
+    shape[ULAB_MAX_DIMS - 2] = self->rows;
+    io_write_npy_header(self->stream, self->stream_p, buffer, self->dtype, 2, shape);
+    m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
+
+    self->stream_p->ioctl(self->stream, MP_STREAM_CLOSE, 0, &error);
+    self->closed = true;
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(io_npywriter_close_obj, io_npywriter_close);
+
+static const mp_rom_map_elem_t io_npywriter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&io_npywriter_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&io_npywriter_close_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(io_npywriter_locals_dict, io_npywriter_locals_dict_table);
+
+const mp_obj_type_t io_npywriter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_NpyWriter,
+    .make_new = io_npywriter_make_new,
+    .locals_dict = (mp_obj_dict_t*)&io_npywriter_locals_dict,
+};
+#endif /* ULAB_NUMPY_HAS_NPYWRITER & (ULAB_MAX_DIMS > 1) */
+
 #if ULAB_NUMPY_HAS_SAVETXT
 static int8_t io_format_float(ndarray_obj_t *ndarray, mp_float_t (*func)(void *), uint8_t *array, char *buffer, const char *delimiter) {
     // own implementation of float formatting for platforms that don't have sprintf
@@ -744,20 +1314,26 @@ static mp_obj_t io_savetxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
     mp_obj_t stream = mp_builtin_open_obj.fun.kw(2, open_args, (mp_map_t *)&mp_const_empty_map);
     const mp_stream_p_t *stream_p = mp_get_stream(stream);
 
+    // formatted tokens are collected in a scratch buffer first, and then
+    // accumulated into the block writer, so that the stream sees whole
+    // blocks instead of one write per token
     char *buffer = m_new(char, ULAB_IO_BUFFER_SIZE);
     int error;
 
+    io_block_writer_t writer;
+    io_block_writer_init(&writer, stream, stream_p);
+
     if(mp_obj_is_str(args[3].u_obj)) {
         size_t _len;
         if(mp_obj_is_str(args[5].u_obj)) {
             const char *comments = mp_obj_str_get_data(args[5].u_obj, &_len);
-            stream_p->write(stream, comments, _len, &error);
+            io_block_writer_append(&writer, comments, _len);
         } else {
-            stream_p->write(stream, "# ", 2, &error);
+            io_block_writer_append(&writer, "# ", 2);
         }
         const char *header = mp_obj_str_get_data(args[3].u_obj, &_len);
-        stream_p->write(stream, header, _len, &error);
-        stream_p->write(stream, "\n", 1, &error);
+        io_block_writer_append(&writer, header, _len);
+        io_block_writer_append(&writer, "\n", 1);
     }
 
     uint8_t *array = (uint8_t *)ndarray->array;
@@ -783,7 +1359,7 @@ static mp_obj_t io_savetxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         do {
             int8_t chars = io_format_float(ndarray, func, array, buffer, l == ndarray->shape[ULAB_MAX_DIMS - 1] - 1 ? "\n" : delimiter);
             if(chars > 0) {
-                stream_p->write(stream, buffer, chars, &error);
+                io_block_writer_append(&writer, buffer, chars);
             }
             array += ndarray->strides[ULAB_MAX_DIMS - 1];
             l++;
@@ -799,17 +1375,19 @@ static mp_obj_t io_savetxt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         size_t _len;
         if(mp_obj_is_str(args[5].u_obj)) {
             const char *comments = mp_obj_str_get_data(args[5].u_obj, &_len);
-            stream_p->write(stream, comments, _len, &error);
+            io_block_writer_append(&writer, comments, _len);
         } else {
-            stream_p->write(stream, "# ", 2, &error);
+            io_block_writer_append(&writer, "# ", 2);
         }
         const char *footer = mp_obj_str_get_data(args[4].u_obj, &_len);
-        stream_p->write(stream, footer, _len, &error);
-        stream_p->write(stream, "\n", 1, &error);
+        io_block_writer_append(&writer, footer, _len);
+        io_block_writer_append(&writer, "\n", 1);
     }
 
+    io_block_writer_end(&writer);
     stream_p->ioctl(stream, MP_STREAM_CLOSE, 0, &error);
 
+    m_del(char, buffer, ULAB_IO_BUFFER_SIZE);
     return mp_const_none;
 }
 
@@ -11,9 +11,22 @@
 #ifndef _ULAB_IO_
 #define _ULAB_IO_
 
-MP_DECLARE_CONST_FUN_OBJ_1(io_load_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(io_load_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(io_loadtxt_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(io_save_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(io_save_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(io_savetxt_obj);
 
+#if ULAB_NUMPY_HAS_NPYWRITER & (ULAB_MAX_DIMS > 1)
+extern const mp_obj_type_t io_npywriter_type;
+#endif
+
+#if ULAB_IO_HAS_ASYNC_WRITE
+// supplied by the port: hand a filled block to the background stream
+// writer, and report whether the previously submitted block has been
+// written out; the buffer passed to submit() must not be touched before
+// poll() returns true
+void ulab_io_async_submit(mp_obj_t , const char *, size_t );
+bool ulab_io_async_poll(void);
+#endif
+
 #endif
\ No newline at end of file
@@ -115,7 +115,8 @@ static mp_obj_t linalg_det(mp_obj_t oin) {
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     uint8_t *array = (uint8_t *)ndarray->array;
     size_t N = ndarray->shape[ULAB_MAX_DIMS - 1];
-    mp_float_t *tmp = m_new(mp_float_t, N * N);
+    SCRATCH_ACQUIRE();
+    mp_float_t *tmp = SCRATCH_NEW(mp_float_t, N * N);
     for(size_t m=0; m < N; m++) { // rows
         for(size_t n=0; n < N; n++) { // columns
             *tmp++ = ndarray_get_float_value(array, ndarray->dtype);
@@ -147,7 +148,7 @@ static mp_obj_t linalg_det(mp_obj_t oin) {
                 }
             }
             if (m1 >= N) {
-                m_del(mp_float_t, tmp, N * N);
+                SCRATCH_RELEASE();
                 return mp_obj_new_float(0.0);
             }
         }
@@ -165,7 +166,7 @@ static mp_obj_t linalg_det(mp_obj_t oin) {
     for(size_t m=0; m < N; m++){
         det *= tmp[m * (N+1)];
     }
-    m_del(mp_float_t, tmp, N * N);
+    SCRATCH_RELEASE();
     return mp_obj_new_float(det);
 }
 
@@ -188,7 +189,8 @@ static mp_obj_t linalg_eig(mp_obj_t oin) {
     COMPLEX_DTYPE_NOT_IMPLEMENTED(in->dtype)
     uint8_t *iarray = (uint8_t *)in->array;
     size_t S = in->shape[ULAB_MAX_DIMS - 1];
-    mp_float_t *array = m_new(mp_float_t, S*S);
+    SCRATCH_ACQUIRE();
+    mp_float_t *array = SCRATCH_NEW(mp_float_t, S*S);
     for(size_t i=0; i < S; i++) { // rows
         for(size_t j=0; j < S; j++) { // columns
             *array++ = ndarray_get_float_value(iarray, in->dtype);
@@ -204,6 +206,7 @@ static mp_obj_t linalg_eig(mp_obj_t oin) {
             // compare entry (m, n) to (n, m)
             // TODO: this must probably be scaled!
             if(LINALG_EPSILON < MICROPY_FLOAT_C_FUN(fabs)(array[m * S + n] - array[n * S + m])) {
+                SCRATCH_RELEASE();
                 mp_raise_ValueError(translate("input matrix is asymmetric"));
             }
         }
@@ -214,19 +217,33 @@ static mp_obj_t linalg_eig(mp_obj_t oin) {
     ndarray_obj_t *eigenvectors = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, S, S), NDARRAY_FLOAT);
     mp_float_t *eigvectors = (mp_float_t *)eigenvectors->array;
 
-    size_t iterations = linalg_jacobi_rotations(array, eigvectors, S);
-
-    if(iterations == 0) {
-        // the computation did not converge; numpy raises LinAlgError
-        m_del(mp_float_t, array, in->len);
-        mp_raise_ValueError(translate("iterations did not converge"));
-    }
     ndarray_obj_t *eigenvalues = ndarray_new_linear_array(S, NDARRAY_FLOAT);
     mp_float_t *eigvalues = (mp_float_t *)eigenvalues->array;
-    for(size_t i=0; i < S; i++) {
-        eigvalues[i] = array[i * (S + 1)];
+
+    if(S > JACOBI_CUTOFF) {
+        // the Jacobi sweeps scale poorly with the matrix size: reduce to
+        // tridiagonal form first, and diagonalise with the QL iteration
+        mp_float_t *e = SCRATCH_NEW(mp_float_t, S);
+        linalg_householder_tridiagonal(array, eigvalues, e, S, true);
+        if(!linalg_tridiagonal_ql(eigvalues, e, array, S)) {
+            // the computation did not converge; numpy raises LinAlgError
+            SCRATCH_RELEASE();
+            mp_raise_ValueError(translate("iterations did not converge"));
+        }
+        memcpy(eigvectors, array, S * S * sizeof(mp_float_t));
+    } else {
+        size_t iterations = linalg_jacobi_rotations(array, eigvectors, S);
+
+        if(iterations == 0) {
+            // the computation did not converge; numpy raises LinAlgError
+            SCRATCH_RELEASE();
+            mp_raise_ValueError(translate("iterations did not converge"));
+        }
+        for(size_t i=0; i < S; i++) {
+            eigvalues[i] = array[i * (S + 1)];
+        }
     }
-    m_del(mp_float_t, array, in->len);
+    SCRATCH_RELEASE();
 
     mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
     tuple->items[0] = MP_OBJ_FROM_PTR(eigenvalues);
@@ -236,6 +253,77 @@ static mp_obj_t linalg_eig(mp_obj_t oin) {
 
 MP_DEFINE_CONST_FUN_OBJ_1(linalg_eig_obj, linalg_eig);
 
+#if ULAB_LINALG_HAS_EIGVALS
+//| def eigvals(m: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param m: a square matrix
+//|     :return ~ulab.numpy.ndarray: the eigenvalues of the matrix
+//|
+//|     Computes the eigenvalues of a square matrix, without accumulating
+//|     the eigenvectors, which makes it considerably cheaper than eig"""
+//|     ...
+//|
+
+static mp_obj_t linalg_eigvals(mp_obj_t oin) {
+    ndarray_obj_t *in = tools_object_is_square(oin);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(in->dtype)
+    uint8_t *iarray = (uint8_t *)in->array;
+    size_t S = in->shape[ULAB_MAX_DIMS - 1];
+    SCRATCH_ACQUIRE();
+    mp_float_t *array = SCRATCH_NEW(mp_float_t, S*S);
+    for(size_t i=0; i < S; i++) { // rows
+        for(size_t j=0; j < S; j++) { // columns
+            *array++ = ndarray_get_float_value(iarray, in->dtype);
+            iarray += in->strides[ULAB_MAX_DIMS - 1];
+        }
+        iarray -= in->strides[ULAB_MAX_DIMS - 1] * S;
+        iarray += in->strides[ULAB_MAX_DIMS - 2];
+    }
+    array -= S * S;
+    // make sure the matrix is symmetric
+    for(size_t m=0; m < S; m++) {
+        for(size_t n=m+1; n < S; n++) {
+            // compare entry (m, n) to (n, m)
+            if(LINALG_EPSILON < MICROPY_FLOAT_C_FUN(fabs)(array[m * S + n] - array[n * S + m])) {
+                SCRATCH_RELEASE();
+                mp_raise_ValueError(translate("input matrix is asymmetric"));
+            }
+        }
+    }
+
+    ndarray_obj_t *eigenvalues = ndarray_new_linear_array(S, NDARRAY_FLOAT);
+    mp_float_t *eigvalues = (mp_float_t *)eigenvalues->array;
+
+    if(S > JACOBI_CUTOFF) {
+        // eigenvalues only: neither the tridiagonalising transform, nor
+        // the QL rotations have to be accumulated
+        mp_float_t *e = SCRATCH_NEW(mp_float_t, S);
+        linalg_householder_tridiagonal(array, eigvalues, e, S, false);
+        if(!linalg_tridiagonal_ql(eigvalues, e, NULL, S)) {
+            SCRATCH_RELEASE();
+            mp_raise_ValueError(translate("iterations did not converge"));
+        }
+    } else {
+        mp_float_t *eigvectors = SCRATCH_NEW(mp_float_t, S*S);
+        memset(eigvectors, 0, S * S * sizeof(mp_float_t));
+        size_t iterations = linalg_jacobi_rotations(array, eigvectors, S);
+
+        if(iterations == 0) {
+            SCRATCH_RELEASE();
+            mp_raise_ValueError(translate("iterations did not converge"));
+        }
+        for(size_t i=0; i < S; i++) {
+            eigvalues[i] = array[i * (S + 1)];
+        }
+    }
+    SCRATCH_RELEASE();
+
+    return MP_OBJ_FROM_PTR(eigenvalues);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_eigvals_obj, linalg_eigvals);
+#endif /* ULAB_LINALG_HAS_EIGVALS */
+
 //| def inv(m: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
 //|     """
 //|     :param ~ulab.numpy.ndarray m: a square matrix
@@ -246,6 +334,47 @@ MP_DEFINE_CONST_FUN_OBJ_1(linalg_eig_obj, linalg_eig);
 //|     ...
 //|
 static mp_obj_t linalg_inv(mp_obj_t o_in) {
+    #if ULAB_LINALG_HAS_BATCH & (ULAB_MAX_DIMS > 2)
+    if(mp_obj_is_type(o_in, &ulab_ndarray_type) && (((ndarray_obj_t *)MP_OBJ_TO_PTR(o_in))->ndim == 3)) {
+        // the leading axis is a batch dimension: invert all matrices in one call
+        ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
+        if(source->shape[ULAB_MAX_DIMS - 1] != source->shape[ULAB_MAX_DIMS - 2]) {
+            mp_raise_ValueError(translate("input must be a square matrix"));
+        }
+        size_t batch = source->shape[ULAB_MAX_DIMS - 3];
+        size_t N = source->shape[ULAB_MAX_DIMS - 1];
+        ndarray_obj_t *inverted = ndarray_new_dense_ndarray(3, ndarray_shape_vector(0, batch, N, N), NDARRAY_FLOAT);
+        mp_float_t *iarray = (mp_float_t *)inverted->array;
+
+        mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
+        uint8_t *sarray = (uint8_t *)source->array;
+
+        for(size_t b = 0; b < batch; b++) {
+            uint8_t *array = sarray + b * source->strides[ULAB_MAX_DIMS - 3];
+            for(size_t i = 0; i < N; i++) { // rows
+                for(size_t j = 0; j < N; j++) { // columns
+                    *iarray++ = func(array);
+                    array += source->strides[ULAB_MAX_DIMS - 1];
+                }
+                array -= source->strides[ULAB_MAX_DIMS - 1] * N;
+                array += source->strides[ULAB_MAX_DIMS - 2];
+            }
+            iarray -= N * N;
+            bool ok;
+            if((N > 1) && (N < 5)) {
+                ok = linalg_invert_small(iarray, N);
+            } else {
+                ok = linalg_invert_matrix(iarray, N);
+            }
+            if(!ok) {
+                mp_raise_ValueError(translate("input matrix is singular"));
+            }
+            iarray += N * N;
+        }
+        return MP_OBJ_FROM_PTR(inverted);
+    }
+    #endif
     ndarray_obj_t *ndarray = tools_object_is_square(o_in);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     uint8_t *array = (uint8_t *)ndarray->array;
@@ -506,6 +635,279 @@ static mp_obj_t linalg_qr(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
 MP_DEFINE_CONST_FUN_OBJ_KW(linalg_qr_obj, 1, linalg_qr);
 #endif
 
+#if ULAB_MAX_DIMS > 1
+#if ULAB_LINALG_HAS_LSTSQ
+//| def lstsq(A: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray A: a matrix of shape (m, n), with m >= n
+//|     :param ~ulab.numpy.ndarray b: a vector of length m
+//|     :return: the vector x minimising the norm of A x - b
+//|     :raises ValueError: if A is rank deficient
+//|
+//|     Solves the least-squares problem by Householder QR factorisation.
+//|     Unlike numpy, only the solution vector is returned"""
+//|     ...
+//|
+
+static mp_obj_t linalg_lstsq(mp_obj_t _A, mp_obj_t _b) {
+    if(!mp_obj_is_type(_A, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("operation is defined for ndarrays only"));
+    }
+    ndarray_obj_t *A = MP_OBJ_TO_PTR(_A);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(A->dtype)
+    if(A->ndim != 2) {
+        mp_raise_ValueError(translate("operation is defined for 2D arrays only"));
+    }
+    size_t m = A->shape[ULAB_MAX_DIMS - 2]; // rows
+    size_t n = A->shape[ULAB_MAX_DIMS - 1]; // columns
+    if(m < n) {
+        mp_raise_ValueError(translate("matrix must have at least as many rows as columns"));
+    }
+
+    ndarray_obj_t *b = ndarray_from_mp_obj(_b, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
+    if((b->ndim != 1) || (b->shape[ULAB_MAX_DIMS - 1] != m)) {
+        mp_raise_ValueError(translate("dimensions do not match"));
+    }
+
+    SCRATCH_ACQUIRE();
+    mp_float_t *a = SCRATCH_NEW(mp_float_t, m * n);
+    mp_float_t *rhs = SCRATCH_NEW(mp_float_t, m);
+
+    mp_float_t (*afunc)(void *) = ndarray_get_float_function(A->dtype);
+    uint8_t *aarray = (uint8_t *)A->array;
+    for(size_t i = 0; i < m; i++) { // rows
+        for(size_t j = 0; j < n; j++) { // columns
+            a[i * n + j] = afunc(aarray);
+            aarray += A->strides[ULAB_MAX_DIMS - 1];
+        }
+        aarray -= A->strides[ULAB_MAX_DIMS - 1] * n;
+        aarray += A->strides[ULAB_MAX_DIMS - 2];
+    }
+
+    mp_float_t (*bfunc)(void *) = ndarray_get_float_function(b->dtype);
+    uint8_t *barray = (uint8_t *)b->array;
+    for(size_t i = 0; i < m; i++) {
+        rhs[i] = bfunc(barray);
+        barray += b->strides[ULAB_MAX_DIMS - 1];
+    }
+
+    if(!linalg_qr_solve(a, rhs, m, n)) {
+        SCRATCH_RELEASE();
+        mp_raise_ValueError(translate("matrix is rank deficient"));
+    }
+
+    ndarray_obj_t *x = ndarray_new_linear_array(n, NDARRAY_FLOAT);
+    memcpy(x->array, rhs, n * sizeof(mp_float_t));
+    SCRATCH_RELEASE();
+    return MP_OBJ_FROM_PTR(x);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(linalg_lstsq_obj, linalg_lstsq);
+#endif /* ULAB_LINALG_HAS_LSTSQ */
+#endif
+
+#if ULAB_MAX_DIMS > 1
+#if ULAB_LINALG_HAS_SOLVE
+//| def solve(A: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray A: a square matrix
+//|     :param ~ulab.numpy.ndarray b: a vector, or a matrix holding one right-hand side per column
+//|     :return: The solution of the equation Ax = b
+//|     :raises ValueError: if the matrix is singular
+//|
+//|     Solves the linear equation via LU factorisation with partial pivoting,
+//|     which is both cheaper, and numerically more accurate than inverting A,
+//|     and multiplying with b."""
+//|     ...
+//|
+
+static bool linalg_solve_lu(mp_float_t *lu, mp_float_t *B, size_t N, size_t M) {
+    // LU factorisation with partial pivoting; the row swaps are applied
+    // to the right-hand sides immediately, and the forward substitution
+    // is folded into the elimination loop. Returns false, if the matrix
+    // is singular
+    for(size_t k = 0; k < N; k++) {
+        size_t pivot = k;
+        mp_float_t largest = MICROPY_FLOAT_C_FUN(fabs)(lu[k * N + k]);
+        for(size_t i = k + 1; i < N; i++) {
+            mp_float_t value = MICROPY_FLOAT_C_FUN(fabs)(lu[i * N + k]);
+            if(value > largest) {
+                largest = value;
+                pivot = i;
+            }
+        }
+        if(largest < LINALG_EPSILON) {
+            return false;
+        }
+        if(pivot != k) {
+            for(size_t j = k; j < N; j++) {
+                SWAP(mp_float_t, lu[k * N + j], lu[pivot * N + j]);
+            }
+            for(size_t m = 0; m < M; m++) {
+                SWAP(mp_float_t, B[k * M + m], B[pivot * M + m]);
+            }
+        }
+        for(size_t i = k + 1; i < N; i++) {
+            mp_float_t factor = lu[i * N + k] / lu[k * N + k];
+            for(size_t j = k + 1; j < N; j++) {
+                lu[i * N + j] -= factor * lu[k * N + j];
+            }
+            for(size_t m = 0; m < M; m++) {
+                B[i * M + m] -= factor * B[k * M + m];
+            }
+        }
+    }
+
+    // back substitution, directly into the right-hand side array
+    for(size_t k = N; k > 0; k--) {
+        for(size_t m = 0; m < M; m++) {
+            mp_float_t sum = B[(k - 1) * M + m];
+            for(size_t j = k; j < N; j++) {
+                sum -= lu[(k - 1) * N + j] * B[j * M + m];
+            }
+            B[(k - 1) * M + m] = sum / lu[(k - 1) * N + (k - 1)];
+        }
+    }
+    return true;
+}
+
+static mp_obj_t linalg_solve(mp_obj_t _A, mp_obj_t _b) {
+    #if ULAB_LINALG_HAS_BATCH & (ULAB_MAX_DIMS > 2)
+    if(mp_obj_is_type(_A, &ulab_ndarray_type) && (((ndarray_obj_t *)MP_OBJ_TO_PTR(_A))->ndim == 3)) {
+        // the leading axis is a batch dimension: solve all systems in one call
+        ndarray_obj_t *A = MP_OBJ_TO_PTR(_A);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(A->dtype)
+        if(A->shape[ULAB_MAX_DIMS - 1] != A->shape[ULAB_MAX_DIMS - 2]) {
+            mp_raise_ValueError(translate("input must be a square matrix"));
+        }
+        size_t batch = A->shape[ULAB_MAX_DIMS - 3];
+        size_t N = A->shape[ULAB_MAX_DIMS - 1];
+
+        ndarray_obj_t *b = ndarray_from_mp_obj(_b, 0);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
+        if((b->ndim < 2) ||
+            (b->shape[ULAB_MAX_DIMS - b->ndim] != batch) ||
+            (b->shape[ULAB_MAX_DIMS - b->ndim + 1] != N)) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        size_t M = b->ndim == 3 ? b->shape[ULAB_MAX_DIMS - 1] : 1;
+
+        ndarray_obj_t *results;
+        if(b->ndim == 3) {
+            results = ndarray_new_dense_ndarray(3, ndarray_shape_vector(0, batch, N, M), NDARRAY_FLOAT);
+        } else {
+            results = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, batch, N), NDARRAY_FLOAT);
+        }
+        mp_float_t *rarray = (mp_float_t *)results->array;
+
+        // copy the right-hand sides into the result array
+        mp_float_t (*bfunc)(void *) = ndarray_get_float_function(b->dtype);
+        uint8_t *barray = (uint8_t *)b->array;
+        for(size_t bb = 0; bb < batch; bb++) {
+            uint8_t *bslice = barray + bb * b->strides[ULAB_MAX_DIMS - b->ndim];
+            for(size_t i = 0; i < N; i++) {
+                uint8_t *brow = bslice + i * b->strides[ULAB_MAX_DIMS - b->ndim + 1];
+                for(size_t m = 0; m < M; m++) {
+                    *rarray++ = bfunc(brow);
+                    brow += b->strides[ULAB_MAX_DIMS - 1];
+                }
+            }
+        }
+        rarray -= batch * N * M;
+
+        SCRATCH_ACQUIRE();
+        mp_float_t *lu = SCRATCH_NEW(mp_float_t, N * N);
+        mp_float_t (*func)(void *) = ndarray_get_float_function(A->dtype);
+        uint8_t *aarray = (uint8_t *)A->array;
+        for(size_t bb = 0; bb < batch; bb++) {
+            uint8_t *array = aarray + bb * A->strides[ULAB_MAX_DIMS - 3];
+            mp_float_t *l = lu;
+            for(size_t i = 0; i < N; i++) { // rows
+                for(size_t j = 0; j < N; j++) { // columns
+                    *l++ = func(array);
+                    array += A->strides[ULAB_MAX_DIMS - 1];
+                }
+                array -= A->strides[ULAB_MAX_DIMS - 1] * N;
+                array += A->strides[ULAB_MAX_DIMS - 2];
+            }
+            if(!linalg_solve_lu(lu, rarray, N, M)) {
+                SCRATCH_RELEASE();
+                mp_raise_ValueError(translate("input matrix is singular"));
+            }
+            rarray += N * M;
+        }
+        SCRATCH_RELEASE();
+        return MP_OBJ_FROM_PTR(results);
+    }
+    #endif
+
+    ndarray_obj_t *A = tools_object_is_square(_A);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(A->dtype)
+    size_t N = A->shape[ULAB_MAX_DIMS - 1];
+
+    ndarray_obj_t *b = ndarray_from_mp_obj(_b, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
+    if(b->ndim > 2) {
+        mp_raise_ValueError(translate("operation is defined for 2D arrays only"));
+    }
+    if(b->shape[ULAB_MAX_DIMS - b->ndim] != N) {
+        mp_raise_ValueError(translate("dimensions do not match"));
+    }
+    // number of right-hand sides; a vector is treated as a single column
+    size_t M = b->ndim == 2 ? b->shape[ULAB_MAX_DIMS - 1] : 1;
+
+    ndarray_obj_t *results;
+    if(b->ndim == 2) {
+        results = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, N, M), NDARRAY_FLOAT);
+    } else {
+        results = ndarray_new_linear_array(N, NDARRAY_FLOAT);
+    }
+    mp_float_t *B = (mp_float_t *)results->array;
+
+    // copy the right-hand sides into the result array
+    mp_float_t (*bfunc)(void *) = ndarray_get_float_function(b->dtype);
+    uint8_t *barray = (uint8_t *)b->array;
+    for(size_t i = 0; i < N; i++) {
+        for(size_t m = 0; m < M; m++) {
+            *B++ = bfunc(barray);
+            barray += b->strides[ULAB_MAX_DIMS - 1];
+        }
+        if(b->ndim == 2) {
+            barray -= b->strides[ULAB_MAX_DIMS - 1] * M;
+            barray += b->strides[ULAB_MAX_DIMS - 2];
+        }
+    }
+    B -= N * M;
+
+    SCRATCH_ACQUIRE();
+    mp_float_t *lu = SCRATCH_NEW(mp_float_t, N * N);
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(A->dtype);
+    uint8_t *array = (uint8_t *)A->array;
+    for(size_t i = 0; i < N; i++) { // rows
+        for(size_t j = 0; j < N; j++) { // columns
+            *lu++ = func(array);
+            array += A->strides[ULAB_MAX_DIMS - 1];
+        }
+        array -= A->strides[ULAB_MAX_DIMS - 1] * N;
+        array += A->strides[ULAB_MAX_DIMS - 2];
+    }
+    lu -= N * N;
+
+    if(!linalg_solve_lu(lu, B, N, M)) {
+        SCRATCH_RELEASE();
+        mp_raise_ValueError(translate("input matrix is singular"));
+    }
+    SCRATCH_RELEASE();
+
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(linalg_solve_obj, linalg_solve);
+#endif
+#endif
+
 STATIC const mp_rom_map_elem_t ulab_linalg_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_linalg) },
     #if ULAB_MAX_DIMS > 1
@@ -518,12 +920,21 @@ STATIC const mp_rom_map_elem_t ulab_linalg_globals_table[] = {
         #if ULAB_LINALG_HAS_EIG
         { MP_ROM_QSTR(MP_QSTR_eig), MP_ROM_PTR(&linalg_eig_obj) },
         #endif
+        #if ULAB_LINALG_HAS_EIGVALS
+        { MP_ROM_QSTR(MP_QSTR_eigvals), MP_ROM_PTR(&linalg_eigvals_obj) },
+        #endif
         #if ULAB_LINALG_HAS_INV
         { MP_ROM_QSTR(MP_QSTR_inv), MP_ROM_PTR(&linalg_inv_obj) },
         #endif
+        #if ULAB_LINALG_HAS_LSTSQ
+        { MP_ROM_QSTR(MP_QSTR_lstsq), MP_ROM_PTR(&linalg_lstsq_obj) },
+        #endif
         #if ULAB_LINALG_HAS_QR
         { MP_ROM_QSTR(MP_QSTR_qr), MP_ROM_PTR(&linalg_qr_obj) },
         #endif
+        #if ULAB_LINALG_HAS_SOLVE
+        { MP_ROM_QSTR(MP_QSTR_solve), MP_ROM_PTR(&linalg_solve_obj) },
+        #endif
     #endif
     #if ULAB_LINALG_HAS_NORM
     { MP_ROM_QSTR(MP_QSTR_norm), MP_ROM_PTR(&linalg_norm_obj) },
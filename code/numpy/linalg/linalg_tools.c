@@ -168,3 +168,310 @@ size_t linalg_jacobi_rotations(mp_float_t *array, mp_float_t *eigvectors, size_t
 
     return iterations;
 }
+
+/*
+ * The following two functions together form the standard two-stage symmetric
+ * eigensolver: a Householder reduction to tridiagonal form, followed by the
+ * implicit-shift QL iteration on the tridiagonal matrix. Unlike the cyclic
+ * Jacobi rotations above, whose full sweeps touch all matrix entries over
+ * and over, the reduction is done once, and the QL iteration then works on
+ * two vectors only, so the pair scales much better beyond roughly 10x10.
+ * Like the other functions in this file, they have no dependencies beyond
+ * micropython itself.
+ */
+
+void linalg_householder_tridiagonal(mp_float_t *a, mp_float_t *d, mp_float_t *e, size_t S, bool vectors) {
+    // reduces the symmetric matrix a to tridiagonal form; on return d holds
+    // the diagonal, and e the sub-diagonal with e[0] = 0. If vectors is true,
+    // a is overwritten with the accumulated orthogonal transform, otherwise
+    // the contents of a are destroyed
+    mp_float_t f, g, h, hh, scale;
+
+    for(size_t i = S - 1; i > 0; i--) {
+        size_t l = i - 1;
+        h = scale = MICROPY_FLOAT_CONST(0.0);
+        if(l > 0) {
+            for(size_t k = 0; k <= l; k++) {
+                scale += MICROPY_FLOAT_C_FUN(fabs)(a[i * S + k]);
+            }
+            if(scale == MICROPY_FLOAT_CONST(0.0)) { // the row is already in the required form
+                e[i] = a[i * S + l];
+            } else {
+                for(size_t k = 0; k <= l; k++) {
+                    a[i * S + k] /= scale;
+                    h += a[i * S + k] * a[i * S + k];
+                }
+                f = a[i * S + l];
+                g = f >= MICROPY_FLOAT_CONST(0.0) ? -MICROPY_FLOAT_C_FUN(sqrt)(h) : MICROPY_FLOAT_C_FUN(sqrt)(h);
+                e[i] = scale * g;
+                h -= f * g;
+                a[i * S + l] = f - g; // the Householder vector is stored in the row
+                f = MICROPY_FLOAT_CONST(0.0);
+                for(size_t j = 0; j <= l; j++) {
+                    if(vectors) {
+                        a[j * S + i] = a[i * S + j] / h;
+                    }
+                    g = MICROPY_FLOAT_CONST(0.0);
+                    for(size_t k = 0; k <= j; k++) {
+                        g += a[j * S + k] * a[i * S + k];
+                    }
+                    for(size_t k = j + 1; k <= l; k++) {
+                        g += a[k * S + j] * a[i * S + k];
+                    }
+                    e[j] = g / h;
+                    f += e[j] * a[i * S + j];
+                }
+                hh = f / (h + h);
+                for(size_t j = 0; j <= l; j++) {
+                    f = a[i * S + j];
+                    e[j] = g = e[j] - hh * f;
+                    for(size_t k = 0; k <= j; k++) {
+                        a[j * S + k] -= f * e[k] + g * a[i * S + k];
+                    }
+                }
+            }
+        } else {
+            e[i] = a[i * S + l];
+        }
+        d[i] = h;
+    }
+    d[0] = MICROPY_FLOAT_CONST(0.0);
+    e[0] = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i = 0; i < S; i++) {
+        if(vectors) {
+            // accumulate the transformation in the columns of a
+            if(d[i] != MICROPY_FLOAT_CONST(0.0)) {
+                for(size_t j = 0; j < i; j++) {
+                    g = MICROPY_FLOAT_CONST(0.0);
+                    for(size_t k = 0; k < i; k++) {
+                        g += a[i * S + k] * a[k * S + j];
+                    }
+                    for(size_t k = 0; k < i; k++) {
+                        a[k * S + j] -= g * a[k * S + i];
+                    }
+                }
+            }
+            d[i] = a[i * S + i];
+            a[i * S + i] = MICROPY_FLOAT_CONST(1.0);
+            for(size_t j = 0; j < i; j++) {
+                a[j * S + i] = a[i * S + j] = MICROPY_FLOAT_CONST(0.0);
+            }
+        } else {
+            d[i] = a[i * S + i];
+        }
+    }
+}
+
+bool linalg_tridiagonal_ql(mp_float_t *d, mp_float_t *e, mp_float_t *z, size_t S) {
+    // implicit-shift QL iteration on the tridiagonal matrix held in d and e,
+    // as produced by linalg_householder_tridiagonal; on return d holds the
+    // eigenvalues. If z is not NULL, the rotations are accumulated in its
+    // columns, turning the tridiagonalising transform into the eigenvectors.
+    // Returns false, if the iteration did not converge
+    mp_float_t b, c, f, g, p, r, s;
+
+    for(size_t i = 1; i < S; i++) {
+        e[i - 1] = e[i];
+    }
+    e[S - 1] = MICROPY_FLOAT_CONST(0.0);
+
+    for(size_t l = 0; l < S; l++) {
+        size_t iterations = 0;
+        size_t m;
+        do {
+            for(m = l; m < S - 1; m++) {
+                // look for a negligible sub-diagonal element to split the matrix
+                mp_float_t dd = MICROPY_FLOAT_C_FUN(fabs)(d[m]) + MICROPY_FLOAT_C_FUN(fabs)(d[m + 1]);
+                if(MICROPY_FLOAT_C_FUN(fabs)(e[m]) <= LINALG_EPSILON * dd) {
+                    break;
+                }
+            }
+            if(m != l) {
+                if(iterations++ == QL_MAX) {
+                    return false;
+                }
+                g = (d[l + 1] - d[l]) / (MICROPY_FLOAT_CONST(2.0) * e[l]); // the shift
+                r = MICROPY_FLOAT_C_FUN(sqrt)(g * g + MICROPY_FLOAT_CONST(1.0));
+                g = d[m] - d[l] + e[l] / (g + (g >= MICROPY_FLOAT_CONST(0.0) ? r : -r));
+                s = c = MICROPY_FLOAT_CONST(1.0);
+                p = MICROPY_FLOAT_CONST(0.0);
+                bool underflow = false;
+                for(size_t i = m; i > l; i--) {
+                    f = s * e[i - 1];
+                    b = c * e[i - 1];
+                    r = MICROPY_FLOAT_C_FUN(sqrt)(f * f + g * g);
+                    e[i] = r;
+                    if(r == MICROPY_FLOAT_CONST(0.0)) {
+                        // recover from an underflow by restarting the sweep
+                        d[i] -= p;
+                        e[m] = MICROPY_FLOAT_CONST(0.0);
+                        underflow = true;
+                        break;
+                    }
+                    s = f / r;
+                    c = g / r;
+                    g = d[i] - p;
+                    r = (d[i - 1] - g) * s + MICROPY_FLOAT_CONST(2.0) * c * b;
+                    p = s * r;
+                    d[i] = g + p;
+                    g = c * r - b;
+                    if(z != NULL) {
+                        for(size_t k = 0; k < S; k++) {
+                            f = z[k * S + i];
+                            z[k * S + i] = s * z[k * S + i - 1] + c * f;
+                            z[k * S + i - 1] = c * z[k * S + i - 1] - s * f;
+                        }
+                    }
+                }
+                if(underflow) {
+                    continue;
+                }
+                d[l] -= p;
+                e[l] = g;
+                e[m] = MICROPY_FLOAT_CONST(0.0);
+            }
+        } while(m != l);
+    }
+    return true;
+}
+
+/*
+ * The following function solves the overdetermined system a x = b in the
+ * least-squares sense by Householder QR factorisation. The reflectors are
+ * applied in place, one column at a time, so neither Q, nor the product
+ * a^T a is ever formed, which is both faster, and numerically much better
+ * conditioned than solving the normal equations.
+ */
+
+bool linalg_qr_solve(mp_float_t *a, mp_float_t *b, size_t m, size_t n) {
+    // a is a matrix of shape (m, n) with m >= n, b a vector of length m;
+    // on return the first n entries of b hold the solution. The contents
+    // of a are destroyed. Returns false, if a is rank deficient
+    for(size_t k = 0; k < n; k++) {
+        mp_float_t sigma = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i = k; i < m; i++) {
+            sigma += a[i * n + k] * a[i * n + k];
+        }
+        sigma = MICROPY_FLOAT_C_FUN(sqrt)(sigma);
+        if(sigma < LINALG_EPSILON) {
+            return false;
+        }
+        // the sign is chosen so that the subtraction below cannot cancel
+        mp_float_t alpha = a[k * n + k] >= MICROPY_FLOAT_CONST(0.0) ? -sigma : sigma;
+        a[k * n + k] -= alpha; // column k now holds the Householder vector
+        mp_float_t vtv = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i = k; i < m; i++) {
+            vtv += a[i * n + k] * a[i * n + k];
+        }
+        // apply the reflector to the remaining columns, and to the right-hand side
+        for(size_t j = k + 1; j < n; j++) {
+            mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+            for(size_t i = k; i < m; i++) {
+                dot += a[i * n + k] * a[i * n + j];
+            }
+            dot = MICROPY_FLOAT_CONST(2.0) * dot / vtv;
+            for(size_t i = k; i < m; i++) {
+                a[i * n + j] -= dot * a[i * n + k];
+            }
+        }
+        mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i = k; i < m; i++) {
+            dot += a[i * n + k] * b[i];
+        }
+        dot = MICROPY_FLOAT_CONST(2.0) * dot / vtv;
+        for(size_t i = k; i < m; i++) {
+            b[i] -= dot * a[i * n + k];
+        }
+        a[k * n + k] = alpha; // the diagonal entry of R
+    }
+
+    // back substitution in the upper triangle, which now holds R
+    for(size_t k = n; k > 0; k--) {
+        mp_float_t sum = b[k - 1];
+        for(size_t j = k; j < n; j++) {
+            sum -= a[(k - 1) * n + j] * b[j];
+        }
+        b[k - 1] = sum / a[(k - 1) * n + (k - 1)];
+    }
+    return true;
+}
+
+/*
+ * Unrolled cofactor inverses for 2x2, 3x3, and 4x4 matrices. These run in
+ * a fraction of the time of the general elimination above, which matters,
+ * when whole batches of small matrices are inverted in one call.
+ */
+
+bool linalg_invert_small(mp_float_t *a, size_t N) {
+    // inverts the matrix in place; returns false, if the matrix is singular
+    mp_float_t det;
+    if(N == 2) {
+        det = a[0] * a[3] - a[1] * a[2];
+        if(MICROPY_FLOAT_C_FUN(fabs)(det) < LINALG_EPSILON) {
+            return false;
+        }
+        det = MICROPY_FLOAT_CONST(1.0) / det;
+        mp_float_t t = a[0];
+        a[0] = a[3] * det;
+        a[3] = t * det;
+        a[1] = -a[1] * det;
+        a[2] = -a[2] * det;
+    } else if(N == 3) {
+        det = a[0] * (a[4] * a[8] - a[5] * a[7])
+            - a[1] * (a[3] * a[8] - a[5] * a[6])
+            + a[2] * (a[3] * a[7] - a[4] * a[6]);
+        if(MICROPY_FLOAT_C_FUN(fabs)(det) < LINALG_EPSILON) {
+            return false;
+        }
+        det = MICROPY_FLOAT_CONST(1.0) / det;
+        mp_float_t b[9];
+        b[0] = (a[4] * a[8] - a[5] * a[7]) * det;
+        b[1] = (a[2] * a[7] - a[1] * a[8]) * det;
+        b[2] = (a[1] * a[5] - a[2] * a[4]) * det;
+        b[3] = (a[5] * a[6] - a[3] * a[8]) * det;
+        b[4] = (a[0] * a[8] - a[2] * a[6]) * det;
+        b[5] = (a[2] * a[3] - a[0] * a[5]) * det;
+        b[6] = (a[3] * a[7] - a[4] * a[6]) * det;
+        b[7] = (a[1] * a[6] - a[0] * a[7]) * det;
+        b[8] = (a[0] * a[4] - a[1] * a[3]) * det;
+        memcpy(a, b, 9 * sizeof(mp_float_t));
+    } else { // N == 4
+        // 2x2 sub-determinants of the upper, and the lower half
+        mp_float_t s0 = a[0] * a[5] - a[4] * a[1];
+        mp_float_t s1 = a[0] * a[6] - a[4] * a[2];
+        mp_float_t s2 = a[0] * a[7] - a[4] * a[3];
+        mp_float_t s3 = a[1] * a[6] - a[5] * a[2];
+        mp_float_t s4 = a[1] * a[7] - a[5] * a[3];
+        mp_float_t s5 = a[2] * a[7] - a[6] * a[3];
+        mp_float_t c5 = a[10] * a[15] - a[14] * a[11];
+        mp_float_t c4 = a[9] * a[15] - a[13] * a[11];
+        mp_float_t c3 = a[9] * a[14] - a[13] * a[10];
+        mp_float_t c2 = a[8] * a[15] - a[12] * a[11];
+        mp_float_t c1 = a[8] * a[14] - a[12] * a[10];
+        mp_float_t c0 = a[8] * a[13] - a[12] * a[9];
+        det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if(MICROPY_FLOAT_C_FUN(fabs)(det) < LINALG_EPSILON) {
+            return false;
+        }
+        det = MICROPY_FLOAT_CONST(1.0) / det;
+        mp_float_t b[16];
+        b[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) * det;
+        b[1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * det;
+        b[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) * det;
+        b[3] = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * det;
+        b[4] = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * det;
+        b[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * det;
+        b[6] = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * det;
+        b[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) * det;
+        b[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) * det;
+        b[9] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * det;
+        b[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * det;
+        b[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * det;
+        b[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * det;
+        b[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * det;
+        b[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * det;
+        b[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * det;
+        memcpy(a, b, 16 * sizeof(mp_float_t));
+    }
+    return true;
+}
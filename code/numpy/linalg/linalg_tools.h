@@ -20,9 +20,18 @@
 #endif /* LINALG_EPSILON */
 
 #define JACOBI_MAX     20
+// matrices up to this size are diagonalised with the Jacobi rotations,
+// larger ones with the tridiagonal QL iteration
+#define JACOBI_CUTOFF  8
+// maximum number of QL iterations per eigenvalue
+#define QL_MAX         30
 
 bool linalg_invert_matrix(mp_float_t *, size_t );
+bool linalg_invert_small(mp_float_t *, size_t );
 size_t linalg_jacobi_rotations(mp_float_t *, mp_float_t *, size_t );
+bool linalg_qr_solve(mp_float_t *, mp_float_t *, size_t , size_t );
+void linalg_householder_tridiagonal(mp_float_t *, mp_float_t *, mp_float_t *, size_t , bool );
+bool linalg_tridiagonal_ql(mp_float_t *, mp_float_t *, mp_float_t *, size_t );
 
 #endif /* _TOOLS_TOOLS_ */
 
@@ -17,6 +17,7 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "../../ulab_tools.h"
 #include "ndarray_iter.h"
 
 #ifdef NDARRAY_HAS_FLATITER
@@ -63,4 +64,69 @@ mp_obj_t ndarray_new_flatiterator(mp_obj_t flatiter_in, mp_obj_iter_buf_t *iter_
 mp_obj_t ndarray_get_flatiterator(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf) {
     return ndarray_new_flatiterator(o_in, iter_buf);
 }
+
+// copies up to count elements, beginning at the flat index *cur, into the
+// contiguous buffer, and advances *cur; returns the number of elements
+// copied. This is the buffered counterpart of ndarray_flatiter_next:
+// instead of boxing one element per call, generic code paths without a
+// strided fast path of their own can traverse any array in contiguous,
+// cache-friendly chunks of raw dtype values
+size_t ndarray_flatiter_fill(ndarray_obj_t *ndarray, size_t *cur, uint8_t *buffer, size_t count) {
+    if(*cur >= ndarray->len) {
+        return 0;
+    }
+    if(count > ndarray->len - *cur) {
+        count = ndarray->len - *cur;
+    }
+    if(ndarray_is_dense(ndarray)) {
+        memcpy(buffer, (uint8_t *)ndarray->array + *cur * ndarray->itemsize, count * ndarray->itemsize);
+        *cur += count;
+        return count;
+    }
+    // decode the flat index into coordinates once, then advance with carries
+    size_t coords[ULAB_MAX_DIMS];
+    size_t remainder = *cur;
+    uint8_t *array = (uint8_t *)ndarray->array;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        coords[i-1] = remainder % ndarray->shape[i-1];
+        remainder /= ndarray->shape[i-1];
+        array += coords[i-1] * ndarray->strides[i-1];
+    }
+    for(size_t copied = 0; copied < count; copied++) {
+        memcpy(buffer, array, ndarray->itemsize);
+        buffer += ndarray->itemsize;
+        uint8_t i = ULAB_MAX_DIMS - 1;
+        array += ndarray->strides[i];
+        coords[i]++;
+        while((coords[i] == ndarray->shape[i]) && (i > ULAB_MAX_DIMS - ndarray->ndim)) {
+            array -= ndarray->shape[i] * ndarray->strides[i];
+            coords[i] = 0;
+            i--;
+            array += ndarray->strides[i];
+            coords[i]++;
+        }
+    }
+    *cur += count;
+    return count;
+}
+
+// fills the dense out array with the next out->len elements of the
+// iterated array, without creating Python objects for the elements,
+// and returns the number of elements written; a short count signals
+// that the source is exhausted
+mp_obj_t ndarray_flatiter_next_into(mp_obj_t self_in, mp_obj_t out_in) {
+    ndarray_flatiter_t *self = MP_OBJ_TO_PTR(self_in);
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(self->ndarray);
+    if(!mp_obj_is_type(out_in, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(out_in);
+    if((out->dtype != ndarray->dtype) || !ndarray_is_dense(out)) {
+        mp_raise_ValueError(translate("out must be a dense array of the source's dtype"));
+    }
+    size_t count = ndarray_flatiter_fill(ndarray, &self->cur, (uint8_t *)out->array, out->len);
+    return mp_obj_new_int(count);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(ndarray_flatiter_next_into_obj, ndarray_flatiter_next_into);
 #endif /* NDARRAY_HAS_FLATITER */
@@ -32,5 +32,9 @@ typedef struct _mp_obj_ndarray_flatiter_t {
 mp_obj_t ndarray_get_flatiterator(mp_obj_t , mp_obj_iter_buf_t *);
 mp_obj_t ndarray_flatiter_make_new(mp_obj_t );
 mp_obj_t ndarray_flatiter_next(mp_obj_t );
+size_t ndarray_flatiter_fill(ndarray_obj_t * , size_t * , uint8_t * , size_t );
+mp_obj_t ndarray_flatiter_next_into(mp_obj_t , mp_obj_t );
+
+MP_DECLARE_CONST_FUN_OBJ_2(ndarray_flatiter_next_into_obj);
 
 #endif
\ No newline at end of file
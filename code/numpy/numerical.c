@@ -25,11 +25,25 @@
 #include "./carray/carray_tools.h"
 #include "numerical.h"
 
+#if ULAB_SUPPORTS_FLOAT16
+// float16 is a storage dtype: the typed kernels in this module dispatch on
+// the dtype, and fall through to an mp_float_t arm, so half-precision input
+// is widened to the float dtype here, before entering the dispatch
+#define FLOAT16_WIDEN_TO_FLOAT(ndarray) \
+    if((ndarray)->dtype == NDARRAY_FLOAT16) { \
+        (ndarray) = ndarray_copy_view_convert_type((ndarray), NDARRAY_FLOAT); \
+    }
+#else
+#define FLOAT16_WIDEN_TO_FLOAT(ndarray)
+#endif
+
 enum NUMERICAL_FUNCTION_TYPE {
     NUMERICAL_ALL,
     NUMERICAL_ANY,
     NUMERICAL_ARGMAX,
     NUMERICAL_ARGMIN,
+    NUMERICAL_CUMPROD,
+    NUMERICAL_CUMSUM,
     NUMERICAL_MAX,
     NUMERICAL_MEAN,
     NUMERICAL_MIN,
@@ -246,6 +260,157 @@ static mp_obj_t numerical_all_any(mp_obj_t oin, mp_obj_t axis, uint8_t optype) {
 #endif
 
 #if ULAB_NUMPY_HAS_SUM | ULAB_NUMPY_HAS_MEAN | ULAB_NUMPY_HAS_STD
+#if ULAB_NUMERICAL_USES_PAIRWISE_SUM
+// Ranges longer than the block size are split in half, and the two halves
+// are reduced recursively, so that the rounding error grows only with the
+// logarithm of the number of samples; the recursion depth is log2(n/block)
+#define NUMERICAL_PAIRWISE_BLOCKSIZE    (128)
+
+static mp_float_t numerical_pairwise_sum(uint8_t *array, size_t count, int32_t stride) {
+    if(count > NUMERICAL_PAIRWISE_BLOCKSIZE) {
+        size_t half = count / 2;
+        return numerical_pairwise_sum(array, half, stride) +
+                numerical_pairwise_sum(array + half * stride, count - half, stride);
+    }
+    // eight independent accumulators in the leaf block, so that the additions
+    // do not form a single serial dependency chain on dual-issue cores
+    mp_float_t s0 = MICROPY_FLOAT_CONST(0.0), s1 = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t s2 = MICROPY_FLOAT_CONST(0.0), s3 = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t s4 = MICROPY_FLOAT_CONST(0.0), s5 = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t s6 = MICROPY_FLOAT_CONST(0.0), s7 = MICROPY_FLOAT_CONST(0.0);
+    while(count >= 8) {
+        s0 += *(mp_float_t *)array; array += stride;
+        s1 += *(mp_float_t *)array; array += stride;
+        s2 += *(mp_float_t *)array; array += stride;
+        s3 += *(mp_float_t *)array; array += stride;
+        s4 += *(mp_float_t *)array; array += stride;
+        s5 += *(mp_float_t *)array; array += stride;
+        s6 += *(mp_float_t *)array; array += stride;
+        s7 += *(mp_float_t *)array; array += stride;
+        count -= 8;
+    }
+    while(count--) {
+        s0 += *(mp_float_t *)array;
+        array += stride;
+    }
+    return ((s0 + s1) + (s2 + s3)) + ((s4 + s5) + (s6 + s7));
+}
+
+// same reduction over the squared deviations from the mean; this is the
+// second pass of the two-pass standard deviation
+static mp_float_t numerical_pairwise_squared_sum(uint8_t *array, size_t count, int32_t stride, mp_float_t mean) {
+    if(count > NUMERICAL_PAIRWISE_BLOCKSIZE) {
+        size_t half = count / 2;
+        return numerical_pairwise_squared_sum(array, half, stride, mean) +
+                numerical_pairwise_squared_sum(array + half * stride, count - half, stride, mean);
+    }
+    mp_float_t s0 = MICROPY_FLOAT_CONST(0.0), s1 = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t value;
+    while(count >= 2) {
+        value = *(mp_float_t *)array - mean;
+        s0 += value * value;
+        array += stride;
+        value = *(mp_float_t *)array - mean;
+        s1 += value * value;
+        array += stride;
+        count -= 2;
+    }
+    if(count) {
+        value = *(mp_float_t *)array - mean;
+        s0 += value * value;
+    }
+    return s0 + s1;
+}
+
+// pairwise reduction of the flattened array: the innermost rows are summed
+// pairwise, and the row totals are collected over the outer dimensions
+static mp_float_t numerical_pairwise_flat(uint8_t *array, shape_strides *ss, mp_float_t mean, uint8_t squared) {
+    mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                if(squared) {
+                    sum += numerical_pairwise_squared_sum(array, ss->shape[ULAB_MAX_DIMS - 1], ss->strides[ULAB_MAX_DIMS - 1], mean);
+                } else {
+                    sum += numerical_pairwise_sum(array, ss->shape[ULAB_MAX_DIMS - 1], ss->strides[ULAB_MAX_DIMS - 1]);
+                }
+            #if ULAB_MAX_DIMS > 1
+                array += ss->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < ss->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= ss->strides[ULAB_MAX_DIMS - 2] * ss->shape[ULAB_MAX_DIMS - 2];
+            array += ss->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < ss->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= ss->strides[ULAB_MAX_DIMS - 3] * ss->shape[ULAB_MAX_DIMS - 3];
+        array += ss->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < ss->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    return sum;
+}
+
+// pairwise reduction along a single axis: the contracted dimension sits at
+// the zeroth position of ss (tools_reduce_axes), one output value per lane
+static void numerical_pairwise_reduce_axis(uint8_t *array, shape_strides *ss, mp_float_t *farray, mp_float_t div, uint8_t optype) {
+    #if ULAB_MAX_DIMS > 3
+    size_t j = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t k = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                mp_float_t sum = numerical_pairwise_sum(array, ss->shape[0], ss->strides[0]);
+                if(optype == NUMERICAL_SUM) {
+                    *farray++ = sum;
+                } else {
+                    mp_float_t mean = ss->shape[0] == 0 ? MICROPY_FLOAT_CONST(0.0) : sum / (mp_float_t)ss->shape[0];
+                    if(optype == NUMERICAL_MEAN) {
+                        *farray++ = mean;
+                    } else {
+                        *farray++ = MICROPY_FLOAT_C_FUN(sqrt)(numerical_pairwise_squared_sum(array, ss->shape[0], ss->strides[0], mean) / div);
+                    }
+                }
+            #if ULAB_MAX_DIMS > 1
+                array += ss->strides[ULAB_MAX_DIMS - 1];
+                l++;
+            } while(l < ss->shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= ss->strides[ULAB_MAX_DIMS - 1] * ss->shape[ULAB_MAX_DIMS - 1];
+            array += ss->strides[ULAB_MAX_DIMS - 2];
+            k++;
+        } while(k < ss->shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= ss->strides[ULAB_MAX_DIMS - 2] * ss->shape[ULAB_MAX_DIMS - 2];
+        array += ss->strides[ULAB_MAX_DIMS - 3];
+        j++;
+    } while(j < ss->shape[ULAB_MAX_DIMS - 3]);
+    #endif
+}
+#endif /* ULAB_NUMERICAL_USES_PAIRWISE_SUM */
+
 static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, size_t ddof) {
     mp_float_t value = MICROPY_FLOAT_CONST(0.0);
     mp_float_t M = MICROPY_FLOAT_CONST(0.0);
@@ -274,6 +439,7 @@ static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, si
 
 static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, uint8_t optype, size_t ddof) {
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_WIDEN_TO_FLOAT(ndarray)
     uint8_t *array = (uint8_t *)ndarray->array;
     shape_strides _shape_strides = tools_reduce_axes(ndarray, axis);
 
@@ -283,6 +449,22 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             // if there are too many degrees of freedom, there is no point in calculating anything
             return mp_obj_new_float(MICROPY_FLOAT_CONST(0.0));
         }
+        #if ULAB_NUMERICAL_USES_PAIRWISE_SUM
+        if(ndarray->dtype == NDARRAY_FLOAT) {
+            mp_float_t sum = numerical_pairwise_flat(array, &_shape_strides, MICROPY_FLOAT_CONST(0.0), 0);
+            if(optype == NUMERICAL_SUM) {
+                return mp_obj_new_float(sum);
+            }
+            mp_float_t mean = ndarray->len == 0 ? MICROPY_FLOAT_CONST(0.0) : sum / (mp_float_t)ndarray->len;
+            if(optype == NUMERICAL_MEAN) {
+                return mp_obj_new_float(mean);
+            }
+            // the standard deviation takes a second pass over the deviations from the mean
+            mp_float_t S = numerical_pairwise_flat(array, &_shape_strides, mean, 1);
+            // we have already made certain that ddof < ndarray->len holds
+            return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(S / (ndarray->len - ddof)));
+        }
+        #endif
         mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
         mp_float_t M = MICROPY_FLOAT_CONST(0.0);
         mp_float_t m = MICROPY_FLOAT_CONST(0.0);
@@ -363,9 +545,12 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             } else if(ndarray->dtype == NDARRAY_INT16) {
                 RUN_SUM(int16_t, array, results, rarray, _shape_strides);
             } else {
+                farray = (mp_float_t *)results->array;
+                #if ULAB_NUMERICAL_USES_PAIRWISE_SUM
+                numerical_pairwise_reduce_axis(array, &_shape_strides, farray, MICROPY_FLOAT_CONST(0.0), NUMERICAL_SUM);
+                #else
                 // for floats, the sum might be inaccurate with the naive summation
                 // call mean, and multiply with the number of samples
-                farray = (mp_float_t *)results->array;
                 RUN_MEAN_STD(mp_float_t, array, farray, _shape_strides, MICROPY_FLOAT_CONST(0.0), 0);
                 mp_float_t norm = (mp_float_t)_shape_strides.shape[0];
                 // re-wind the array here
@@ -373,6 +558,7 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
                 for(size_t i=0; i < results->len; i++) {
                     *farray++ *= norm;
                 }
+                #endif
             }
         } else {
             bool isStd = optype == NUMERICAL_STD ? 1 : 0;
@@ -392,7 +578,11 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             } else if(ndarray->dtype == NDARRAY_INT16) {
                 RUN_MEAN_STD(int16_t, array, farray, _shape_strides, div, isStd);
             } else {
+                #if ULAB_NUMERICAL_USES_PAIRWISE_SUM
+                numerical_pairwise_reduce_axis(array, &_shape_strides, farray, div, optype);
+                #else
                 RUN_MEAN_STD(mp_float_t, array, farray, _shape_strides, div, isStd);
+                #endif
             }
         }
         if(results->ndim == 0) { // return a scalar here
@@ -444,6 +634,7 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
     if(ndarray->len == 0) {
         mp_raise_ValueError(translate("attempt to get (arg)min/(arg)max of empty sequence"));
     }
+    FLOAT16_WIDEN_TO_FLOAT(ndarray)
 
     if(axis == mp_const_none) {
         // work with the flattened array
@@ -453,6 +644,21 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         mp_float_t value;
         size_t index = 0, best_index = 0;
 
+        uint8_t op = ((optype == NUMERICAL_ARGMAX) || (optype == NUMERICAL_MAX)) ? 1 : 0;
+        if(ndarray_is_dense(ndarray)) {
+            // dense arrays can be scanned with the unrolled contiguous kernel
+            if(ndarray->dtype == NDARRAY_UINT8) {
+                RUN_ARGMINMAX1(uint8_t, array, ndarray->len, op, best_index, best_value);
+            } else if(ndarray->dtype == NDARRAY_INT8) {
+                RUN_ARGMINMAX1(int8_t, array, ndarray->len, op, best_index, best_value);
+            } else if(ndarray->dtype == NDARRAY_UINT16) {
+                RUN_ARGMINMAX1(uint16_t, array, ndarray->len, op, best_index, best_value);
+            } else if(ndarray->dtype == NDARRAY_INT16) {
+                RUN_ARGMINMAX1(int16_t, array, ndarray->len, op, best_index, best_value);
+            } else {
+                RUN_ARGMINMAX1(mp_float_t, array, ndarray->len, op, best_index, best_value);
+            }
+        } else {
         #if ULAB_MAX_DIMS > 3
         size_t i = 0;
         do {
@@ -501,6 +707,7 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             i++;
         } while(i < ndarray->shape[ULAB_MAX_DIMS - 4]);
         #endif
+        }
 
         if((optype == NUMERICAL_ARGMIN) || (optype == NUMERICAL_ARGMAX)) {
             return mp_obj_new_int(best_index);
@@ -515,8 +722,9 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         int8_t ax = tools_get_axis(axis, ndarray->ndim);
 
         uint8_t *array = (uint8_t *)ndarray->array;
-        size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-        int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+        SCRATCH_ACQUIRE();
+        size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+        int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
 
         numerical_reduce_axes(ndarray, ax, shape, strides);
         uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
@@ -543,7 +751,7 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             RUN_ARGMIN(ndarray, mp_float_t, array, results, rarray, shape, strides, index, optype);
         }
 
-        m_del(int32_t, strides, ULAB_MAX_DIMS);
+        SCRATCH_RELEASE();
 
         if(results->len == 1) {
             return mp_binary_get_val_array(results->dtype, results->array, 0);
@@ -609,6 +817,163 @@ static mp_obj_t numerical_function(size_t n_args, const mp_obj_t *pos_args, mp_m
 }
 
 #if ULAB_NUMPY_HAS_SORT | NDARRAY_HAS_SORT
+#if ULAB_NUMERICAL_USES_RADIX_SORT
+// single counting pass for the 8-bit dtypes: the lane is simply rewritten
+// from the histogram; signed values are biased with the sign bit, so that
+// they can be counted as unsigned
+static void numerical_radix_sort8(uint8_t *array, int32_t increment, size_t N, size_t *count, uint8_t bias) {
+    memset(count, 0, 256 * sizeof(size_t));
+    uint8_t *source = array;
+    for(size_t i = 0; i < N; i++) {
+        count[*source ^ bias]++;
+        source += increment;
+    }
+    for(uint16_t d = 0; d < 256; d++) {
+        size_t c = count[d];
+        uint8_t value = (uint8_t)d ^ bias;
+        while(c--) {
+            *array = value;
+            array += increment;
+        }
+    }
+}
+
+// two stable LSD byte passes for the 16-bit dtypes: low byte from the lane
+// into the contiguous swap buffer, then sign-corrected high byte back into
+// the lane
+static void numerical_radix_sort16(uint16_t *array, int32_t increment, size_t N, uint16_t *buffer, size_t *count, uint16_t bias) {
+    memset(count, 0, 256 * sizeof(size_t));
+    uint16_t *source = array;
+    for(size_t i = 0; i < N; i++) {
+        count[*source & 0xff]++;
+        source += increment;
+    }
+    size_t offset = 0;
+    for(uint16_t d = 0; d < 256; d++) {
+        size_t c = count[d];
+        count[d] = offset;
+        offset += c;
+    }
+    source = array;
+    for(size_t i = 0; i < N; i++) {
+        buffer[count[*source & 0xff]++] = *source;
+        source += increment;
+    }
+    memset(count, 0, 256 * sizeof(size_t));
+    for(size_t i = 0; i < N; i++) {
+        count[(uint16_t)(buffer[i] ^ bias) >> 8]++;
+    }
+    offset = 0;
+    for(uint16_t d = 0; d < 256; d++) {
+        size_t c = count[d];
+        count[d] = offset;
+        offset += c;
+    }
+    for(size_t i = 0; i < N; i++) {
+        array[count[(uint16_t)(buffer[i] ^ bias) >> 8]++ * increment] = buffer[i];
+    }
+}
+
+static void numerical_radix_sort_lanes(ndarray_obj_t *ndarray, size_t *shape, int32_t *strides, uint8_t ax, int32_t increment, uint16_t *buffer, size_t *count) {
+    uint8_t *array = (uint8_t *)ndarray->array;
+    size_t N = ndarray->shape[ax];
+
+    #if ULAB_MAX_DIMS > 3
+    size_t j = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t k = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                if(ndarray->itemsize == 1) {
+                    numerical_radix_sort8(array, increment, N, count, ndarray->dtype == NDARRAY_INT8 ? 0x80 : 0x00);
+                } else {
+                    numerical_radix_sort16((uint16_t *)array, increment, N, buffer, count, ndarray->dtype == NDARRAY_INT16 ? 0x8000 : 0x0000);
+                }
+            #if ULAB_MAX_DIMS > 1
+                array += strides[ULAB_MAX_DIMS - 1];
+                l++;
+            } while(l < shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            array += strides[ULAB_MAX_DIMS - 2];
+            k++;
+        } while(k < shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        array += strides[ULAB_MAX_DIMS - 3];
+        j++;
+    } while(j < shape[ULAB_MAX_DIMS - 3]);
+    #endif
+}
+#endif /* ULAB_NUMERICAL_USES_RADIX_SORT */
+
+// lanes at most this long are sorted with the strided insertion sort, which
+// needs no scratch memory at all, and beats both the heapsort and the radix
+// sort on short lanes
+#define NUMERICAL_SORT_INSERTION_THRESHOLD  (16)
+
+// strided insertion sort: sorts a single lane in place through the view's
+// strides; comparisons go through the float accessor, which is exact for
+// all integer dtypes, items are moved bytewise
+static void numerical_insertion_sort(uint8_t *array, int32_t stride, size_t N, uint8_t itemsize, mp_float_t (*func)(void *)) {
+    uint8_t tmp[sizeof(mp_float_t)];
+    for(mp_int_t i = 1; i < (mp_int_t)N; i++) {
+        mp_float_t value = func(array + i * stride);
+        memcpy(tmp, array + i * stride, itemsize);
+        mp_int_t j = i;
+        while((j > 0) && (func(array + (j - 1) * stride) > value)) {
+            memcpy(array + j * stride, array + (j - 1) * stride, itemsize);
+            j--;
+        }
+        memcpy(array + j * stride, tmp, itemsize);
+    }
+}
+
+static void numerical_insertion_sort_lanes(ndarray_obj_t *ndarray, size_t *shape, int32_t *strides, uint8_t ax) {
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    size_t N = ndarray->shape[ax];
+
+    #if ULAB_MAX_DIMS > 3
+    size_t j = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t k = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                numerical_insertion_sort(array, ndarray->strides[ax], N, ndarray->itemsize, func);
+            #if ULAB_MAX_DIMS > 1
+                array += strides[ULAB_MAX_DIMS - 1];
+                l++;
+            } while(l < shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            array += strides[ULAB_MAX_DIMS - 2];
+            k++;
+        } while(k < shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        array += strides[ULAB_MAX_DIMS - 3];
+        j++;
+    } while(j < shape[ULAB_MAX_DIMS - 3]);
+    #endif
+}
+
 static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inplace) {
     if(!mp_obj_is_type(oin, &ulab_ndarray_type)) {
         mp_raise_TypeError(translate("sort argument must be an ndarray"));
@@ -638,8 +1003,9 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
         ax = tools_get_axis(axis, ndarray->ndim);
     }
 
-    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-    int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+    SCRATCH_ACQUIRE();
+    size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+    int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
 
     numerical_reduce_axes(ndarray, ax, shape, strides);
     ax = ULAB_MAX_DIMS - ndarray->ndim + ax;
@@ -647,7 +1013,35 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
     int32_t increment = ndarray->strides[ax] / ndarray->itemsize;
 
     uint8_t *array = (uint8_t *)ndarray->array;
-    if(ndarray->shape[ax]) {
+    #if ULAB_SUPPORTS_FLOAT16
+    if(ndarray->dtype == NDARRAY_FLOAT16) {
+        // half floats cannot be radix-sorted as integer bit patterns, and the
+        // typed heapsort has no two-byte float arm; the insertion sort
+        // compares through the float accessor, and moves the items bytewise
+        if(ndarray->shape[ax] > 1) {
+            numerical_insertion_sort_lanes(ndarray, shape, strides, ax);
+        }
+    } else
+    #endif
+    if(ndarray->shape[ax] <= NUMERICAL_SORT_INSERTION_THRESHOLD) {
+        // short lanes (e.g., the rows of a tall telemetry matrix) are sorted
+        // in place through the view's strides, without touching the scratch pool
+        if(ndarray->shape[ax] > 1) {
+            numerical_insertion_sort_lanes(ndarray, shape, strides, ax);
+        }
+    } else {
+        #if ULAB_NUMERICAL_USES_RADIX_SORT
+        if(ndarray->dtype != NDARRAY_FLOAT) {
+            size_t *count = SCRATCH_NEW(size_t, 256);
+            uint16_t *buffer = NULL;
+            if(ndarray->itemsize == 2) {
+                buffer = SCRATCH_NEW(uint16_t, ndarray->shape[ax]);
+            }
+            numerical_radix_sort_lanes(ndarray, shape, strides, ax, increment, buffer, count);
+        } else {
+            HEAPSORT(ndarray, mp_float_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
+        }
+        #else
         if((ndarray->dtype == NDARRAY_UINT8) || (ndarray->dtype == NDARRAY_INT8)) {
             HEAPSORT(ndarray, uint8_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
         } else if((ndarray->dtype == NDARRAY_INT16) || (ndarray->dtype == NDARRAY_INT16)) {
@@ -655,9 +1049,10 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
         } else {
             HEAPSORT(ndarray, mp_float_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
         }
+        #endif
     }
 
-    m_del(int32_t, strides, ULAB_MAX_DIMS);
+    SCRATCH_RELEASE();
 
     if(inplace == 1) {
         return mp_const_none;
@@ -724,6 +1119,8 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    // only the indices are returned, so half floats can simply be widened
+    FLOAT16_WIDEN_TO_FLOAT(ndarray)
     if(args[1].u_obj == mp_const_none) {
         // bail out, though dense arrays could still be sorted
         mp_raise_NotImplementedError(translate("argsort is not implemented for flattened arrays"));
@@ -737,13 +1134,14 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
     }
     int8_t ax = tools_get_axis(args[1].u_obj, ndarray->ndim);
 
-    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-    int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+    SCRATCH_ACQUIRE();
+    size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+    int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
     numerical_reduce_axes(ndarray, ax, shape, strides);
 
     // We could return an NDARRAY_UINT8 array, if all lengths are shorter than 256
     ndarray_obj_t *indices = ndarray_new_ndarray(ndarray->ndim, ndarray->shape, NULL, NDARRAY_UINT16);
-    int32_t *istrides = m_new0(int32_t, ULAB_MAX_DIMS);
+    int32_t *istrides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
     numerical_reduce_axes(indices, ax, shape, istrides);
 
     for(uint8_t i=0; i < ULAB_MAX_DIMS; i++) {
@@ -807,9 +1205,7 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         }
     }
 
-    m_del(size_t, shape, ULAB_MAX_DIMS);
-    m_del(int32_t, strides, ULAB_MAX_DIMS);
-    m_del(int32_t, istrides, ULAB_MAX_DIMS);
+    SCRATCH_RELEASE();
 
     return MP_OBJ_FROM_PTR(indices);
 }
@@ -858,6 +1254,11 @@ static mp_obj_t numerical_cross(mp_obj_t _a, mp_obj_t _b) {
     */
 
     uint8_t dtype = NDARRAY_FLOAT;
+    #if ULAB_SUPPORTS_FLOAT16
+    if((a->dtype == NDARRAY_FLOAT16) || (b->dtype == NDARRAY_FLOAT16)) {
+        // the products are computed in mp_float_t, so the result is a float
+    } else
+    #endif
     if(a->dtype == b->dtype) {
         dtype = a->dtype;
     } else if(((a->dtype == NDARRAY_UINT8) && (b->dtype == NDARRAY_INT8)) || ((a->dtype == NDARRAY_INT8) && (b->dtype == NDARRAY_UINT8))) {
@@ -920,6 +1321,7 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_WIDEN_TO_FLOAT(ndarray)
     int8_t ax = args[2].u_int;
     if(ax < 0) ax += ndarray->ndim;
 
@@ -1000,12 +1402,53 @@ mp_obj_t numerical_flip(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
     ndarray_obj_t *results = NULL;
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     if(args[1].u_obj == mp_const_none) { // flip the flattened array
-        results = ndarray_new_linear_array(ndarray->len, ndarray->dtype);
-        ndarray_copy_array(ndarray, results, 0);
-        uint8_t *rarray = (uint8_t *)results->array;
-        rarray += (results->len - 1) * results->itemsize;
-        results->array = rarray;
-        results->strides[ULAB_MAX_DIMS - 1] = -results->strides[ULAB_MAX_DIMS - 1];
+        if(ndarray_is_dense(ndarray) && (ndarray->len > 0)) {
+            // dense arrays are simply written out back to front, specialised on
+            // the width of the items, and the result is a dense array, instead
+            // of a negative-strides view of the copy
+            results = ndarray_new_linear_array(ndarray->len, ndarray->dtype);
+            size_t len = ndarray->len;
+            if(ndarray->itemsize == 1) {
+                uint8_t *array = (uint8_t *)ndarray->array;
+                uint8_t *rarray = (uint8_t *)results->array + (len - 1);
+                for(size_t i = 0; i < len; i++) {
+                    *rarray-- = *array++;
+                }
+            } else if(ndarray->itemsize == 2) {
+                uint16_t *array = (uint16_t *)ndarray->array;
+                uint16_t *rarray = (uint16_t *)results->array + (len - 1);
+                for(size_t i = 0; i < len; i++) {
+                    *rarray-- = *array++;
+                }
+            } else if(ndarray->itemsize == 4) {
+                uint32_t *array = (uint32_t *)ndarray->array;
+                uint32_t *rarray = (uint32_t *)results->array + (len - 1);
+                for(size_t i = 0; i < len; i++) {
+                    *rarray-- = *array++;
+                }
+            } else if(ndarray->itemsize == 8) {
+                uint64_t *array = (uint64_t *)ndarray->array;
+                uint64_t *rarray = (uint64_t *)results->array + (len - 1);
+                for(size_t i = 0; i < len; i++) {
+                    *rarray-- = *array++;
+                }
+            } else { // 16-byte complex items
+                uint8_t *array = (uint8_t *)ndarray->array;
+                uint8_t *rarray = (uint8_t *)results->array + (len - 1) * ndarray->itemsize;
+                for(size_t i = 0; i < len; i++) {
+                    memcpy(rarray, array, ndarray->itemsize);
+                    array += ndarray->itemsize;
+                    rarray -= ndarray->itemsize;
+                }
+            }
+        } else {
+            results = ndarray_new_linear_array(ndarray->len, ndarray->dtype);
+            ndarray_copy_array(ndarray, results, 0);
+            uint8_t *rarray = (uint8_t *)results->array;
+            rarray += (results->len - 1) * results->itemsize;
+            results->array = rarray;
+            results->strides[ULAB_MAX_DIMS - 1] = -results->strides[ULAB_MAX_DIMS - 1];
+        }
     } else if(mp_obj_is_int(args[1].u_obj)){
         int8_t ax = tools_get_axis(args[1].u_obj, ndarray->ndim);
 
@@ -1048,7 +1491,62 @@ mp_obj_t numerical_mean(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_mean_obj, 1, numerical_mean);
 #endif
 
+#if ULAB_NUMPY_HAS_MEDIAN | ULAB_NUMPY_HAS_PARTITION | ULAB_NUMPY_HAS_ARGPARTITION
+// Hoare quickselect: after the call the kth element of the lane is in its
+// sorted position, every element to its left is not larger, and every
+// element to its right is not smaller; runs in linear time on average
+static void numerical_quickselect(uint8_t *array, int32_t stride, size_t N, size_t kth, uint8_t itemsize, mp_float_t (*func)(void *)) {
+    mp_int_t lo = 0, hi = (mp_int_t)N - 1;
+    uint8_t tmp[sizeof(mp_float_t)];
+    while(lo < hi) {
+        mp_float_t pivot = func(array + ((lo + hi) >> 1) * stride);
+        mp_int_t i = lo, j = hi;
+        while(i <= j) {
+            while(func(array + i * stride) < pivot) {
+                i++;
+            }
+            while(func(array + j * stride) > pivot) {
+                j--;
+            }
+            if(i <= j) {
+                memcpy(tmp, array + i * stride, itemsize);
+                memcpy(array + i * stride, array + j * stride, itemsize);
+                memcpy(array + j * stride, tmp, itemsize);
+                i++;
+                j--;
+            }
+        }
+        if((mp_int_t)kth <= j) {
+            hi = j;
+        } else if((mp_int_t)kth >= i) {
+            lo = i;
+        } else {
+            return;
+        }
+    }
+}
+#endif /* ULAB_NUMPY_HAS_MEDIAN | ULAB_NUMPY_HAS_PARTITION | ULAB_NUMPY_HAS_ARGPARTITION */
+
 #if ULAB_NUMPY_HAS_MEDIAN
+// selects the median of a single lane in place: quickselect places the upper
+// middle element, and for even lane lengths the lower middle element is the
+// largest value of the left partition
+static mp_float_t numerical_select_median(uint8_t *array, int32_t stride, size_t len, uint8_t itemsize, mp_float_t (*func)(void *)) {
+    numerical_quickselect(array, stride, len, len >> 1, itemsize, func);
+    mp_float_t median = func(array + (int32_t)(len >> 1) * stride);
+    if(!(len & 0x01)) { // len is an even number
+        mp_float_t lower = func(array);
+        for(size_t i = 1; i < (len >> 1); i++) {
+            mp_float_t value = func(array + i * stride);
+            if(value > lower) {
+                lower = value;
+            }
+        }
+        median = (median + lower) * MICROPY_FLOAT_CONST(0.5);
+    }
+    return median;
+}
+
 //| def median(array: ulab.numpy.ndarray, *, axis: int = -1) -> ulab.numpy.ndarray:
 //|     """Find the median value in an array along the given axis, or along all axes if axis is None."""
 //|     ...
@@ -1070,31 +1568,26 @@ mp_obj_t numerical_median(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     if(ndarray->len == 0) {
         return mp_obj_new_float(MICROPY_FLOAT_C_FUN(nan)(""));
     }
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
 
-    ndarray = MP_OBJ_TO_PTR(numerical_sort_helper(args[0].u_obj, args[1].u_obj, 0));
+    // quickselect re-orders the values, so work on a dense copy of the data
+    ndarray = ndarray_copy_view(ndarray);
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
 
     if((args[1].u_obj == mp_const_none) || (ndarray->ndim == 1)) {
-        // at this point, the array holding the sorted values should be flat
+        // the copy is dense, so the flattened array can be selected with the itemsize as stride
         uint8_t *array = (uint8_t *)ndarray->array;
-        size_t len = ndarray->len;
-        array += (len >> 1) * ndarray->itemsize;
-        mp_float_t median = ndarray_get_float_value(array, ndarray->dtype);
-        if(!(len & 0x01)) { // len is an even number
-            array -= ndarray->itemsize;
-            median += ndarray_get_float_value(array, ndarray->dtype);
-            median *= MICROPY_FLOAT_CONST(0.5);
-        }
-        return mp_obj_new_float(median);
+        return mp_obj_new_float(numerical_select_median(array, ndarray->itemsize, ndarray->len, ndarray->itemsize, func));
     } else {
         int8_t ax = tools_get_axis(args[1].u_obj, ndarray->ndim);
 
-        size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-        int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+        SCRATCH_ACQUIRE();
+        size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+        int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
         numerical_reduce_axes(ndarray, ax, shape, strides);
 
         ax = ULAB_MAX_DIMS - ndarray->ndim + ax;
         ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim-1, shape, NDARRAY_FLOAT);
-        m_del(size_t, shape, ULAB_MAX_DIMS);
 
         mp_float_t *rarray = (mp_float_t *)results->array;
 
@@ -1112,17 +1605,8 @@ mp_obj_t numerical_median(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
             #endif
                 size_t k = 0;
                 do {
-                    array += ndarray->strides[ax] * (len >> 1);
-                    mp_float_t median = ndarray_get_float_value(array, ndarray->dtype);
-                    if(!(len & 0x01)) { // len is an even number
-                        array -= ndarray->strides[ax];
-                        median += ndarray_get_float_value(array, ndarray->dtype);
-                        median *= MICROPY_FLOAT_CONST(0.5);
-                        array += ndarray->strides[ax];
-                    }
-                    array -= ndarray->strides[ax] * (len >> 1);
+                    *rarray = numerical_select_median(array, ndarray->strides[ax], len, ndarray->itemsize, func);
                     array += strides[ULAB_MAX_DIMS - 1];
-                    *rarray = median;
                     rarray++;
                     k++;
                 } while(k < shape[ULAB_MAX_DIMS - 1]);
@@ -1139,6 +1623,7 @@ mp_obj_t numerical_median(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
         } while(i < shape[ULAB_MAX_DIMS - 3]);
         #endif
 
+        SCRATCH_RELEASE();
         return MP_OBJ_FROM_PTR(results);
     }
     return mp_const_none;
@@ -1147,62 +1632,320 @@ mp_obj_t numerical_median(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_median_obj, 1, numerical_median);
 #endif
 
-#if ULAB_NUMPY_HAS_MINMAX
-//| def min(array: _ArrayLike, *, axis: Optional[int] = None) -> _float:
-//|     """Return the minimum element of the 1D array"""
-//|     ...
-//|
-
-mp_obj_t numerical_min(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    return numerical_function(n_args, pos_args, kw_args, NUMERICAL_MIN);
-}
-
-MP_DEFINE_CONST_FUN_OBJ_KW(numerical_min_obj, 1, numerical_min);
-#endif
-
-#if ULAB_NUMPY_HAS_ROLL
-//| def roll(array: ulab.numpy.ndarray, distance: int, *, axis: Optional[int] = None) -> None:
-//|     """Shift the content of a vector by the positions given as the second
-//|        argument. If the ``axis`` keyword is supplied, the shift is applied to
-//|        the given axis.  The array is modified in place."""
+#if ULAB_NUMPY_HAS_PARTITION
+//| def partition(array: ulab.numpy.ndarray, kth: int, *, axis: int = -1) -> ulab.numpy.ndarray:
+//|     """Return a partitioned copy of the array: the element at the kth position
+//|        is in its sorted place, smaller elements come before it, and larger ones
+//|        after it, in arbitrary order, along the given axis, or in the flattened
+//|        array if axis is None."""
 //|     ...
 //|
 
-mp_obj_t numerical_roll(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+mp_obj_t numerical_partition(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE  } },
-        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_kth, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_int = -1 } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-
     if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
-        mp_raise_TypeError(translate("roll argument must be an ndarray"));
+        mp_raise_TypeError(translate("partition argument must be an ndarray"));
     }
-    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
-    uint8_t *array = ndarray->array;
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, ndarray->shape, ndarray->dtype);
-
-    int32_t shift = mp_obj_get_int(args[1].u_obj);
-    int32_t _shift = shift < 0 ? -shift : shift;
 
-    size_t counter;
-    uint8_t *rarray = (uint8_t *)results->array;
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    ndarray = ndarray_copy_view(ndarray);
 
-    if(args[2].u_obj == mp_const_none) { // roll the flattened array
-        _shift = _shift % results->len;
-        if(shift > 0) { // shift to the right
-            rarray += _shift * results->itemsize;
-            counter = results->len - _shift;
-        } else { // shift to the left
-            rarray += (results->len - _shift) * results->itemsize;
-            counter = _shift;
+    int8_t ax = 0;
+    if(args[2].u_obj == mp_const_none) {
+        // flatten the array
+        #if ULAB_MAX_DIMS > 1
+        for(uint8_t i=0; i < ULAB_MAX_DIMS - 1; i++) {
+            ndarray->shape[i] = 0;
+            ndarray->strides[i] = 0;
         }
-        #if ULAB_MAX_DIMS > 3
-        size_t i = 0;
-        do {
+        ndarray->shape[ULAB_MAX_DIMS - 1] = ndarray->len;
+        ndarray->strides[ULAB_MAX_DIMS - 1] = ndarray->itemsize;
+        ndarray->ndim = 1;
+        #endif
+    } else {
+        ax = tools_get_axis(args[2].u_obj, ndarray->ndim);
+    }
+
+    uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+    size_t N = ndarray->shape[index];
+    mp_int_t kth = args[1].u_int;
+    if(kth < 0) {
+        kth += N;
+    }
+    if((kth < 0) || (kth >= (mp_int_t)N)) {
+        mp_raise_ValueError(translate("kth is out of bounds"));
+    }
+
+    SCRATCH_ACQUIRE();
+    size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+    int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
+    numerical_reduce_axes(ndarray, ax, shape, strides);
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t j = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t k = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                numerical_quickselect(array, ndarray->strides[index], N, kth, ndarray->itemsize, func);
+            #if ULAB_MAX_DIMS > 1
+                array += strides[ULAB_MAX_DIMS - 1];
+                l++;
+            } while(l < shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            array += strides[ULAB_MAX_DIMS - 2];
+            k++;
+        } while(k < shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        array += strides[ULAB_MAX_DIMS - 3];
+        j++;
+    } while(j < shape[ULAB_MAX_DIMS - 3]);
+    #endif
+
+    SCRATCH_RELEASE();
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_partition_obj, 2, numerical_partition);
+#endif /* ULAB_NUMPY_HAS_PARTITION */
+
+#if ULAB_NUMPY_HAS_ARGPARTITION
+// quickselect on the index array: the data are only read through the
+// indices, and the indices are swapped, as in HEAP_ARGSORT
+static void numerical_argquickselect(uint8_t *array, int32_t stride, size_t N, size_t kth, mp_float_t (*func)(void *), uint16_t *iarray, int32_t iincrement) {
+    mp_int_t lo = 0, hi = (mp_int_t)N - 1;
+    while(lo < hi) {
+        mp_float_t pivot = func(array + (int32_t)iarray[((lo + hi) >> 1) * iincrement] * stride);
+        mp_int_t i = lo, j = hi;
+        while(i <= j) {
+            while(func(array + (int32_t)iarray[i * iincrement] * stride) < pivot) {
+                i++;
+            }
+            while(func(array + (int32_t)iarray[j * iincrement] * stride) > pivot) {
+                j--;
+            }
+            if(i <= j) {
+                uint16_t itmp = iarray[i * iincrement];
+                iarray[i * iincrement] = iarray[j * iincrement];
+                iarray[j * iincrement] = itmp;
+                i++;
+                j--;
+            }
+        }
+        if((mp_int_t)kth <= j) {
+            hi = j;
+        } else if((mp_int_t)kth >= i) {
+            lo = i;
+        } else {
+            return;
+        }
+    }
+}
+
+//| def argpartition(array: ulab.numpy.ndarray, kth: int, *, axis: int = -1) -> ulab.numpy.ndarray:
+//|     """Returns an array of indices that partitions the input array along the
+//|        given axis: the index at the kth position refers to the element in its
+//|        sorted place, indices of smaller elements come before it, and indices
+//|        of larger ones after it, in arbitrary order."""
+//|     ...
+//|
+
+mp_obj_t numerical_argpartition(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_kth, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_int = -1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("argpartition argument must be an ndarray"));
+    }
+
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(args[2].u_obj == mp_const_none) {
+        // bail out, as in argsort
+        mp_raise_NotImplementedError(translate("argpartition is not implemented for flattened arrays"));
+    }
+    // Since we are returning an NDARRAY_UINT16 array, bail out,
+    // if the axis is longer than what we can hold
+    for(uint8_t i=0; i < ULAB_MAX_DIMS; i++) {
+        if(ndarray->shape[i] > 65535) {
+            mp_raise_ValueError(translate("axis too long"));
+        }
+    }
+    int8_t ax = tools_get_axis(args[2].u_obj, ndarray->ndim);
+
+    uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+    size_t N = ndarray->shape[index];
+    mp_int_t kth = args[1].u_int;
+    if(kth < 0) {
+        kth += N;
+    }
+    if((kth < 0) || (kth >= (mp_int_t)N)) {
+        mp_raise_ValueError(translate("kth is out of bounds"));
+    }
+
+    SCRATCH_ACQUIRE();
+    size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+    int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
+    numerical_reduce_axes(ndarray, ax, shape, strides);
+
+    ndarray_obj_t *indices = ndarray_new_ndarray(ndarray->ndim, ndarray->shape, NULL, NDARRAY_UINT16);
+    int32_t *istrides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
+    numerical_reduce_axes(indices, ax, shape, istrides);
+
+    for(uint8_t i=0; i < ULAB_MAX_DIMS; i++) {
+        istrides[i] /= sizeof(uint16_t);
+    }
+
+    uint16_t iincrement = indices->strides[index] / sizeof(uint16_t);
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    uint16_t *iarray = (uint16_t *)indices->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t j = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t k = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                // fill in the index values, then partition the lane
+                uint16_t m = 0;
+                do {
+                    iarray[m * iincrement] = m;
+                    m++;
+                } while(m < N);
+                numerical_argquickselect(array, ndarray->strides[index], N, kth, func, iarray, iincrement);
+            #if ULAB_MAX_DIMS > 1
+                array += strides[ULAB_MAX_DIMS - 1];
+                iarray += istrides[ULAB_MAX_DIMS - 1];
+                l++;
+            } while(l < shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            array += strides[ULAB_MAX_DIMS - 2];
+            iarray -= istrides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            iarray += istrides[ULAB_MAX_DIMS - 2];
+            k++;
+        } while(k < shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        array += strides[ULAB_MAX_DIMS - 3];
+        iarray -= istrides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        iarray += istrides[ULAB_MAX_DIMS - 3];
+        j++;
+    } while(j < shape[ULAB_MAX_DIMS - 3]);
+    #endif
+
+    SCRATCH_RELEASE();
+    return MP_OBJ_FROM_PTR(indices);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_argpartition_obj, 2, numerical_argpartition);
+#endif /* ULAB_NUMPY_HAS_ARGPARTITION */
+
+#if ULAB_NUMPY_HAS_MINMAX
+//| def min(array: _ArrayLike, *, axis: Optional[int] = None) -> _float:
+//|     """Return the minimum element of the 1D array"""
+//|     ...
+//|
+
+mp_obj_t numerical_min(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_function(n_args, pos_args, kw_args, NUMERICAL_MIN);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_min_obj, 1, numerical_min);
+#endif
+
+#if ULAB_NUMPY_HAS_ROLL
+//| def roll(array: ulab.numpy.ndarray, distance: int, *, axis: Optional[int] = None) -> None:
+//|     """Shift the content of a vector by the positions given as the second
+//|        argument. If the ``axis`` keyword is supplied, the shift is applied to
+//|        the given axis.  The array is modified in place."""
+//|     ...
+//|
+
+mp_obj_t numerical_roll(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE  } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("roll argument must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    uint8_t *array = ndarray->array;
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, ndarray->shape, ndarray->dtype);
+
+    int32_t shift = mp_obj_get_int(args[1].u_obj);
+    int32_t _shift = shift < 0 ? -shift : shift;
+
+    size_t counter;
+    uint8_t *rarray = (uint8_t *)results->array;
+
+    if(args[2].u_obj == mp_const_none) { // roll the flattened array
+        _shift = _shift % results->len;
+        if(ndarray_is_dense(ndarray)) {
+            // a dense array is rolled with at most two contiguous copies: the
+            // tail of the input lands at the beginning of the output, the rest
+            // is shifted to the right
+            size_t right = shift > 0 ? (size_t)_shift : results->len - (size_t)_shift;
+            if(right == results->len) {
+                right = 0;
+            }
+            size_t left = results->len - right;
+            memcpy(rarray + right * results->itemsize, array, left * ndarray->itemsize);
+            memcpy(rarray, array + left * ndarray->itemsize, right * ndarray->itemsize);
+            return MP_OBJ_FROM_PTR(results);
+        }
+        if(shift > 0) { // shift to the right
+            rarray += _shift * results->itemsize;
+            counter = results->len - _shift;
+        } else { // shift to the left
+            rarray += (results->len - _shift) * results->itemsize;
+            counter = _shift;
+        }
+        #if ULAB_MAX_DIMS > 3
+        size_t i = 0;
+        do {
         #endif
             #if ULAB_MAX_DIMS > 2
             size_t j = 0;
@@ -1364,6 +2107,482 @@ static mp_obj_t numerical_sort_inplace(size_t n_args, const mp_obj_t *pos_args,
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_sort_inplace_obj, 1, numerical_sort_inplace);
 #endif /* NDARRAY_HAS_SORT */
 
+#if ULAB_NUMPY_HAS_SEARCHSORTED | ULAB_NUMPY_HAS_HISTOGRAM
+// standard bisection in the [lo, hi) index range: returns the leftmost
+// (side_right == 0), or rightmost (side_right == 1) insertion point
+static size_t numerical_searchsorted_bisect(uint8_t *array, int32_t stride, size_t lo, size_t hi, mp_float_t needle, uint8_t side_right, mp_float_t (*func)(void *)) {
+    while(lo < hi) {
+        size_t mid = lo + ((hi - lo) >> 1);
+        mp_float_t value = func(array + (int32_t)mid * stride);
+        if((value < needle) || (side_right && (value == needle))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif /* ULAB_NUMPY_HAS_SEARCHSORTED | ULAB_NUMPY_HAS_HISTOGRAM */
+
+#if ULAB_NUMPY_HAS_SEARCHSORTED
+//| def searchsorted(a: ulab.numpy.ndarray, v: Union[_float, _ArrayLike], *, side: str = "left") -> Union[int, ulab.numpy.ndarray]:
+//|     """Find the indices, where elements of v should be inserted into the
+//|        sorted 1D array a to keep it sorted. With side="left" the first
+//|        suitable position is returned, with side="right" the last one."""
+//|     ...
+//|
+
+mp_obj_t numerical_searchsorted(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_v, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_side, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_left) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("searchsorted argument must be an ndarray"));
+    }
+
+    ndarray_obj_t *a = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(a->dtype)
+    if(a->ndim != 1) {
+        mp_raise_ValueError(translate("searchsorted is defined for 1D arrays"));
+    }
+
+    uint8_t side_right = 0;
+    const char *side = mp_obj_str_get_str(args[2].u_obj);
+    if(strcmp(side, "right") == 0) {
+        side_right = 1;
+    } else if(strcmp(side, "left") != 0) {
+        mp_raise_ValueError(translate("side must be 'left', or 'right'"));
+    }
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(a->dtype);
+    uint8_t *array = (uint8_t *)a->array;
+    int32_t stride = a->strides[ULAB_MAX_DIMS - 1];
+    size_t len = a->len;
+
+    if(ulab_tools_mp_obj_is_scalar(args[1].u_obj)) {
+        size_t index = numerical_searchsorted_bisect(array, stride, 0, len, mp_obj_get_float(args[1].u_obj), side_right, func);
+        return mp_obj_new_int(index);
+    }
+
+    ndarray_obj_t *v = ndarray_from_mp_obj(args[1].u_obj, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(v->dtype)
+    // the insertion points are returned in an NDARRAY_UINT16 array, so bail
+    // out, if they could overflow
+    if(len > 65535) {
+        mp_raise_ValueError(translate("axis too long"));
+    }
+    mp_float_t (*vfunc)(void *) = ndarray_get_float_function(v->dtype);
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(v->ndim, v->shape, NDARRAY_UINT16);
+    uint16_t *rarray = (uint16_t *)results->array;
+    uint8_t *varray = (uint8_t *)v->array;
+
+    // when consecutive needles are non-decreasing, the search gallops right
+    // from the previous insertion point, instead of bisecting the full table
+    size_t hint = 0;
+    mp_float_t previous = MICROPY_FLOAT_CONST(0.0);
+    uint8_t have_previous = 0;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    mp_float_t needle = vfunc(varray);
+                    size_t index;
+                    if(have_previous && (needle >= previous)) {
+                        // elements before the previous insertion point cannot
+                        // go after this needle, so the point is a safe lower bound
+                        size_t lo = hint;
+                        size_t bound = 1;
+                        while(lo + bound < len) {
+                            mp_float_t value = func(array + (int32_t)(lo + bound) * stride);
+                            if((value < needle) || (side_right && (value == needle))) {
+                                lo += bound;
+                                bound <<= 1;
+                            } else {
+                                break;
+                            }
+                        }
+                        size_t hi = lo + bound < len ? lo + bound : len;
+                        index = numerical_searchsorted_bisect(array, stride, lo, hi, needle, side_right, func);
+                    } else {
+                        index = numerical_searchsorted_bisect(array, stride, 0, len, needle, side_right, func);
+                    }
+                    *rarray++ = (uint16_t)index;
+                    hint = index;
+                    previous = needle;
+                    have_previous = 1;
+                    varray += v->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < v->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                varray -= v->strides[ULAB_MAX_DIMS - 1] * v->shape[ULAB_MAX_DIMS - 1];
+                varray += v->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < v->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            varray -= v->strides[ULAB_MAX_DIMS - 2] * v->shape[ULAB_MAX_DIMS - 2];
+            varray += v->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < v->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        varray -= v->strides[ULAB_MAX_DIMS - 3] * v->shape[ULAB_MAX_DIMS - 3];
+        varray += v->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < v->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    if(results->ndim == 0) { // return a scalar here
+        return mp_binary_get_val_array(results->dtype, results->array, 0);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_searchsorted_obj, 2, numerical_searchsorted);
+#endif /* ULAB_NUMPY_HAS_SEARCHSORTED */
+
+#if ULAB_NUMPY_HAS_HISTOGRAM
+//| def histogram(a: _ArrayLike, bins: Union[int, _ArrayLike] = 10, *, range: Optional[Tuple[_float, _float]] = None) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """Compute the histogram of the data in a single pass: returns the tuple
+//|        of the uint16 bin counts, and the float bin edges. bins is either the
+//|        number of uniform bins (values are binned with a direct indexed
+//|        increment), or a monotone 1D array of bin edges (values are binned
+//|        with binary search)."""
+//|     ...
+//|
+
+mp_obj_t numerical_histogram(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_bins, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(10) } },
+        { MP_QSTR_range, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *a = ndarray_from_mp_obj(args[0].u_obj, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(a->dtype)
+    if(!ndarray_is_dense(a)) {
+        a = ndarray_copy_view(a);
+    }
+    mp_float_t (*func)(void *) = ndarray_get_float_function(a->dtype);
+    uint8_t *array = (uint8_t *)a->array;
+
+    ndarray_obj_t *edges = NULL;
+    ndarray_obj_t *counts = NULL;
+
+    if(mp_obj_is_int(args[1].u_obj)) {
+        mp_int_t nbins = mp_obj_get_int(args[1].u_obj);
+        if(nbins < 1) {
+            mp_raise_ValueError(translate("number of bins must be positive"));
+        }
+        mp_float_t lo, hi;
+        if(args[2].u_obj == mp_const_none) {
+            // take the range of the data
+            lo = MICROPY_FLOAT_CONST(0.0);
+            hi = MICROPY_FLOAT_CONST(1.0);
+            if(a->len > 0) {
+                uint8_t *source = array;
+                lo = hi = func(source);
+                for(size_t i = 1; i < a->len; i++) {
+                    source += a->itemsize;
+                    mp_float_t value = func(source);
+                    if(value < lo) {
+                        lo = value;
+                    } else if(value > hi) {
+                        hi = value;
+                    }
+                }
+            }
+            if(lo == hi) {
+                lo -= MICROPY_FLOAT_CONST(0.5);
+                hi += MICROPY_FLOAT_CONST(0.5);
+            }
+        } else {
+            mp_obj_t *items;
+            mp_obj_get_array_fixed_n(args[2].u_obj, 2, &items);
+            lo = mp_obj_get_float(items[0]);
+            hi = mp_obj_get_float(items[1]);
+            if(hi < lo) {
+                mp_raise_ValueError(translate("max must be larger than min in range parameter"));
+            }
+        }
+
+        edges = ndarray_new_linear_array(nbins + 1, NDARRAY_FLOAT);
+        mp_float_t *earray = (mp_float_t *)edges->array;
+        for(mp_int_t e = 0; e <= nbins; e++) {
+            earray[e] = lo + (hi - lo) * e / nbins;
+        }
+
+        counts = ndarray_new_linear_array(nbins, NDARRAY_UINT16);
+        uint16_t *carray = (uint16_t *)counts->array;
+        // uniform bin widths: single pass with a direct indexed increment
+        mp_float_t norm = (mp_float_t)nbins / (hi - lo);
+        for(size_t i = 0; i < a->len; i++) {
+            mp_float_t value = func(array);
+            array += a->itemsize;
+            if((value < lo) || (value > hi)) {
+                continue;
+            }
+            size_t index = (size_t)((value - lo) * norm);
+            if(index == (size_t)nbins) { // the last bin is closed from the right
+                index--;
+            }
+            carray[index]++;
+        }
+    } else {
+        // bins holds the array of bin edges
+        edges = ndarray_from_mp_obj(args[1].u_obj, 0);
+        if(edges->ndim != 1) {
+            mp_raise_ValueError(translate("bins must be a 1D array"));
+        }
+        if(edges->dtype != NDARRAY_FLOAT) {
+            edges = ndarray_copy_view_convert_type(edges, NDARRAY_FLOAT);
+        } else if(!ndarray_is_dense(edges)) {
+            edges = ndarray_copy_view(edges);
+        }
+        if(edges->len < 2) {
+            mp_raise_ValueError(translate("bins must have at least 2 edges"));
+        }
+        size_t nbins = edges->len - 1;
+        mp_float_t *earray = (mp_float_t *)edges->array;
+        mp_float_t (*efunc)(void *) = ndarray_get_float_function(NDARRAY_FLOAT);
+
+        counts = ndarray_new_linear_array(nbins, NDARRAY_UINT16);
+        uint16_t *carray = (uint16_t *)counts->array;
+        for(size_t i = 0; i < a->len; i++) {
+            mp_float_t value = func(array);
+            array += a->itemsize;
+            if((value < earray[0]) || (value > earray[nbins])) {
+                continue;
+            }
+            size_t index = numerical_searchsorted_bisect((uint8_t *)earray, sizeof(mp_float_t), 0, edges->len, value, 1, efunc);
+            index--;
+            if(index == nbins) { // the last bin is closed from the right
+                index--;
+            }
+            carray[index]++;
+        }
+    }
+
+    mp_obj_t items[2] = { MP_OBJ_FROM_PTR(counts), MP_OBJ_FROM_PTR(edges) };
+    return mp_obj_new_tuple(2, items);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_histogram_obj, 1, numerical_histogram);
+#endif /* ULAB_NUMPY_HAS_HISTOGRAM */
+
+#if ULAB_NUMPY_HAS_BINCOUNT
+//| def bincount(x: _ArrayLike, *, minlength: int = 0) -> ulab.numpy.ndarray:
+//|     """Count the occurrences of each non-negative integer value in x in a
+//|        single pass, and return the uint16 array of counts, whose length is
+//|        max(x) + 1, or minlength, whichever is larger."""
+//|     ...
+//|
+
+mp_obj_t numerical_bincount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_minlength, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 0 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    if(args[1].u_int < 0) {
+        mp_raise_ValueError(translate("minlength must not be negative"));
+    }
+
+    ndarray_obj_t *x = ndarray_from_mp_obj(args[0].u_obj, 0);
+    if((x->dtype == NDARRAY_FLOAT) || (x->boolean)
+    #if ULAB_SUPPORTS_FLOAT16
+        || (x->dtype == NDARRAY_FLOAT16)
+    #endif
+    #if ULAB_SUPPORTS_COMPLEX
+        || (x->dtype == NDARRAY_COMPLEX)
+    #endif
+    ) {
+        mp_raise_TypeError(translate("input must be an array of integers"));
+    }
+    if(!ndarray_is_dense(x)) {
+        x = ndarray_copy_view(x);
+    }
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+
+    // find the largest value, and complain about negative entries
+    mp_int_t nbins = args[1].u_int;
+    uint8_t *array = (uint8_t *)x->array;
+    for(size_t i = 0; i < x->len; i++) {
+        mp_int_t value = (mp_int_t)func(array);
+        array += x->itemsize;
+        if(value < 0) {
+            mp_raise_ValueError(translate("input values must be non-negative"));
+        }
+        if(value + 1 > nbins) {
+            nbins = value + 1;
+        }
+    }
+    // the counts are returned in an NDARRAY_UINT16 array
+    if(nbins > 65535) {
+        mp_raise_ValueError(translate("maximum value is too large"));
+    }
+
+    ndarray_obj_t *counts = ndarray_new_linear_array(nbins, NDARRAY_UINT16);
+    uint16_t *carray = (uint16_t *)counts->array;
+    array = (uint8_t *)x->array;
+    for(size_t i = 0; i < x->len; i++) {
+        carray[(size_t)func(array)]++;
+        array += x->itemsize;
+    }
+    return MP_OBJ_FROM_PTR(counts);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_bincount_obj, 1, numerical_bincount);
+#endif /* ULAB_NUMPY_HAS_BINCOUNT */
+
+#if ULAB_NUMPY_HAS_CUMSUM | ULAB_NUMPY_HAS_CUMPROD
+static mp_obj_t numerical_cumsum_cumprod(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t optype) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_WIDEN_TO_FLOAT(ndarray)
+
+    ndarray_obj_t *results;
+    int8_t ax = 0;
+    if(args[1].u_obj == mp_const_none) {
+        // the cumulative values are taken over the flattened array
+        size_t rshape[ULAB_MAX_DIMS];
+        memset(rshape, 0, sizeof(size_t) * ULAB_MAX_DIMS);
+        rshape[ULAB_MAX_DIMS - 1] = ndarray->len;
+        results = tools_validate_out(args[2].u_obj, 1, rshape, ndarray->dtype);
+    } else {
+        ax = tools_get_axis(args[1].u_obj, ndarray->ndim);
+        results = tools_validate_out(args[2].u_obj, ndarray->ndim, ndarray->shape, ndarray->dtype);
+    }
+    uint8_t index = ULAB_MAX_DIMS - results->ndim + ax;
+
+    if(results != ndarray) {
+        // with out=input the operation runs in place, and there is nothing to copy
+        if(!ndarray_is_dense(ndarray)) {
+            ndarray = ndarray_copy_view(ndarray);
+        }
+        memcpy(results->array, ndarray->array, ndarray->len * ndarray->itemsize);
+    }
+
+    size_t N = results->shape[index];
+    if(N > 0) {
+        // we work with the typed array, so re-scale the stride
+        int32_t increment = results->strides[index] / results->itemsize;
+        uint8_t isprod = optype == NUMERICAL_CUMPROD ? 1 : 0;
+
+        SCRATCH_ACQUIRE();
+        size_t *shape = SCRATCH_NEW(size_t, ULAB_MAX_DIMS);
+        int32_t *strides = SCRATCH_NEW(int32_t, ULAB_MAX_DIMS);
+        numerical_reduce_axes(results, ax, shape, strides);
+
+        uint8_t *rarray = (uint8_t *)results->array;
+
+        #if ULAB_MAX_DIMS > 3
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 2
+            size_t k = 0;
+            do {
+            #endif
+                #if ULAB_MAX_DIMS > 1
+                size_t l = 0;
+                do {
+                #endif
+                    if(results->dtype == NDARRAY_UINT8) {
+                        RUN_CUMULATIVE1(uint8_t, rarray, N, increment, isprod);
+                    } else if(results->dtype == NDARRAY_INT8) {
+                        RUN_CUMULATIVE1(int8_t, rarray, N, increment, isprod);
+                    } else if(results->dtype == NDARRAY_UINT16) {
+                        RUN_CUMULATIVE1(uint16_t, rarray, N, increment, isprod);
+                    } else if(results->dtype == NDARRAY_INT16) {
+                        RUN_CUMULATIVE1(int16_t, rarray, N, increment, isprod);
+                    } else {
+                        RUN_CUMULATIVE1(mp_float_t, rarray, N, increment, isprod);
+                    }
+                #if ULAB_MAX_DIMS > 1
+                    rarray += strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < shape[ULAB_MAX_DIMS - 1]);
+                #endif
+            #if ULAB_MAX_DIMS > 2
+                rarray -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+                rarray += strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 3
+            rarray -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+            rarray += strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < shape[ULAB_MAX_DIMS - 3]);
+        #endif
+
+        SCRATCH_RELEASE();
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif /* ULAB_NUMPY_HAS_CUMSUM | ULAB_NUMPY_HAS_CUMPROD */
+
+#if ULAB_NUMPY_HAS_CUMSUM
+//| def cumsum(a: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.numpy.ndarray] = None) -> ulab.numpy.ndarray:
+//|     """Return the running sum of the elements along the given axis, or of the
+//|        flattened array if axis is None. With out=a the array is integrated
+//|        in place."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumsum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumsum_cumprod(n_args, pos_args, kw_args, NUMERICAL_CUMSUM);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumsum_obj, 1, numerical_cumsum);
+#endif /* ULAB_NUMPY_HAS_CUMSUM */
+
+#if ULAB_NUMPY_HAS_CUMPROD
+//| def cumprod(a: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.numpy.ndarray] = None) -> ulab.numpy.ndarray:
+//|     """Return the running product of the elements along the given axis, or of
+//|        the flattened array if axis is None."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumprod(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumsum_cumprod(n_args, pos_args, kw_args, NUMERICAL_CUMPROD);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumprod_obj, 1, numerical_cumprod);
+#endif /* ULAB_NUMPY_HAS_CUMPROD */
+
 #if ULAB_NUMPY_HAS_STD
 //| def std(array: _ArrayLike, *, axis: Optional[int] = None, ddof: int = 0) -> _float:
 //|     """Return the standard deviation of the array, as a number if axis is None, otherwise as an array."""
@@ -1413,3 +2632,201 @@ mp_obj_t numerical_sum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_arg
 
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_sum_obj, 1, numerical_sum);
 #endif
+
+#if ULAB_NUMPY_HAS_TOPK
+// restores the min-heap property of the heap rooted at root; the heap is
+// keyed on the values, the indices are simply dragged along
+static void numerical_topk_sift_down(mp_float_t *values, size_t *indices, size_t root, size_t size) {
+    size_t child = 2 * root + 1;
+    while(child < size) {
+        if((child + 1 < size) && (values[child + 1] < values[child])) {
+            child++;
+        }
+        if(values[child] >= values[root]) {
+            break;
+        }
+        mp_float_t value = values[root];
+        values[root] = values[child];
+        values[child] = value;
+        size_t index = indices[root];
+        indices[root] = indices[child];
+        indices[child] = index;
+        root = child;
+        child = 2 * root + 1;
+    }
+}
+
+static mp_obj_t numerical_topk_helper(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t return_indices) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_k, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+
+    mp_int_t k = args[1].u_int;
+    if((k < 1) || ((size_t)k > ndarray->len)) {
+        mp_raise_ValueError(translate("k is out of bounds"));
+    }
+    if(return_indices && (ndarray->len > 65535)) {
+        mp_raise_ValueError(translate("array is too long"));
+    }
+
+    size_t rshape[ULAB_MAX_DIMS] = {0};
+    rshape[ULAB_MAX_DIMS - 1] = (size_t)k;
+    ndarray_obj_t *results;
+    if(return_indices) {
+        results = ndarray_new_dense_ndarray(1, rshape, NDARRAY_UINT16);
+    } else {
+        results = ndarray_new_dense_ndarray(1, rshape, ndarray->dtype);
+    }
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+
+    SCRATCH_ACQUIRE();
+    mp_float_t *values = SCRATCH_NEW(mp_float_t, k);
+    size_t *indices = SCRATCH_NEW(size_t, k);
+
+    // stream over the flattened array, keeping the k largest elements seen
+    // so far in a bounded min-heap, whose root is the smallest of the k;
+    // this is a single pass, no matter, how large k is
+    size_t count = 0, index = 0;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t l = 0;
+            do {
+            #endif
+                size_t m = 0;
+                do {
+                    mp_float_t value = func(array);
+                    if(count < (size_t)k) {
+                        values[count] = value;
+                        indices[count] = index;
+                        count++;
+                        if(count == (size_t)k) {
+                            for(size_t p = count / 2; p > 0; p--) {
+                                numerical_topk_sift_down(values, indices, p - 1, count);
+                            }
+                        }
+                    } else if(value > values[0]) {
+                        values[0] = value;
+                        indices[0] = index;
+                        numerical_topk_sift_down(values, indices, 0, count);
+                    }
+                    array += ndarray->strides[ULAB_MAX_DIMS - 1];
+                    m++;
+                    index++;
+                } while(m < ndarray->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                array -= ndarray->strides[ULAB_MAX_DIMS - 1] * ndarray->shape[ULAB_MAX_DIMS-1];
+                array += ndarray->strides[ULAB_MAX_DIMS - 2];
+                l++;
+            } while(l < ndarray->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= ndarray->strides[ULAB_MAX_DIMS - 2] * ndarray->shape[ULAB_MAX_DIMS-2];
+            array += ndarray->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < ndarray->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= ndarray->strides[ULAB_MAX_DIMS - 3] * ndarray->shape[ULAB_MAX_DIMS-3];
+        array += ndarray->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < ndarray->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    // pop the heap repeatedly, so that the arrays end up in descending order
+    for(size_t p = count; p > 1; p--) {
+        mp_float_t value = values[0];
+        values[0] = values[p - 1];
+        values[p - 1] = value;
+        size_t _index = indices[0];
+        indices[0] = indices[p - 1];
+        indices[p - 1] = _index;
+        numerical_topk_sift_down(values, indices, 0, p - 1);
+    }
+
+    if(return_indices) {
+        uint16_t *rarray = (uint16_t *)results->array;
+        for(size_t p = 0; p < count; p++) {
+            rarray[p] = (uint16_t)indices[p];
+        }
+    } else {
+        if(ndarray->dtype == NDARRAY_UINT8) {
+            uint8_t *rarray = (uint8_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                rarray[p] = (uint8_t)values[p];
+            }
+        } else if(ndarray->dtype == NDARRAY_INT8) {
+            int8_t *rarray = (int8_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                rarray[p] = (int8_t)values[p];
+            }
+        } else if(ndarray->dtype == NDARRAY_UINT16) {
+            uint16_t *rarray = (uint16_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                rarray[p] = (uint16_t)values[p];
+            }
+        } else if(ndarray->dtype == NDARRAY_INT16) {
+            int16_t *rarray = (int16_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                rarray[p] = (int16_t)values[p];
+            }
+        }
+        #if ULAB_SUPPORTS_FLOAT16
+        else if(ndarray->dtype == NDARRAY_FLOAT16) {
+            uint16_t *rarray = (uint16_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                ndarray_set_float_float16(rarray + p, values[p]);
+            }
+        }
+        #endif
+        else {
+            mp_float_t *rarray = (mp_float_t *)results->array;
+            for(size_t p = 0; p < count; p++) {
+                rarray[p] = values[p];
+            }
+        }
+    }
+
+    SCRATCH_RELEASE();
+    return MP_OBJ_FROM_PTR(results);
+}
+
+//| def topk(a: _ArrayLike, k: int) -> ulab.numpy.ndarray:
+//|     """Return the k largest elements of the flattened array, in descending order."""
+//|     ...
+//|
+
+mp_obj_t numerical_topk(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_topk_helper(n_args, pos_args, kw_args, 0);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_topk_obj, 2, numerical_topk);
+
+//| def argtopk(a: _ArrayLike, k: int) -> ulab.numpy.ndarray:
+//|     """Return the indices of the k largest elements of the flattened array,
+//|        in descending order of the elements."""
+//|     ...
+//|
+
+mp_obj_t numerical_argtopk(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_topk_helper(n_args, pos_args, kw_args, 1);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_argtopk_obj, 2, numerical_argtopk);
+#endif /* ULAB_NUMPY_HAS_TOPK */
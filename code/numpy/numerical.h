@@ -15,8 +15,6 @@
 #include "../ulab.h"
 #include "../ndarray.h"
 
-// TODO: implement cumsum
-
 #define RUN_ARGMIN1(ndarray, type, array, results, rarray, index, op)\
 ({\
     uint16_t best_index = 0;\
@@ -46,6 +44,65 @@
     (rarray) += (results)->itemsize;\
 })
 
+// unrolled scan of a contiguous array for the extremum; with op = 1 the
+// maximum is found, otherwise the minimum; four independent running extrema
+// are tracked, so that the comparisons in the loop body do not depend on
+// each other, and are merged only at the very end; ties are always resolved
+// in favour of the smaller index
+#define RUN_ARGMINMAX1(type, array, N, op, best_index, best_value)\
+({\
+    type *_array = (type *)(array);\
+    type b0 = _array[0], b1 = b0, b2 = b0, b3 = b0;\
+    size_t i0 = 0, i1 = 0, i2 = 0, i3 = 0;\
+    size_t _i = 1;\
+    if(op) {\
+        for( ; _i + 3 < (N); _i += 4) {\
+            if(_array[_i] > b0) { b0 = _array[_i]; i0 = _i; }\
+            if(_array[_i+1] > b1) { b1 = _array[_i+1]; i1 = _i+1; }\
+            if(_array[_i+2] > b2) { b2 = _array[_i+2]; i2 = _i+2; }\
+            if(_array[_i+3] > b3) { b3 = _array[_i+3]; i3 = _i+3; }\
+        }\
+        for( ; _i < (N); _i++) {\
+            if(_array[_i] > b0) { b0 = _array[_i]; i0 = _i; }\
+        }\
+        if((b1 > b0) || ((b1 == b0) && (i1 < i0))) { b0 = b1; i0 = i1; }\
+        if((b2 > b0) || ((b2 == b0) && (i2 < i0))) { b0 = b2; i0 = i2; }\
+        if((b3 > b0) || ((b3 == b0) && (i3 < i0))) { b0 = b3; i0 = i3; }\
+    } else {\
+        for( ; _i + 3 < (N); _i += 4) {\
+            if(_array[_i] < b0) { b0 = _array[_i]; i0 = _i; }\
+            if(_array[_i+1] < b1) { b1 = _array[_i+1]; i1 = _i+1; }\
+            if(_array[_i+2] < b2) { b2 = _array[_i+2]; i2 = _i+2; }\
+            if(_array[_i+3] < b3) { b3 = _array[_i+3]; i3 = _i+3; }\
+        }\
+        for( ; _i < (N); _i++) {\
+            if(_array[_i] < b0) { b0 = _array[_i]; i0 = _i; }\
+        }\
+        if((b1 < b0) || ((b1 == b0) && (i1 < i0))) { b0 = b1; i0 = i1; }\
+        if((b2 < b0) || ((b2 == b0) && (i2 < i0))) { b0 = b2; i0 = i2; }\
+        if((b3 < b0) || ((b3 == b0) && (i3 < i0))) { b0 = b3; i0 = i3; }\
+    }\
+    (best_index) = i0;\
+    (best_value) = (mp_float_t)b0;\
+})
+
+// running accumulation along a single lane, in place; with isprod = 1 the
+// values are multiplied, otherwise they are added
+#define RUN_CUMULATIVE1(type, array, N, increment, isprod)\
+({\
+    type *_carray = (type *)(array);\
+    type value = *_carray;\
+    for(size_t i=1; i < (N); i++) {\
+        _carray += (increment);\
+        if(isprod) {\
+            value *= *_carray;\
+        } else {\
+            value += *_carray;\
+        }\
+        *_carray = value;\
+    }\
+})
+
 #define RUN_SUM1(type, array, results, rarray, ss)\
 ({\
     type sum = 0;\
@@ -103,16 +160,61 @@
 
 #define RUN_DIFF1(ndarray, type, array, results, rarray, index, stencil, N)\
 ({\
-    for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
-        type sum = 0;\
-        uint8_t *source = (array);\
-        for(uint8_t d=0; d < (N)+1; d++) {\
-            sum -= (stencil)[d] * *((type *)source);\
-            source += (ndarray)->strides[(index)];\
+    if(((index) == ULAB_MAX_DIMS - 1) && ((N) >= 1) && ((N) <= 3)) {\
+        /* when differentiating along the principal axis, the stencil window */\
+        /* slides by a single position per output element, so it can be kept */\
+        /* in registers, and each input element is loaded exactly once */\
+        int32_t _stride = (ndarray)->strides[ULAB_MAX_DIMS - 1];\
+        uint8_t *_source = (array);\
+        type w0 = *((type *)_source);\
+        _source += _stride;\
+        if((N) == 1) {\
+            for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
+                type w1 = *((type *)_source);\
+                _source += _stride;\
+                *(type *)(rarray) = (type)(w1 - w0);\
+                (rarray) += (results)->itemsize;\
+                w0 = w1;\
+            }\
+        } else if((N) == 2) {\
+            type w1 = *((type *)_source);\
+            _source += _stride;\
+            for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
+                type w2 = *((type *)_source);\
+                _source += _stride;\
+                *(type *)(rarray) = (type)(w1 + w1 - w0 - w2);\
+                (rarray) += (results)->itemsize;\
+                w0 = w1;\
+                w1 = w2;\
+            }\
+        } else {\
+            type w1 = *((type *)_source);\
+            _source += _stride;\
+            type w2 = *((type *)_source);\
+            _source += _stride;\
+            for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
+                type w3 = *((type *)_source);\
+                _source += _stride;\
+                *(type *)(rarray) = (type)(w3 - w0 + 3 * (w1 - w2));\
+                (rarray) += (results)->itemsize;\
+                w0 = w1;\
+                w1 = w2;\
+                w2 = w3;\
+            }\
+        }\
+        (array) += _stride * (results)->shape[ULAB_MAX_DIMS - 1];\
+    } else {\
+        for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
+            type sum = 0;\
+            uint8_t *source = (array);\
+            for(uint8_t d=0; d < (N)+1; d++) {\
+                sum -= (stencil)[d] * *((type *)source);\
+                source += (ndarray)->strides[(index)];\
+            }\
+            (array) += (ndarray)->strides[ULAB_MAX_DIMS - 1];\
+            *(type *)(rarray) = sum;\
+            (rarray) += (results)->itemsize;\
         }\
-        (array) += (ndarray)->strides[ULAB_MAX_DIMS - 1];\
-        *(type *)(rarray) = sum;\
-        (rarray) += (results)->itemsize;\
     }\
 })
 
@@ -636,18 +738,27 @@ MP_DECLARE_CONST_FUN_OBJ_KW(numerical_all_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_any_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmax_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmin_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argpartition_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argsort_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argtopk_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_bincount_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(numerical_cross_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumprod_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumsum_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_diff_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_flip_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_histogram_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_max_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_mean_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_median_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_min_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_partition_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_roll_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_searchsorted_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_std_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_sum_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_sort_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_sort_inplace_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_topk_obj);
 
 #endif
@@ -22,6 +22,7 @@
 #include "compare.h"
 #include "create.h"
 #include "fft/fft.h"
+#include "random/random.h"
 #include "filter.h"
 #include "io/io.h"
 #include "linalg/linalg.h"
@@ -99,6 +100,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_uint16), MP_ROM_INT(NDARRAY_UINT16) },
     { MP_ROM_QSTR(MP_QSTR_int16), MP_ROM_INT(NDARRAY_INT16) },
     { MP_ROM_QSTR(MP_QSTR_float), MP_ROM_INT(NDARRAY_FLOAT) },
+    #if ULAB_SUPPORTS_FLOAT16
+        { MP_ROM_QSTR(MP_QSTR_float16), MP_ROM_INT(NDARRAY_FLOAT16) },
+    #endif
     #if ULAB_SUPPORTS_COMPLEX
         { MP_ROM_QSTR(MP_QSTR_complex), MP_ROM_INT(NDARRAY_COMPLEX) },
     #endif
@@ -106,6 +110,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_FFT_MODULE
         { MP_ROM_QSTR(MP_QSTR_fft), MP_ROM_PTR(&ulab_fft_module) },
     #endif
+    #if ULAB_NUMPY_HAS_RANDOM_MODULE
+        { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&ulab_random_module) },
+    #endif
     #if ULAB_NUMPY_HAS_LINALG_MODULE
         { MP_ROM_QSTR(MP_QSTR_linalg), MP_ROM_PTR(&ulab_linalg_module) },
     #endif
@@ -145,6 +152,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_INTERP
         { MP_ROM_QSTR(MP_QSTR_interp), MP_ROM_PTR(&approx_interp_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_INTERP_PLAN
+        { MP_ROM_QSTR(MP_QSTR_interp_plan), MP_ROM_PTR(&approx_interp_plan_type) },
+    #endif
     #if ULAB_NUMPY_HAS_TRAPZ
         { MP_ROM_QSTR(MP_QSTR_trapz), MP_ROM_PTR(&approx_trapz_obj) },
     #endif
@@ -152,6 +162,12 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_FULL
         { MP_ROM_QSTR(MP_QSTR_full), MP_ROM_PTR(&create_full_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_HSTACK
+        { MP_ROM_QSTR(MP_QSTR_hstack), MP_ROM_PTR(&create_hstack_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_VSTACK & (ULAB_MAX_DIMS > 1)
+        { MP_ROM_QSTR(MP_QSTR_vstack), MP_ROM_PTR(&create_vstack_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_LINSPACE
         { MP_ROM_QSTR(MP_QSTR_linspace), MP_ROM_PTR(&create_linspace_obj) },
     #endif
@@ -204,15 +220,30 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
         { MP_ROM_QSTR(MP_QSTR_argmax), MP_ROM_PTR(&numerical_argmax_obj) },
         { MP_ROM_QSTR(MP_QSTR_argmin), MP_ROM_PTR(&numerical_argmin_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_ARGPARTITION
+        { MP_ROM_QSTR(MP_QSTR_argpartition), MP_ROM_PTR(&numerical_argpartition_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_ARGSORT
         { MP_ROM_QSTR(MP_QSTR_argsort), MP_ROM_PTR(&numerical_argsort_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_TOPK
+        { MP_ROM_QSTR(MP_QSTR_argtopk), MP_ROM_PTR(&numerical_argtopk_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_ASARRAY
         { MP_ROM_QSTR(MP_QSTR_asarray), MP_ROM_PTR(&create_asarray_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_BINCOUNT
+        { MP_ROM_QSTR(MP_QSTR_bincount), MP_ROM_PTR(&numerical_bincount_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_CROSS
         { MP_ROM_QSTR(MP_QSTR_cross), MP_ROM_PTR(&numerical_cross_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_CUMPROD
+        { MP_ROM_QSTR(MP_QSTR_cumprod), MP_ROM_PTR(&numerical_cumprod_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_CUMSUM
+        { MP_ROM_QSTR(MP_QSTR_cumsum), MP_ROM_PTR(&numerical_cumsum_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_DIFF
         { MP_ROM_QSTR(MP_QSTR_diff), MP_ROM_PTR(&numerical_diff_obj) },
     #endif
@@ -221,6 +252,17 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
             { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&transform_dot_obj) },
         #endif
     #endif
+    #if ULAB_NUMPY_HAS_EINSUM
+        #if ULAB_MAX_DIMS > 1
+            { MP_ROM_QSTR(MP_QSTR_einsum), MP_ROM_PTR(&transform_einsum_obj) },
+        #endif
+    #endif
+    #if ULAB_NUMPY_HAS_VDOT
+        { MP_ROM_QSTR(MP_QSTR_vdot), MP_ROM_PTR(&transform_vdot_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_AXPY
+        { MP_ROM_QSTR(MP_QSTR_axpy), MP_ROM_PTR(&transform_axpy_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_TRACE
         #if ULAB_MAX_DIMS > 1
             { MP_ROM_QSTR(MP_QSTR_trace), MP_ROM_PTR(&stats_trace_obj) },
@@ -229,12 +271,18 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_FLIP
         { MP_ROM_QSTR(MP_QSTR_flip), MP_ROM_PTR(&numerical_flip_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_HISTOGRAM
+        { MP_ROM_QSTR(MP_QSTR_histogram), MP_ROM_PTR(&numerical_histogram_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_LOAD
         { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&io_load_obj) },
     #endif
     #if ULAB_NUMPY_HAS_LOADTXT
         { MP_ROM_QSTR(MP_QSTR_loadtxt), MP_ROM_PTR(&io_loadtxt_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_NPYWRITER & (ULAB_MAX_DIMS > 1)
+        { MP_ROM_QSTR(MP_QSTR_NpyWriter), MP_ROM_PTR(&io_npywriter_type) },
+    #endif
     #if ULAB_NUMPY_HAS_MINMAX
         { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&numerical_max_obj) },
     #endif
@@ -247,6 +295,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_MINMAX
         { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&numerical_min_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_PARTITION
+        { MP_ROM_QSTR(MP_QSTR_partition), MP_ROM_PTR(&numerical_partition_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_ROLL
         { MP_ROM_QSTR(MP_QSTR_roll), MP_ROM_PTR(&numerical_roll_obj) },
     #endif
@@ -256,9 +307,15 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_SAVETXT
         { MP_ROM_QSTR(MP_QSTR_savetxt), MP_ROM_PTR(&io_savetxt_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_SEARCHSORTED
+        { MP_ROM_QSTR(MP_QSTR_searchsorted), MP_ROM_PTR(&numerical_searchsorted_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_SIZE
         { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&transform_size_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_SLIDING_WINDOW_VIEW & (ULAB_MAX_DIMS > 1)
+        { MP_ROM_QSTR(MP_QSTR_sliding_window_view), MP_ROM_PTR(&transform_sliding_window_view_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_SORT
         { MP_ROM_QSTR(MP_QSTR_sort), MP_ROM_PTR(&numerical_sort_obj) },
     #endif
@@ -268,6 +325,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_SUM
         { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&numerical_sum_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_TOPK
+        { MP_ROM_QSTR(MP_QSTR_topk), MP_ROM_PTR(&numerical_topk_obj) },
+    #endif
     // functions of the poly sub-module
     #if ULAB_NUMPY_HAS_POLYFIT
         { MP_ROM_QSTR(MP_QSTR_polyfit), MP_ROM_PTR(&poly_polyfit_obj) },
@@ -336,6 +396,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_SIN
     { MP_ROM_QSTR(MP_QSTR_sin), MP_ROM_PTR(&vector_sin_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_SINCOS
+    { MP_ROM_QSTR(MP_QSTR_sincos), MP_ROM_PTR(&vector_sincos_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_SINH
     { MP_ROM_QSTR(MP_QSTR_sinh), MP_ROM_PTR(&vector_sinh_obj) },
     #endif
@@ -355,12 +418,18 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
         #if ULAB_NUMPY_HAS_REAL
         { MP_ROM_QSTR(MP_QSTR_real), MP_ROM_PTR(&carray_real_obj) },
         #endif
+        #if ULAB_NUMPY_HAS_CMAC
+        { MP_ROM_QSTR(MP_QSTR_cmac), MP_ROM_PTR(&carray_cmac_obj) },
+        #endif
         #if ULAB_NUMPY_HAS_IMAG
         { MP_ROM_QSTR(MP_QSTR_imag), MP_ROM_PTR(&carray_imag_obj) },
         #endif
         #if ULAB_NUMPY_HAS_CONJUGATE
             { MP_ROM_QSTR(MP_QSTR_conjugate), MP_ROM_PTR(&carray_conjugate_obj) },
         #endif
+        #if ULAB_NUMPY_HAS_MAGPHASE
+            { MP_ROM_QSTR(MP_QSTR_magphase), MP_ROM_PTR(&carray_magphase_obj) },
+        #endif
         #if ULAB_NUMPY_HAS_SORT_COMPLEX
             { MP_ROM_QSTR(MP_QSTR_sort_complex), MP_ROM_PTR(&carray_sort_complex_obj) },
         #endif
@@ -36,7 +36,7 @@ mp_obj_t poly_polyfit(size_t n_args, const mp_obj_t *args) {
     #endif
     size_t lenx = 0, leny = 0;
     uint8_t deg = 0;
-    mp_float_t *x, *XT, *y, *prod;
+    mp_float_t *x, *X, *y;
 
     if(n_args == 2) { // only the y values are supplied
         // TODO: this is actually not enough: the first argument can very well be a matrix,
@@ -72,71 +72,37 @@ mp_obj_t poly_polyfit(size_t n_args, const mp_obj_t *args) {
         fill_array_iterable(y, args[1]);
     }
 
-    // one could probably express X as a function of XT,
-    // and thereby save RAM, because X is used only in the product
-    XT = m_new(mp_float_t, (deg+1)*leny); // XT is a matrix of shape (deg+1, len) (rows, columns)
-    for(size_t i=0; i < leny; i++) { // column index
-        XT[i+0*lenx] = 1.0; // top row
-        for(uint8_t j=1; j < deg+1; j++) { // row index
-            XT[i+j*leny] = XT[i+(j-1)*leny]*x[i];
+    // The Vandermonde matrix X is of shape (len, deg+1); the least-squares
+    // problem X beta = y is solved by Householder QR factorisation, which
+    // sidesteps both the X^T X product, and the matrix inverse of the
+    // normal equations, and is numerically much better conditioned for
+    // high degrees
+    X = m_new(mp_float_t, leny*(deg+1));
+    for(size_t i=0; i < leny; i++) { // row index
+        X[i*(deg+1)] = 1.0; // leftmost column
+        for(uint8_t j=1; j < deg+1; j++) { // column index
+            X[i*(deg+1)+j] = X[i*(deg+1)+(j-1)]*x[i];
         }
     }
 
-    prod = m_new(mp_float_t, (deg+1)*(deg+1)); // the product matrix is of shape (deg+1, deg+1)
-    mp_float_t sum;
-    for(uint8_t i=0; i < deg+1; i++) { // column index
-        for(uint8_t j=0; j < deg+1; j++) { // row index
-            sum = 0.0;
-            for(size_t k=0; k < lenx; k++) {
-                // (j, k) * (k, i)
-                // Note that the second matrix is simply the transpose of the first:
-                // X(k, i) = XT(i, k) = XT[k*lenx+i]
-                sum += XT[j*lenx+k]*XT[i*lenx+k]; // X[k*(deg+1)+i];
-            }
-            prod[j*(deg+1)+i] = sum;
-        }
-    }
-    if(!linalg_invert_matrix(prod, deg+1)) {
-        // Although X was a Vandermonde matrix, whose inverse is guaranteed to exist,
-        // we bail out here, if prod couldn't be inverted: if the values in x are not all
-        // distinct, prod is singular
-        m_del(mp_float_t, XT, (deg+1)*lenx);
+    if(!linalg_qr_solve(X, y, leny, deg+1)) {
+        // if the values in x are not all distinct, X is rank deficient
+        m_del(mp_float_t, X, leny*(deg+1));
         m_del(mp_float_t, x, lenx);
-        m_del(mp_float_t, y, lenx);
-        m_del(mp_float_t, prod, (deg+1)*(deg+1));
+        m_del(mp_float_t, y, leny);
         mp_raise_ValueError(translate("could not invert Vandermonde matrix"));
     }
-    // at this point, we have the inverse of X^T * X
-    // y is a column vector; x is free now, we can use it for storing intermediate values
-    for(uint8_t i=0; i < deg+1; i++) { // row index
-        sum = 0.0;
-        for(size_t j=0; j < lenx; j++) { // column index
-            sum += XT[i*lenx+j]*y[j];
-        }
-        x[i] = sum;
-    }
-    // XT is no longer needed
-    m_del(mp_float_t, XT, (deg+1)*leny);
+    m_del(mp_float_t, X, leny*(deg+1));
+    m_del(mp_float_t, x, lenx);
 
     ndarray_obj_t *beta = ndarray_new_linear_array(deg+1, NDARRAY_FLOAT);
     mp_float_t *betav = (mp_float_t *)beta->array;
-    // x[0..(deg+1)] contains now the product X^T * y; we can get rid of y
-    m_del(float, y, leny);
-
-    // now, we calculate beta, i.e., we apply prod = (X^T * X)^(-1) on x = X^T * y; x is a column vector now
+    // the first deg+1 entries of y hold the solution now;
+    // we have to reverse the order, for the leading coefficient comes first
     for(uint8_t i=0; i < deg+1; i++) {
-        sum = 0.0;
-        for(uint8_t j=0; j < deg+1; j++) {
-            sum += prod[i*(deg+1)+j]*x[j];
-        }
-        betav[i] = sum;
-    }
-    m_del(mp_float_t, x, lenx);
-    m_del(mp_float_t, prod, (deg+1)*(deg+1));
-    for(uint8_t i=0; i < (deg+1)/2; i++) {
-        // We have to reverse the array, for the leading coefficient comes first.
-        SWAP(mp_float_t, betav[i], betav[deg-i]);
+        betav[i] = y[deg-i];
     }
+    m_del(mp_float_t, y, leny);
     return MP_OBJ_FROM_PTR(beta);
 }
 
@@ -0,0 +1,364 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2021 Zoltán Vörös
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "py/misc.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "random.h"
+
+//| """Bulk pseudo-random number generation
+//|
+//| The module keeps a single xoshiro128** generator, and produces whole
+//| arrays per call, writing directly into the target buffer, so that
+//| Monte-Carlo and dither loops never have to box individual samples."""
+//|
+//| import ulab.numpy
+
+// the state of the xoshiro128** generator; the default seed is
+// arbitrary, but fixed, so that runs are reproducible
+static uint32_t random_state[4] = {0x8764000bUL, 0xf542d2d3UL, 0x6fa035c3UL, 0x77f2db5bUL};
+
+static inline uint32_t random_rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint32_t random_next(void) {
+    const uint32_t result = random_rotl(random_state[1] * 5, 7) * 9;
+    const uint32_t t = random_state[1] << 9;
+
+    random_state[2] ^= random_state[0];
+    random_state[3] ^= random_state[1];
+    random_state[1] ^= random_state[2];
+    random_state[0] ^= random_state[3];
+
+    random_state[2] ^= t;
+    random_state[3] = random_rotl(random_state[3], 11);
+
+    return result;
+}
+
+static mp_float_t random_float(void) {
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+    // 24 random bits fill the single-precision mantissa
+    return (random_next() >> 8) * MICROPY_FLOAT_CONST(5.9604644775390625e-8); // 2^-24
+    #else
+    // two draws supply the 52 mantissa bits of a double
+    mp_float_t high = (mp_float_t)(random_next() >> 6); // 26 bits
+    mp_float_t low = (mp_float_t)(random_next() >> 6);
+    return (high * MICROPY_FLOAT_CONST(67108864.0) + low) * MICROPY_FLOAT_CONST(1.1102230246251565e-16); // 2^-52
+    #endif
+}
+
+// returns the target array of a generator function: the dense out array,
+// if one was supplied, otherwise a new dense array of the requested size,
+// which may be an integer, or a tuple of integers; a NULL return value
+// indicates that a single scalar was requested
+static ndarray_obj_t *random_make_array(mp_obj_t size_in, mp_obj_t out_in, uint8_t dtype) {
+    if(out_in != mp_const_none) {
+        if(!mp_obj_is_type(out_in, &ulab_ndarray_type)) {
+            mp_raise_TypeError(translate("wrong output type"));
+        }
+        ndarray_obj_t *out = MP_OBJ_TO_PTR(out_in);
+        if((out->dtype != dtype) || !ndarray_is_dense(out)) {
+            mp_raise_ValueError(translate("out must be a dense array of the requested dtype"));
+        }
+        if(size_in != mp_const_none) {
+            mp_raise_ValueError(translate("size and out are mutually exclusive"));
+        }
+        return out;
+    }
+    if(size_in == mp_const_none) {
+        return NULL;
+    }
+    if(mp_obj_is_int(size_in)) {
+        return ndarray_new_linear_array((size_t)mp_obj_get_int(size_in), dtype);
+    }
+    if(mp_obj_is_type(size_in, &mp_type_tuple)) {
+        mp_obj_tuple_t *size = MP_OBJ_TO_PTR(size_in);
+        if(size->len > ULAB_MAX_DIMS) {
+            mp_raise_ValueError(translate("maximum number of dimensions is " MP_STRINGIFY(ULAB_MAX_DIMS)));
+        }
+        size_t shape[ULAB_MAX_DIMS] = {0};
+        for(uint8_t i = 0; i < size->len; i++) {
+            shape[ULAB_MAX_DIMS - size->len + i] = (size_t)mp_obj_get_int(size->items[i]);
+        }
+        return ndarray_new_dense_ndarray((uint8_t)size->len, shape, dtype);
+    }
+    mp_raise_TypeError(translate("size must be an integer, or a tuple of integers"));
+    return NULL;
+}
+
+#if ULAB_RANDOM_HAS_SEED
+//| def seed(n: int) -> None:
+//|     """Re-seeds the generator, so that the sequence of samples repeats."""
+//|     ...
+//|
+
+static mp_obj_t random_seed(mp_obj_t seed_in) {
+    // expand the single integer with a splitmix32 sequence, so that
+    // small seeds still fill the state with well-mixed bits
+    uint32_t x = (uint32_t)mp_obj_get_int_truncated(seed_in);
+    for(uint8_t i = 0; i < 4; i++) {
+        x += 0x9e3779b9UL;
+        uint32_t z = x;
+        z = (z ^ (z >> 16)) * 0x21f0aaadUL;
+        z = (z ^ (z >> 15)) * 0x735a2d97UL;
+        random_state[i] = z ^ (z >> 15);
+    }
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(random_seed_obj, random_seed);
+#endif /* ULAB_RANDOM_HAS_SEED */
+
+#if ULAB_RANDOM_HAS_RANDOM || ULAB_RANDOM_HAS_UNIFORM
+static void random_fill_uniform(mp_float_t *array, size_t len, mp_float_t low, mp_float_t high) {
+    mp_float_t span = high - low;
+    for(size_t i = 0; i < len; i++) {
+        *array++ = low + span * random_float();
+    }
+}
+#endif
+
+#if ULAB_RANDOM_HAS_RANDOM
+//| def random(size: Optional[Union[int, Tuple[int, ...]]] = None, *, out: Optional[ulab.numpy.ndarray] = None) -> Union[_float, ulab.numpy.ndarray]:
+//|     """Returns samples from the uniform distribution on [0, 1): a single
+//|     float, if size is not supplied, otherwise a whole array per call.
+//|     With out, the samples are written directly into the supplied dense
+//|     float array, and no memory is allocated."""
+//|     ...
+//|
+
+static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_size, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = random_make_array(args[0].u_obj, args[1].u_obj, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        return mp_obj_new_float(random_float());
+    }
+    random_fill_uniform((mp_float_t *)ndarray->array, ndarray->len, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_random_obj, 0, random_random);
+#endif /* ULAB_RANDOM_HAS_RANDOM */
+
+#if ULAB_RANDOM_HAS_UNIFORM
+//| def uniform(low: _float = 0.0, high: _float = 1.0, size: Optional[Union[int, Tuple[int, ...]]] = None, *, out: Optional[ulab.numpy.ndarray] = None) -> Union[_float, ulab.numpy.ndarray]:
+//|     """Returns samples from the uniform distribution on [low, high)."""
+//|     ...
+//|
+
+static mp_obj_t random_uniform(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_low, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_high, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t low = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t high = MICROPY_FLOAT_CONST(1.0);
+    if(args[0].u_obj != mp_const_none) {
+        low = mp_obj_get_float(args[0].u_obj);
+    }
+    if(args[1].u_obj != mp_const_none) {
+        high = mp_obj_get_float(args[1].u_obj);
+    }
+
+    ndarray_obj_t *ndarray = random_make_array(args[2].u_obj, args[3].u_obj, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        return mp_obj_new_float(low + (high - low) * random_float());
+    }
+    random_fill_uniform((mp_float_t *)ndarray->array, ndarray->len, low, high);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_uniform_obj, 0, random_uniform);
+#endif /* ULAB_RANDOM_HAS_UNIFORM */
+
+#if ULAB_RANDOM_HAS_NORMAL
+//| def normal(loc: _float = 0.0, scale: _float = 1.0, size: Optional[Union[int, Tuple[int, ...]]] = None, *, out: Optional[ulab.numpy.ndarray] = None) -> Union[_float, ulab.numpy.ndarray]:
+//|     """Returns samples from the normal distribution with mean loc, and
+//|     standard deviation scale, generated in pairs with the Marsaglia
+//|     polar method."""
+//|     ...
+//|
+
+static void random_fill_normal(mp_float_t *array, size_t len, mp_float_t loc, mp_float_t scale) {
+    size_t i = 0;
+    while(i < len) {
+        // the polar method turns a pair of uniform samples from the unit
+        // disc into a pair of independent normal samples, with a single
+        // log and square root per pair, and no trigonometric functions
+        mp_float_t u, v, s;
+        do {
+            u = MICROPY_FLOAT_CONST(2.0) * random_float() - MICROPY_FLOAT_CONST(1.0);
+            v = MICROPY_FLOAT_CONST(2.0) * random_float() - MICROPY_FLOAT_CONST(1.0);
+            s = u * u + v * v;
+        } while((s >= MICROPY_FLOAT_CONST(1.0)) || (s == MICROPY_FLOAT_CONST(0.0)));
+        s = MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_CONST(-2.0) * MICROPY_FLOAT_C_FUN(log)(s) / s);
+        array[i++] = loc + scale * u * s;
+        if(i < len) {
+            array[i++] = loc + scale * v * s;
+        }
+    }
+}
+
+static mp_obj_t random_normal(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_loc, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_scale, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t loc = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t scale = MICROPY_FLOAT_CONST(1.0);
+    if(args[0].u_obj != mp_const_none) {
+        loc = mp_obj_get_float(args[0].u_obj);
+    }
+    if(args[1].u_obj != mp_const_none) {
+        scale = mp_obj_get_float(args[1].u_obj);
+    }
+
+    ndarray_obj_t *ndarray = random_make_array(args[2].u_obj, args[3].u_obj, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        mp_float_t value;
+        random_fill_normal(&value, 1, loc, scale);
+        return mp_obj_new_float(value);
+    }
+    random_fill_normal((mp_float_t *)ndarray->array, ndarray->len, loc, scale);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_normal_obj, 0, random_normal);
+#endif /* ULAB_RANDOM_HAS_NORMAL */
+
+#if ULAB_RANDOM_HAS_RANDINT
+//| def randint(low: int, high: Optional[int] = None, size: Optional[Union[int, Tuple[int, ...]]] = None, *, dtype: _DType = ulab.numpy.int16) -> Union[int, ulab.numpy.ndarray]:
+//|     """Returns integers from [low, high), or from [0, low), if high is
+//|     not supplied, in an array of the requested integer dtype."""
+//|     ...
+//|
+
+static mp_obj_t random_randint(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_high, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = NDARRAY_INT16 } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t low = mp_obj_get_int(args[0].u_obj);
+    mp_int_t high;
+    if(args[1].u_obj == mp_const_none) {
+        high = low;
+        low = 0;
+    } else {
+        high = mp_obj_get_int(args[1].u_obj);
+    }
+    if(high <= low) {
+        mp_raise_ValueError(translate("high must be greater than low"));
+    }
+    uint32_t span = (uint32_t)(high - low);
+
+    uint8_t dtype = (uint8_t)args[3].u_int;
+    if(args[4].u_obj != mp_const_none) {
+        // with out, the target's dtype takes the place of the dtype argument
+        dtype = ((ndarray_obj_t *)MP_OBJ_TO_PTR(args[4].u_obj))->dtype;
+    }
+    if(dtype == NDARRAY_FLOAT) {
+        mp_raise_ValueError(translate("wrong dtype"));
+    }
+
+    ndarray_obj_t *ndarray = random_make_array(args[2].u_obj, args[4].u_obj, dtype);
+    if(ndarray == NULL) {
+        return mp_obj_new_int(low + (mp_int_t)(((uint64_t)random_next() * span) >> 32));
+    }
+    // the widening multiply maps a 32-bit draw onto the span without a division
+    if(dtype == NDARRAY_UINT8) {
+        uint8_t *array = (uint8_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            *array++ = (uint8_t)(low + (mp_int_t)(((uint64_t)random_next() * span) >> 32));
+        }
+    } else if(dtype == NDARRAY_INT8) {
+        int8_t *array = (int8_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            *array++ = (int8_t)(low + (mp_int_t)(((uint64_t)random_next() * span) >> 32));
+        }
+    } else if(dtype == NDARRAY_UINT16) {
+        uint16_t *array = (uint16_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            *array++ = (uint16_t)(low + (mp_int_t)(((uint64_t)random_next() * span) >> 32));
+        }
+    } else {
+        int16_t *array = (int16_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            *array++ = (int16_t)(low + (mp_int_t)(((uint64_t)random_next() * span) >> 32));
+        }
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_randint_obj, 1, random_randint);
+#endif /* ULAB_RANDOM_HAS_RANDINT */
+
+STATIC const mp_rom_map_elem_t ulab_random_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_random) },
+    #if ULAB_RANDOM_HAS_NORMAL
+    { MP_ROM_QSTR(MP_QSTR_normal), MP_ROM_PTR(&random_normal_obj) },
+    #endif
+    #if ULAB_RANDOM_HAS_RANDINT
+    { MP_ROM_QSTR(MP_QSTR_randint), MP_ROM_PTR(&random_randint_obj) },
+    #endif
+    #if ULAB_RANDOM_HAS_RANDOM
+    { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&random_random_obj) },
+    #endif
+    #if ULAB_RANDOM_HAS_SEED
+    { MP_ROM_QSTR(MP_QSTR_seed), MP_ROM_PTR(&random_seed_obj) },
+    #endif
+    #if ULAB_RANDOM_HAS_UNIFORM
+    { MP_ROM_QSTR(MP_QSTR_uniform), MP_ROM_PTR(&random_uniform_obj) },
+    #endif
+};
+
+STATIC MP_DEFINE_CONST_DICT(mp_module_ulab_random_globals, ulab_random_globals_table);
+
+const mp_obj_module_t ulab_random_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_random_globals,
+};
+#if CIRCUITPY_ULAB
+#if !defined(MICROPY_VERSION) || MICROPY_VERSION <= 70144
+MP_REGISTER_MODULE(MP_QSTR_ulab_dot_numpy_dot_random, ulab_random_module, MODULE_ULAB_ENABLED);
+#else
+MP_REGISTER_MODULE(MP_QSTR_ulab_dot_numpy_dot_random, ulab_random_module);
+#endif
+#endif
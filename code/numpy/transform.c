@@ -352,9 +352,227 @@ MP_DEFINE_CONST_FUN_OBJ_KW(transform_delete_obj, 2, transform_delete);
 //|    ...
 //|
 
-mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
+#if ULAB_NUMPY_DOT_USES_BLOCKED_KERNEL
+typedef struct _transform_dot_job_t {
+    ndarray_obj_t *m1;
+    ndarray_obj_t *m2;
+    mp_float_t *rarray;
+    size_t K;
+    size_t N;
+    mp_float_t *bpanel[2];
+} transform_dot_job_t;
+
+static void transform_dot_blocked_float_range(void *job_in, size_t ib_start, size_t ib_end, uint8_t slot) {
+    // cache-blocked product of dense float matrices: panels of four columns
+    // of m2 are packed into contiguous scratch memory, so that the strided
+    // column walk is paid only once per panel, and a 4-by-4 register-blocked
+    // micro-kernel accumulates the products; the worker computes the rows
+    // [ib_start, ib_end) of the result, so that two cores can share the work
+    transform_dot_job_t *job = (transform_dot_job_t *)job_in;
+    ndarray_obj_t *m2 = job->m2;
+    size_t K = job->K;
+    size_t N = job->N;
+    mp_float_t *rarray = job->rarray;
+    mp_float_t *A = (mp_float_t *)job->m1->array;
+    uint8_t *barray = (uint8_t *)m2->array;
+    mp_float_t *bpanel = job->bpanel[slot];
+
+    for(size_t jb = 0; jb < N; jb += 4) {
+        size_t nj = N - jb < 4 ? N - jb : 4;
+        // pack the panel, padding the right edge with zeros
+        for(size_t k = 0; k < K; k++) {
+            uint8_t *bptr = barray + k * m2->strides[ULAB_MAX_DIMS - 2] + jb * m2->strides[ULAB_MAX_DIMS - 1];
+            for(size_t jj = 0; jj < 4; jj++) {
+                bpanel[4 * k + jj] = jj < nj ? *(mp_float_t *)bptr : MICROPY_FLOAT_CONST(0.0);
+                bptr += m2->strides[ULAB_MAX_DIMS - 1];
+            }
+        }
+        for(size_t ib = ib_start; ib < ib_end; ib += 4) {
+            size_t ni = ib_end - ib < 4 ? ib_end - ib : 4;
+            // rows beyond the bottom edge are aliased to the first row of
+            // the block; their results are simply discarded
+            mp_float_t *arow0 = A + ib * K;
+            mp_float_t *arow1 = A + (ib + (ni > 1 ? 1 : 0)) * K;
+            mp_float_t *arow2 = A + (ib + (ni > 2 ? 2 : 0)) * K;
+            mp_float_t *arow3 = A + (ib + (ni > 3 ? 3 : 0)) * K;
+            mp_float_t acc[16] = { MICROPY_FLOAT_CONST(0.0) };
+            mp_float_t *bp = bpanel;
+            for(size_t k = 0; k < K; k++) {
+                mp_float_t b0 = bp[0];
+                mp_float_t b1 = bp[1];
+                mp_float_t b2 = bp[2];
+                mp_float_t b3 = bp[3];
+                bp += 4;
+                mp_float_t a = arow0[k];
+                acc[0] += a * b0;
+                acc[1] += a * b1;
+                acc[2] += a * b2;
+                acc[3] += a * b3;
+                a = arow1[k];
+                acc[4] += a * b0;
+                acc[5] += a * b1;
+                acc[6] += a * b2;
+                acc[7] += a * b3;
+                a = arow2[k];
+                acc[8] += a * b0;
+                acc[9] += a * b1;
+                acc[10] += a * b2;
+                acc[11] += a * b3;
+                a = arow3[k];
+                acc[12] += a * b0;
+                acc[13] += a * b1;
+                acc[14] += a * b2;
+                acc[15] += a * b3;
+            }
+            for(size_t ii = 0; ii < ni; ii++) {
+                for(size_t jj = 0; jj < nj; jj++) {
+                    rarray[(ib + ii) * N + jb + jj] = acc[4 * ii + jj];
+                }
+            }
+        }
+    }
+}
+
+static void transform_dot_blocked_float(ndarray_obj_t *m1, ndarray_obj_t *m2, mp_float_t *rarray,
+                                    size_t M, size_t K, size_t N) {
+    SCRATCH_ACQUIRE();
+    transform_dot_job_t job = { m1, m2, rarray, K, N, { SCRATCH_NEW(mp_float_t, 4 * K), NULL } };
+    #if ULAB_HAS_DUAL_CORE
+    // each core packs into its own panel; the scratch pool is not thread
+    // safe, so both panels are carved out before the handoff
+    job.bpanel[1] = SCRATCH_NEW(mp_float_t, 4 * K);
+    #endif
+    // rows, not elements: a 16-row product already carries enough work per
+    // row for the handoff to pay off
+    ulab_parallel_run(transform_dot_blocked_float_range, &job, M, 16);
+    SCRATCH_RELEASE();
+}
+
+static void transform_dot_blocked_int16(ndarray_obj_t *m1, ndarray_obj_t *m2, mp_float_t *rarray,
+                                    size_t M, size_t K, size_t N) {
+    // the int16 counterpart of the blocked kernel above; the inner loop
+    // is unrolled by two positions, so that the compiler can fuse the
+    // pairs of products into dual multiply-accumulate instructions, where
+    // the target supports them
+    int16_t *A = (int16_t *)m1->array;
+    uint8_t *barray = (uint8_t *)m2->array;
+
+    SCRATCH_ACQUIRE();
+    int16_t *bpanel = SCRATCH_NEW(int16_t, 4 * K);
+
+    for(size_t jb = 0; jb < N; jb += 4) {
+        size_t nj = N - jb < 4 ? N - jb : 4;
+        for(size_t k = 0; k < K; k++) {
+            uint8_t *bptr = barray + k * m2->strides[ULAB_MAX_DIMS - 2] + jb * m2->strides[ULAB_MAX_DIMS - 1];
+            for(size_t jj = 0; jj < 4; jj++) {
+                bpanel[4 * k + jj] = jj < nj ? *(int16_t *)bptr : 0;
+                bptr += m2->strides[ULAB_MAX_DIMS - 1];
+            }
+        }
+        for(size_t ib = 0; ib < M; ib += 4) {
+            size_t ni = M - ib < 4 ? M - ib : 4;
+            int16_t *arow0 = A + ib * K;
+            int16_t *arow1 = A + (ib + (ni > 1 ? 1 : 0)) * K;
+            int16_t *arow2 = A + (ib + (ni > 2 ? 2 : 0)) * K;
+            int16_t *arow3 = A + (ib + (ni > 3 ? 3 : 0)) * K;
+            int64_t acc[16] = { 0 };
+            int16_t *bp = bpanel;
+            size_t k = 0;
+            for( ; k + 2 <= K; k += 2) {
+                acc[0] += (int32_t)arow0[k] * bp[0] + (int32_t)arow0[k + 1] * bp[4];
+                acc[1] += (int32_t)arow0[k] * bp[1] + (int32_t)arow0[k + 1] * bp[5];
+                acc[2] += (int32_t)arow0[k] * bp[2] + (int32_t)arow0[k + 1] * bp[6];
+                acc[3] += (int32_t)arow0[k] * bp[3] + (int32_t)arow0[k + 1] * bp[7];
+                acc[4] += (int32_t)arow1[k] * bp[0] + (int32_t)arow1[k + 1] * bp[4];
+                acc[5] += (int32_t)arow1[k] * bp[1] + (int32_t)arow1[k + 1] * bp[5];
+                acc[6] += (int32_t)arow1[k] * bp[2] + (int32_t)arow1[k + 1] * bp[6];
+                acc[7] += (int32_t)arow1[k] * bp[3] + (int32_t)arow1[k + 1] * bp[7];
+                acc[8] += (int32_t)arow2[k] * bp[0] + (int32_t)arow2[k + 1] * bp[4];
+                acc[9] += (int32_t)arow2[k] * bp[1] + (int32_t)arow2[k + 1] * bp[5];
+                acc[10] += (int32_t)arow2[k] * bp[2] + (int32_t)arow2[k + 1] * bp[6];
+                acc[11] += (int32_t)arow2[k] * bp[3] + (int32_t)arow2[k + 1] * bp[7];
+                acc[12] += (int32_t)arow3[k] * bp[0] + (int32_t)arow3[k + 1] * bp[4];
+                acc[13] += (int32_t)arow3[k] * bp[1] + (int32_t)arow3[k + 1] * bp[5];
+                acc[14] += (int32_t)arow3[k] * bp[2] + (int32_t)arow3[k + 1] * bp[6];
+                acc[15] += (int32_t)arow3[k] * bp[3] + (int32_t)arow3[k + 1] * bp[7];
+                bp += 8;
+            }
+            if(k < K) {
+                for(size_t jj = 0; jj < 4; jj++) {
+                    acc[jj] += (int32_t)arow0[k] * bp[jj];
+                    acc[4 + jj] += (int32_t)arow1[k] * bp[jj];
+                    acc[8 + jj] += (int32_t)arow2[k] * bp[jj];
+                    acc[12 + jj] += (int32_t)arow3[k] * bp[jj];
+                }
+            }
+            for(size_t ii = 0; ii < ni; ii++) {
+                for(size_t jj = 0; jj < nj; jj++) {
+                    rarray[(ib + ii) * N + jb + jj] = (mp_float_t)acc[4 * ii + jj];
+                }
+            }
+        }
+    }
+    SCRATCH_RELEASE();
+}
+#endif /* ULAB_NUMPY_DOT_USES_BLOCKED_KERNEL */
+
+#if ULAB_LINALG_HAS_BATCH & (ULAB_MAX_DIMS > 2)
+static void transform_dot_small(mp_float_t *c, mp_float_t *a, mp_float_t *b, size_t N) {
+    // fully unrolled matrix products for the 2x2, 3x3, and 4x4 cases;
+    // all indices are compile-time constants, so the operands stay in
+    // registers throughout
+    if(N == 2) {
+        c[0] = a[0] * b[0] + a[1] * b[2];
+        c[1] = a[0] * b[1] + a[1] * b[3];
+        c[2] = a[2] * b[0] + a[3] * b[2];
+        c[3] = a[2] * b[1] + a[3] * b[3];
+    } else if(N == 3) {
+        c[0] = a[0] * b[0] + a[1] * b[3] + a[2] * b[6];
+        c[1] = a[0] * b[1] + a[1] * b[4] + a[2] * b[7];
+        c[2] = a[0] * b[2] + a[1] * b[5] + a[2] * b[8];
+        c[3] = a[3] * b[0] + a[4] * b[3] + a[5] * b[6];
+        c[4] = a[3] * b[1] + a[4] * b[4] + a[5] * b[7];
+        c[5] = a[3] * b[2] + a[4] * b[5] + a[5] * b[8];
+        c[6] = a[6] * b[0] + a[7] * b[3] + a[8] * b[6];
+        c[7] = a[6] * b[1] + a[7] * b[4] + a[8] * b[7];
+        c[8] = a[6] * b[2] + a[7] * b[5] + a[8] * b[8];
+    } else { // N == 4
+        c[0] = a[0] * b[0] + a[1] * b[4] + a[2] * b[8] + a[3] * b[12];
+        c[1] = a[0] * b[1] + a[1] * b[5] + a[2] * b[9] + a[3] * b[13];
+        c[2] = a[0] * b[2] + a[1] * b[6] + a[2] * b[10] + a[3] * b[14];
+        c[3] = a[0] * b[3] + a[1] * b[7] + a[2] * b[11] + a[3] * b[15];
+        c[4] = a[4] * b[0] + a[5] * b[4] + a[6] * b[8] + a[7] * b[12];
+        c[5] = a[4] * b[1] + a[5] * b[5] + a[6] * b[9] + a[7] * b[13];
+        c[6] = a[4] * b[2] + a[5] * b[6] + a[6] * b[10] + a[7] * b[14];
+        c[7] = a[4] * b[3] + a[5] * b[7] + a[6] * b[11] + a[7] * b[15];
+        c[8] = a[8] * b[0] + a[9] * b[4] + a[10] * b[8] + a[11] * b[12];
+        c[9] = a[8] * b[1] + a[9] * b[5] + a[10] * b[9] + a[11] * b[13];
+        c[10] = a[8] * b[2] + a[9] * b[6] + a[10] * b[10] + a[11] * b[14];
+        c[11] = a[8] * b[3] + a[9] * b[7] + a[10] * b[11] + a[11] * b[15];
+        c[12] = a[12] * b[0] + a[13] * b[4] + a[14] * b[8] + a[15] * b[12];
+        c[13] = a[12] * b[1] + a[13] * b[5] + a[14] * b[9] + a[15] * b[13];
+        c[14] = a[12] * b[2] + a[13] * b[6] + a[14] * b[10] + a[15] * b[14];
+        c[15] = a[12] * b[3] + a[13] * b[7] + a[14] * b[11] + a[15] * b[15];
+    }
+}
+#endif /* ULAB_LINALG_HAS_BATCH */
+
+mp_obj_t transform_dot(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     // TODO: should the results be upcast?
     // This implements 2D operations only!
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t _m1 = args[0].u_obj;
+    mp_obj_t _m2 = args[1].u_obj;
+    mp_obj_t out = args[2].u_obj;
+
     if(!mp_obj_is_type(_m1, &ulab_ndarray_type) || !mp_obj_is_type(_m2, &ulab_ndarray_type)) {
         mp_raise_TypeError(translate("arguments must be ndarrays"));
     }
@@ -369,6 +587,58 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     mp_float_t (*func1)(void *) = ndarray_get_float_function(m1->dtype);
     mp_float_t (*func2)(void *) = ndarray_get_float_function(m2->dtype);
 
+    #if ULAB_LINALG_HAS_BATCH & (ULAB_MAX_DIMS > 2)
+    if((m1->ndim == 3) && (m2->ndim == 3)) {
+        // the leading axis is a batch dimension: multiply all matrix pairs
+        // in a single call
+        if((m1->shape[ULAB_MAX_DIMS - 3] != m2->shape[ULAB_MAX_DIMS - 3]) ||
+            (m1->shape[ULAB_MAX_DIMS - 1] != m2->shape[ULAB_MAX_DIMS - 2])) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        size_t batch = m1->shape[ULAB_MAX_DIMS - 3];
+        size_t M = m1->shape[ULAB_MAX_DIMS - 2];
+        size_t K = m1->shape[ULAB_MAX_DIMS - 1];
+        size_t N = m2->shape[ULAB_MAX_DIMS - 1];
+
+        ndarray_obj_t *batched = tools_validate_out(out, 3, ndarray_shape_vector(0, batch, M, N), NDARRAY_FLOAT);
+        mp_float_t *rarray = (mp_float_t *)batched->array;
+
+        if((M == K) && (K == N) && (N > 1) && (N < 5) &&
+            (m1->dtype == NDARRAY_FLOAT) && (m2->dtype == NDARRAY_FLOAT) &&
+            ndarray_is_dense(m1) && ndarray_is_dense(m2)) {
+            mp_float_t *a = (mp_float_t *)array1;
+            mp_float_t *b = (mp_float_t *)array2;
+            for(size_t p = 0; p < batch; p++) {
+                transform_dot_small(rarray, a, b, N);
+                a += N * N;
+                b += N * N;
+                rarray += N * N;
+            }
+        } else {
+            for(size_t p = 0; p < batch; p++) {
+                uint8_t *abatch = array1 + p * m1->strides[ULAB_MAX_DIMS - 3];
+                uint8_t *bbatch = array2 + p * m2->strides[ULAB_MAX_DIMS - 3];
+                for(size_t i = 0; i < M; i++) { // rows of m1
+                    uint8_t *arow = abatch + i * m1->strides[ULAB_MAX_DIMS - 2];
+                    for(size_t j = 0; j < N; j++) { // columns of m2
+                        uint8_t *apos = arow;
+                        uint8_t *bpos = bbatch + j * m2->strides[ULAB_MAX_DIMS - 1];
+                        mp_float_t dot = 0.0;
+                        for(size_t k = 0; k < K; k++) {
+                            // (p, i, k) * (p, k, j)
+                            dot += func1(apos) * func2(bpos);
+                            apos += m1->strides[ULAB_MAX_DIMS - 1];
+                            bpos += m2->strides[ULAB_MAX_DIMS - 2];
+                        }
+                        *rarray++ = dot;
+                    }
+                }
+            }
+        }
+        return MP_OBJ_FROM_PTR(batched);
+    }
+    #endif
+
     if(m1->shape[ULAB_MAX_DIMS - 1] != m2->shape[ULAB_MAX_DIMS - m2->ndim]) {
         mp_raise_ValueError(translate("dimensions do not match"));
     }
@@ -382,9 +652,22 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     } else { // matrix times vector -> vector, vector times vector -> vector (size 1)
         shape = ndarray_shape_vector(0, 0, 0, shape1);
     }
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = tools_validate_out(out, ndim, shape, NDARRAY_FLOAT);
     mp_float_t *rarray = (mp_float_t *)results->array;
 
+    #if ULAB_NUMPY_DOT_USES_BLOCKED_KERNEL
+    if((m1->ndim == 2) && (m2->ndim == 2) && (m1->dtype == m2->dtype) && ndarray_is_dense(m1)) {
+        // m2 does not have to be dense: packing the panels absorbs its strides
+        if(m1->dtype == NDARRAY_FLOAT) {
+            transform_dot_blocked_float(m1, m2, rarray, shape1, m1->shape[ULAB_MAX_DIMS - 1], shape2);
+            return MP_OBJ_FROM_PTR(results);
+        } else if(m1->dtype == NDARRAY_INT16) {
+            transform_dot_blocked_int16(m1, m2, rarray, shape1, m1->shape[ULAB_MAX_DIMS - 1], shape2);
+            return MP_OBJ_FROM_PTR(results);
+        }
+    }
+    #endif
+
     for(size_t i=0; i < shape1; i++) { // rows of m1
         for(size_t j=0; j < shape2; j++) { // columns of m2
             mp_float_t dot = 0.0;
@@ -409,10 +692,414 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     }
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(transform_dot_obj, transform_dot);
+MP_DEFINE_CONST_FUN_OBJ_KW(transform_dot_obj, 2, transform_dot);
 #endif /* ULAB_NUMPY_HAS_DOT */
 #endif /* ULAB_MAX_DIMS > 1 */
 
+#if ULAB_MAX_DIMS > 1
+#if ULAB_NUMPY_HAS_EINSUM
+
+// element accessors for the einsum kernels; the index arithmetic is kept
+// in one place, so that the loop nests below stay readable
+static mp_float_t einsum_get1(ndarray_obj_t *a, mp_float_t (*func)(void *), size_t i) {
+    return func((uint8_t *)a->array + i * a->strides[ULAB_MAX_DIMS - 1]);
+}
+
+static mp_float_t einsum_get2(ndarray_obj_t *a, mp_float_t (*func)(void *), size_t i, size_t j) {
+    return func((uint8_t *)a->array + i * a->strides[ULAB_MAX_DIMS - 2] + j * a->strides[ULAB_MAX_DIMS - 1]);
+}
+
+//| def einsum(subscripts: str, *operands: ulab.numpy.ndarray) -> Union[ulab.numpy.ndarray, float]:
+//|     """
+//|     :param str subscripts: the contraction pattern
+//|     :param ~ulab.numpy.ndarray operands: the arrays to be contracted
+//|     :return: the contraction; a new float array, or a scalar
+//|
+//|     Restricted form of numpy's einsum: only a fixed set of two- and
+//|     three-operand patterns is supported ("i,i->", "ij,j->i",
+//|     "ij,jk->ik", "ji,jk->ik", "ij,kj->ik", "ij,ij->", "ij,ji->",
+//|     "ij,ji->i", and "ij,jk,k->i"), but each is evaluated in a single
+//|     fused loop nest, without materialising intermediate arrays"""
+//|     ...
+//|
+
+static mp_obj_t transform_einsum(size_t n_args, const mp_obj_t *args) {
+    GET_STR_DATA_LEN(args[0], spec, spec_len);
+
+    ndarray_obj_t *ops[3];
+    mp_float_t (*funcs[3])(void *);
+    for(size_t p = 1; p < n_args; p++) {
+        if(!mp_obj_is_type(args[p], &ulab_ndarray_type)) {
+            mp_raise_TypeError(translate("arguments must be ndarrays"));
+        }
+        ops[p - 1] = MP_OBJ_TO_PTR(args[p]);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ops[p - 1]->dtype)
+        funcs[p - 1] = ndarray_get_float_function(ops[p - 1]->dtype);
+    }
+
+    ndarray_obj_t *A = ops[0];
+    ndarray_obj_t *B = ops[1];
+
+    if((spec_len == 5) && (memcmp(spec, "i,i->", 5) == 0) && (n_args == 3)) {
+        // vector dot product
+        if((A->ndim != 1) || (B->ndim != 1) || (A->len != B->len)) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i = 0; i < A->len; i++) {
+            sum += einsum_get1(A, funcs[0], i) * einsum_get1(B, funcs[1], i);
+        }
+        return mp_obj_new_float(sum);
+    }
+
+    if((spec_len == 7) && (memcmp(spec, "ij,j->i", 7) == 0) && (n_args == 3)) {
+        // matrix-vector product
+        size_t M = A->shape[ULAB_MAX_DIMS - 2];
+        size_t N = A->shape[ULAB_MAX_DIMS - 1];
+        if((A->ndim != 2) || (B->ndim != 1) || (B->len != N)) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        ndarray_obj_t *results = ndarray_new_linear_array(M, NDARRAY_FLOAT);
+        mp_float_t *rarray = (mp_float_t *)results->array;
+        for(size_t i = 0; i < M; i++) {
+            mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+            for(size_t j = 0; j < N; j++) {
+                sum += einsum_get2(A, funcs[0], i, j) * einsum_get1(B, funcs[1], j);
+            }
+            *rarray++ = sum;
+        }
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    if((spec_len == 7) && (memcmp(spec, "ij,ij->", 7) == 0) && (n_args == 3)) {
+        // Frobenius inner product
+        if((A->ndim != 2) || (B->ndim != 2) ||
+            (A->shape[ULAB_MAX_DIMS - 2] != B->shape[ULAB_MAX_DIMS - 2]) ||
+            (A->shape[ULAB_MAX_DIMS - 1] != B->shape[ULAB_MAX_DIMS - 1])) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i = 0; i < A->shape[ULAB_MAX_DIMS - 2]; i++) {
+            for(size_t j = 0; j < A->shape[ULAB_MAX_DIMS - 1]; j++) {
+                sum += einsum_get2(A, funcs[0], i, j) * einsum_get2(B, funcs[1], i, j);
+            }
+        }
+        return mp_obj_new_float(sum);
+    }
+
+    if((spec_len >= 7) && (memcmp(spec, "ij,ji->", 7) == 0) && (n_args == 3)) {
+        // the trace of A B, or, with the trailing i, the diagonal of A B
+        size_t M = A->shape[ULAB_MAX_DIMS - 2];
+        size_t N = A->shape[ULAB_MAX_DIMS - 1];
+        if((A->ndim != 2) || (B->ndim != 2) ||
+            (B->shape[ULAB_MAX_DIMS - 2] != N) || (B->shape[ULAB_MAX_DIMS - 1] != M)) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        if(spec_len == 7) { // "ij,ji->"
+            mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+            for(size_t i = 0; i < M; i++) {
+                for(size_t j = 0; j < N; j++) {
+                    sum += einsum_get2(A, funcs[0], i, j) * einsum_get2(B, funcs[1], j, i);
+                }
+            }
+            return mp_obj_new_float(sum);
+        }
+        if((spec_len == 8) && (spec[7] == 'i')) { // "ij,ji->i": diag(A B)
+            ndarray_obj_t *results = ndarray_new_linear_array(M, NDARRAY_FLOAT);
+            mp_float_t *rarray = (mp_float_t *)results->array;
+            for(size_t i = 0; i < M; i++) {
+                mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+                for(size_t j = 0; j < N; j++) {
+                    sum += einsum_get2(A, funcs[0], i, j) * einsum_get2(B, funcs[1], j, i);
+                }
+                *rarray++ = sum;
+            }
+            return MP_OBJ_FROM_PTR(results);
+        }
+    }
+
+    if((spec_len == 9) && (n_args == 3) && (A->ndim == 2) && (B->ndim == 2) &&
+        ((memcmp(spec, "ij,jk->ik", 9) == 0) ||
+        (memcmp(spec, "ji,jk->ik", 9) == 0) ||
+        (memcmp(spec, "ij,kj->ik", 9) == 0))) {
+        // matrix products, with either operand optionally transposed;
+        // the transpose is folded into the index order, and never formed
+        bool t1 = spec[0] == 'j'; // "ji,jk->ik": A is accessed as its transpose
+        bool t2 = spec[4] == 'j'; // "ij,kj->ik": B is accessed as its transpose
+        size_t M = t1 ? A->shape[ULAB_MAX_DIMS - 1] : A->shape[ULAB_MAX_DIMS - 2];
+        size_t K = t1 ? A->shape[ULAB_MAX_DIMS - 2] : A->shape[ULAB_MAX_DIMS - 1];
+        size_t N = t2 ? B->shape[ULAB_MAX_DIMS - 2] : B->shape[ULAB_MAX_DIMS - 1];
+        size_t K2 = t2 ? B->shape[ULAB_MAX_DIMS - 1] : B->shape[ULAB_MAX_DIMS - 2];
+        if(K != K2) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        ndarray_obj_t *results = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, M, N), NDARRAY_FLOAT);
+        mp_float_t *rarray = (mp_float_t *)results->array;
+        for(size_t i = 0; i < M; i++) {
+            for(size_t k = 0; k < N; k++) {
+                mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+                for(size_t j = 0; j < K; j++) {
+                    mp_float_t a = t1 ? einsum_get2(A, funcs[0], j, i) : einsum_get2(A, funcs[0], i, j);
+                    mp_float_t b = t2 ? einsum_get2(B, funcs[1], k, j) : einsum_get2(B, funcs[1], j, k);
+                    sum += a * b;
+                }
+                *rarray++ = sum;
+            }
+        }
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    if((spec_len == 10) && (memcmp(spec, "ij,jk,k->i", 10) == 0) && (n_args == 4)) {
+        // chained product A B x; only a vector of length K is ever stored
+        ndarray_obj_t *x = ops[2];
+        size_t M = A->shape[ULAB_MAX_DIMS - 2];
+        size_t J = A->shape[ULAB_MAX_DIMS - 1];
+        size_t K = B->shape[ULAB_MAX_DIMS - 1];
+        if((A->ndim != 2) || (B->ndim != 2) || (x->ndim != 1) ||
+            (B->shape[ULAB_MAX_DIMS - 2] != J) || (x->len != K)) {
+            mp_raise_ValueError(translate("dimensions do not match"));
+        }
+        ndarray_obj_t *results = ndarray_new_linear_array(M, NDARRAY_FLOAT);
+        mp_float_t *rarray = (mp_float_t *)results->array;
+        SCRATCH_ACQUIRE();
+        mp_float_t *y = SCRATCH_NEW(mp_float_t, J);
+        for(size_t j = 0; j < J; j++) {
+            mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+            for(size_t k = 0; k < K; k++) {
+                sum += einsum_get2(B, funcs[1], j, k) * einsum_get1(x, funcs[2], k);
+            }
+            y[j] = sum;
+        }
+        for(size_t i = 0; i < M; i++) {
+            mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+            for(size_t j = 0; j < J; j++) {
+                sum += einsum_get2(A, funcs[0], i, j) * y[j];
+            }
+            *rarray++ = sum;
+        }
+        SCRATCH_RELEASE();
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    mp_raise_ValueError(translate("einsum pattern is not supported"));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(transform_einsum_obj, 3, 4, transform_einsum);
+#endif /* ULAB_NUMPY_HAS_EINSUM */
+#endif /* ULAB_MAX_DIMS > 1 */
+
+#if ULAB_NUMPY_HAS_VDOT
+//| def vdot(a: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> float:
+//|     """
+//|     :param ~ulab.numpy.ndarray a: the first vector
+//|     :param ~ulab.numpy.ndarray b: the second vector
+//|     :return: the dot product of the flattened arrays
+//|
+//|     Unlike dot, vdot treats both arguments as flat vectors, and
+//|     accumulates the product in a single fused pass, without
+//|     allocating intermediate arrays"""
+//|     ...
+//|
+
+static mp_obj_t transform_vdot(mp_obj_t _a, mp_obj_t _b) {
+    if(!mp_obj_is_type(_a, &ulab_ndarray_type) || !mp_obj_is_type(_b, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("arguments must be ndarrays"));
+    }
+    ndarray_obj_t *a = MP_OBJ_TO_PTR(_a);
+    ndarray_obj_t *b = MP_OBJ_TO_PTR(_b);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(a->dtype)
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
+    if(a->len != b->len) {
+        mp_raise_ValueError(translate("input vectors must be of equal length"));
+    }
+
+    mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+
+    if(ndarray_is_dense(a) && ndarray_is_dense(b)) {
+        // dense arrays can be traversed in flattened order, whatever their shapes
+        if((a->dtype == NDARRAY_FLOAT) && (b->dtype == NDARRAY_FLOAT)) {
+            mp_float_t *aarray = (mp_float_t *)a->array;
+            mp_float_t *barray = (mp_float_t *)b->array;
+            for(size_t i = 0; i < a->len; i++) {
+                dot += *aarray++ * *barray++;
+            }
+        } else {
+            mp_float_t (*afunc)(void *) = ndarray_get_float_function(a->dtype);
+            mp_float_t (*bfunc)(void *) = ndarray_get_float_function(b->dtype);
+            uint8_t *aarray = (uint8_t *)a->array;
+            uint8_t *barray = (uint8_t *)b->array;
+            for(size_t i = 0; i < a->len; i++) {
+                dot += afunc(aarray) * bfunc(barray);
+                aarray += a->itemsize;
+                barray += b->itemsize;
+            }
+        }
+        return mp_obj_new_float(dot);
+    }
+
+    // strided views are walked in lockstep, which requires identical shapes
+    if(a->ndim != b->ndim) {
+        mp_raise_ValueError(translate("input vectors must be of equal length"));
+    }
+    for(uint8_t d = ULAB_MAX_DIMS - a->ndim; d < ULAB_MAX_DIMS; d++) {
+        if(a->shape[d] != b->shape[d]) {
+            mp_raise_ValueError(translate("input vectors must be of equal length"));
+        }
+    }
+
+    mp_float_t (*afunc)(void *) = ndarray_get_float_function(a->dtype);
+    mp_float_t (*bfunc)(void *) = ndarray_get_float_function(b->dtype);
+    uint8_t *aarray = (uint8_t *)a->array;
+    uint8_t *barray = (uint8_t *)b->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    dot += afunc(aarray) * bfunc(barray);
+                    aarray += a->strides[ULAB_MAX_DIMS - 1];
+                    barray += b->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < a->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                aarray -= a->strides[ULAB_MAX_DIMS - 1] * a->shape[ULAB_MAX_DIMS - 1];
+                aarray += a->strides[ULAB_MAX_DIMS - 2];
+                barray -= b->strides[ULAB_MAX_DIMS - 1] * b->shape[ULAB_MAX_DIMS - 1];
+                barray += b->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < a->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            aarray -= a->strides[ULAB_MAX_DIMS - 2] * a->shape[ULAB_MAX_DIMS - 2];
+            aarray += a->strides[ULAB_MAX_DIMS - 3];
+            barray -= b->strides[ULAB_MAX_DIMS - 2] * b->shape[ULAB_MAX_DIMS - 2];
+            barray += b->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < a->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        aarray -= a->strides[ULAB_MAX_DIMS - 3] * a->shape[ULAB_MAX_DIMS - 3];
+        aarray += a->strides[ULAB_MAX_DIMS - 4];
+        barray -= b->strides[ULAB_MAX_DIMS - 3] * b->shape[ULAB_MAX_DIMS - 3];
+        barray += b->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < a->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    return mp_obj_new_float(dot);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(transform_vdot_obj, transform_vdot);
+#endif /* ULAB_NUMPY_HAS_VDOT */
+
+#if ULAB_NUMPY_HAS_AXPY
+//| def axpy(alpha: float, x: ulab.numpy.ndarray, y: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param float alpha: the scale factor
+//|     :param ~ulab.numpy.ndarray x: the vector to be scaled
+//|     :param ~ulab.numpy.ndarray y: the accumulator; must be of float dtype
+//|     :return: y, updated in place with y + alpha * x
+//|
+//|     Fused multiply-add: the equivalent of y += alpha * x, evaluated
+//|     in a single pass, without allocating a temporary array"""
+//|     ...
+//|
+
+static mp_obj_t transform_axpy(mp_obj_t _alpha, mp_obj_t _x, mp_obj_t _y) {
+    mp_float_t alpha = mp_obj_get_float(_alpha);
+
+    if(!mp_obj_is_type(_x, &ulab_ndarray_type) || !mp_obj_is_type(_y, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("arguments must be ndarrays"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(_x);
+    ndarray_obj_t *y = MP_OBJ_TO_PTR(_y);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+    if(y->dtype != NDARRAY_FLOAT) {
+        // y is updated in place, so its dtype cannot be upcast
+        mp_raise_TypeError(translate("accumulator must be a float ndarray"));
+    }
+    if(x->ndim != y->ndim) {
+        mp_raise_ValueError(translate("input vectors must be of equal length"));
+    }
+    for(uint8_t d = ULAB_MAX_DIMS - x->ndim; d < ULAB_MAX_DIMS; d++) {
+        if(x->shape[d] != y->shape[d]) {
+            mp_raise_ValueError(translate("input vectors must be of equal length"));
+        }
+    }
+
+    if((x->dtype == NDARRAY_FLOAT) && ndarray_is_dense(x) && ndarray_is_dense(y)) {
+        mp_float_t *xarray = (mp_float_t *)x->array;
+        mp_float_t *yarray = (mp_float_t *)y->array;
+        for(size_t i = 0; i < x->len; i++) {
+            *yarray++ += alpha * *xarray++;
+        }
+        return _y;
+    }
+
+    mp_float_t (*xfunc)(void *) = ndarray_get_float_function(x->dtype);
+    uint8_t *xarray = (uint8_t *)x->array;
+    uint8_t *yarray = (uint8_t *)y->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    *(mp_float_t *)yarray += alpha * xfunc(xarray);
+                    xarray += x->strides[ULAB_MAX_DIMS - 1];
+                    yarray += y->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < x->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                xarray -= x->strides[ULAB_MAX_DIMS - 1] * x->shape[ULAB_MAX_DIMS - 1];
+                xarray += x->strides[ULAB_MAX_DIMS - 2];
+                yarray -= y->strides[ULAB_MAX_DIMS - 1] * y->shape[ULAB_MAX_DIMS - 1];
+                yarray += y->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < x->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            xarray -= x->strides[ULAB_MAX_DIMS - 2] * x->shape[ULAB_MAX_DIMS - 2];
+            xarray += x->strides[ULAB_MAX_DIMS - 3];
+            yarray -= y->strides[ULAB_MAX_DIMS - 2] * y->shape[ULAB_MAX_DIMS - 2];
+            yarray += y->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < x->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        xarray -= x->strides[ULAB_MAX_DIMS - 3] * x->shape[ULAB_MAX_DIMS - 3];
+        xarray += x->strides[ULAB_MAX_DIMS - 4];
+        yarray -= y->strides[ULAB_MAX_DIMS - 3] * y->shape[ULAB_MAX_DIMS - 3];
+        yarray += y->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < x->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+
+    return _y;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_3(transform_axpy_obj, transform_axpy);
+#endif /* ULAB_NUMPY_HAS_AXPY */
+
 #if ULAB_NUMPY_HAS_SIZE
 static mp_obj_t transform_size(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
@@ -449,3 +1136,53 @@ static mp_obj_t transform_size(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(transform_size_obj, 1, transform_size);
 #endif
+
+#if ULAB_NUMPY_HAS_SLIDING_WINDOW_VIEW & (ULAB_MAX_DIMS > 1)
+//| def sliding_window_view(a: ulab.numpy.ndarray, window: int, *, step: int = 1) -> ulab.numpy.ndarray:
+//|     """Returns a 2D view of overlapping windows of the 1D array a: row i
+//|     starts at item i * step of the source, and is window items long. No
+//|     data are copied, the rows alias the source buffer, so the view
+//|     should be treated as read-only. step is an extension over numpy's
+//|     sliding_window_view, and sets the hop between consecutive windows."""
+//|     ...
+//|
+
+static mp_obj_t transform_sliding_window_view(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_step, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("first argument must be an ndarray"));
+    }
+    ndarray_obj_t *source = MP_OBJ_TO_PTR(args[0].u_obj);
+    if(source->ndim != 1) {
+        mp_raise_ValueError(translate("input must be a 1D ndarray"));
+    }
+    mp_int_t window = args[1].u_int;
+    mp_int_t step = args[2].u_int;
+    if((window < 1) || (step < 1)) {
+        mp_raise_ValueError(translate("window and step must be positive"));
+    }
+    if((size_t)window > source->len) {
+        mp_raise_ValueError(translate("window is longer than the input"));
+    }
+
+    // the windows are rows of a strided view into the source buffer: the
+    // row-to-row stride is the hop, so overlapping windows share their items
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
+    int32_t strides[ULAB_MAX_DIMS] = { 0 };
+    shape[ULAB_MAX_DIMS - 1] = (size_t)window;
+    shape[ULAB_MAX_DIMS - 2] = (source->len - (size_t)window) / (size_t)step + 1;
+    strides[ULAB_MAX_DIMS - 1] = source->strides[ULAB_MAX_DIMS - 1];
+    strides[ULAB_MAX_DIMS - 2] = (int32_t)step * source->strides[ULAB_MAX_DIMS - 1];
+
+    return MP_OBJ_FROM_PTR(ndarray_new_view(source, 2, shape, strides, 0));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(transform_sliding_window_view_obj, 2, transform_sliding_window_view);
+#endif
@@ -22,9 +22,13 @@
 #include "../ulab.h"
 #include "../ulab_tools.h"
 
+MP_DECLARE_CONST_FUN_OBJ_3(transform_axpy_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(transform_compress_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(transform_delete_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(transform_dot_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(transform_dot_obj);
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(transform_einsum_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(transform_size_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(transform_sliding_window_view_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(transform_vdot_obj);
 
 #endif
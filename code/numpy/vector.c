@@ -32,9 +32,12 @@
 //| much more efficient than expressing the same operation as a Python loop."""
 //|
 
-static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)) {
+static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_obj_t out, mp_float_t (*f)(mp_float_t)) {
     // Return a single value, if o_in is not iterable
     if(mp_obj_is_float(o_in) || mp_obj_is_int(o_in)) {
+        if(out != mp_const_none) {
+            mp_raise_TypeError(translate("out keyword requires array input"));
+        }
         return mp_obj_new_float(f(mp_obj_get_float(o_in)));
     }
     ndarray_obj_t *ndarray = NULL;
@@ -42,9 +45,20 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
         ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
         uint8_t *sarray = (uint8_t *)source->array;
-        ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+        ndarray = tools_validate_out(out, source->ndim, source->shape, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
 
+        #if ULAB_USES_STRIDE_COALESCING
+        // iterate over a shallow copy of the source, whose mergeable
+        // dimensions have been collapsed; the output is written linearly,
+        // so only the loop bounds are affected
+        ndarray_obj_t source_ = *source;
+        if(source_.ndim > 1) {
+            source_.ndim = ndarray_coalesce_strides(source_.ndim, source_.shape, source_.strides, source_.strides);
+        }
+        source = &source_;
+        #endif
+
         #if ULAB_VECTORISE_USES_FUN_POINTER
 
             mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
@@ -102,14 +116,179 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
     } else {
         ndarray = ndarray_from_mp_obj(o_in, 0);
         mp_float_t *narray = (mp_float_t *)ndarray->array;
-        for(size_t i = 0; i < ndarray->len; i++) {
-            *narray = f(*narray);
-            narray++;
+        if(out != mp_const_none) {
+            ndarray_obj_t *results = tools_validate_out(out, ndarray->ndim, ndarray->shape, NDARRAY_FLOAT);
+            mp_float_t *rarray = (mp_float_t *)results->array;
+            for(size_t i = 0; i < ndarray->len; i++) {
+                *rarray++ = f(*narray++);
+            }
+            ndarray = results;
+        } else {
+            for(size_t i = 0; i < ndarray->len; i++) {
+                *narray = f(*narray);
+                narray++;
+            }
         }
     }
     return MP_OBJ_FROM_PTR(ndarray);
 }
 
+#if ULAB_VECTOR_USES_FAST_MATH
+#define VECTOR_FAST_PI          MICROPY_FLOAT_CONST(3.14159265358979323846)
+#define VECTOR_FAST_HALF_PI     MICROPY_FLOAT_CONST(1.57079632679489661923)
+#define VECTOR_FAST_1_PI        MICROPY_FLOAT_CONST(0.31830988618379067154)
+#define VECTOR_FAST_LN2         MICROPY_FLOAT_CONST(0.69314718055994530942)
+#define VECTOR_FAST_1_LN2       MICROPY_FLOAT_CONST(1.44269504088896340736)
+#define VECTOR_FAST_SQRT_HALF   MICROPY_FLOAT_CONST(0.70710678118654752440)
+
+// Polynomial replacements for the slowest libm back ends. The argument is
+// first brought into a narrow interval around zero, where a truncated series
+// converges quickly; the absolute error stays below approximately 1e-6 over
+// the full domain of the single-precision types
+
+static mp_float_t vector_fast_sin(mp_float_t x) {
+    // write x as k * pi + r with r in [-pi/2, pi/2], so that
+    // sin(x) = (-1)^k sin(r), and evaluate the odd series up to r^11
+    mp_float_t k = MICROPY_FLOAT_C_FUN(floor)(x * VECTOR_FAST_1_PI + MICROPY_FLOAT_CONST(0.5));
+    mp_float_t r = x - k * VECTOR_FAST_PI;
+    mp_float_t r2 = r * r;
+    mp_float_t s = r * (MICROPY_FLOAT_CONST(1.0) + r2 * (MICROPY_FLOAT_CONST(-1.66666666666667e-1)
+        + r2 * (MICROPY_FLOAT_CONST(8.33333333333333e-3) + r2 * (MICROPY_FLOAT_CONST(-1.98412698412698e-4)
+        + r2 * (MICROPY_FLOAT_CONST(2.75573192239859e-6) + r2 * MICROPY_FLOAT_CONST(-2.50521083854417e-8))))));
+    // the parity of k decides the sign; k might not fit into an integer type
+    if(k - MICROPY_FLOAT_CONST(2.0) * MICROPY_FLOAT_C_FUN(floor)(k * MICROPY_FLOAT_CONST(0.5)) != MICROPY_FLOAT_CONST(0.0)) {
+        s = -s;
+    }
+    return s;
+}
+
+static mp_float_t vector_fast_cos(mp_float_t x) {
+    return vector_fast_sin(x + VECTOR_FAST_HALF_PI);
+}
+
+static mp_float_t vector_fast_exp(mp_float_t x) {
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+    if(x > MICROPY_FLOAT_CONST(88.0)) {
+        return (mp_float_t)INFINITY;
+    } else if(x < MICROPY_FLOAT_CONST(-87.0)) {
+        return MICROPY_FLOAT_CONST(0.0);
+    }
+    #else
+    if(x > MICROPY_FLOAT_CONST(709.0)) {
+        return (mp_float_t)INFINITY;
+    } else if(x < MICROPY_FLOAT_CONST(-708.0)) {
+        return MICROPY_FLOAT_CONST(0.0);
+    }
+    #endif
+    if(x != x) { // NaN falls through the range checks above
+        return x;
+    }
+    // write x as k * ln2 + r with r in [-ln2/2, ln2/2], so that
+    // exp(x) = 2^k exp(r), and evaluate the series up to r^7
+    mp_float_t k = MICROPY_FLOAT_C_FUN(floor)(x * VECTOR_FAST_1_LN2 + MICROPY_FLOAT_CONST(0.5));
+    mp_float_t r = x - k * VECTOR_FAST_LN2;
+    mp_float_t p = MICROPY_FLOAT_CONST(1.0) + r * (MICROPY_FLOAT_CONST(1.0)
+        + r * (MICROPY_FLOAT_CONST(5.0e-1) + r * (MICROPY_FLOAT_CONST(1.66666666666667e-1)
+        + r * (MICROPY_FLOAT_CONST(4.16666666666667e-2) + r * (MICROPY_FLOAT_CONST(8.33333333333333e-3)
+        + r * (MICROPY_FLOAT_CONST(1.38888888888889e-3) + r * MICROPY_FLOAT_CONST(1.98412698412698e-4)))))));
+    return MICROPY_FLOAT_C_FUN(ldexp)(p, (int)k);
+}
+
+static mp_float_t vector_fast_log(mp_float_t x) {
+    if(x != x) {
+        return x;
+    } else if(x < MICROPY_FLOAT_CONST(0.0)) {
+        return (mp_float_t)NAN;
+    } else if(x == MICROPY_FLOAT_CONST(0.0)) {
+        return (mp_float_t)-INFINITY;
+    } else if(isinf(x)) {
+        return x;
+    }
+    // write x as m * 2^e with m in [sqrt(0.5), sqrt(2)), so that
+    // log(x) = log(m) + e * ln2, and expand log(m) in t = (m-1)/(m+1),
+    // which stays below 0.172 on the whole interval
+    int e;
+    mp_float_t m = MICROPY_FLOAT_C_FUN(frexp)(x, &e);
+    if(m < VECTOR_FAST_SQRT_HALF) {
+        m += m;
+        e--;
+    }
+    mp_float_t t = (m - MICROPY_FLOAT_CONST(1.0)) / (m + MICROPY_FLOAT_CONST(1.0));
+    mp_float_t t2 = t * t;
+    mp_float_t p = MICROPY_FLOAT_CONST(2.0) * t * (MICROPY_FLOAT_CONST(1.0)
+        + t2 * (MICROPY_FLOAT_CONST(3.33333333333333e-1) + t2 * (MICROPY_FLOAT_CONST(2.0e-1)
+        + t2 * (MICROPY_FLOAT_CONST(1.42857142857143e-1) + t2 * MICROPY_FLOAT_CONST(1.11111111111111e-1)))));
+    return p + (mp_float_t)e * VECTOR_FAST_LN2;
+}
+
+static mp_float_t vector_fast_erfc(mp_float_t x) {
+    // rational approximation 7.1.26 from Abramowitz & Stegun; evaluating
+    // the scaled complement on the positive half axis keeps the relative
+    // accuracy of the Gaussian tail, where erf itself saturates at 1
+    mp_float_t xa = x < MICROPY_FLOAT_CONST(0.0) ? -x : x;
+    mp_float_t t = MICROPY_FLOAT_CONST(1.0) / (MICROPY_FLOAT_CONST(1.0) + MICROPY_FLOAT_CONST(3.275911e-1) * xa);
+    mp_float_t p = t * (MICROPY_FLOAT_CONST(2.54829592e-1) + t * (MICROPY_FLOAT_CONST(-2.84496736e-1)
+        + t * (MICROPY_FLOAT_CONST(1.421413741) + t * (MICROPY_FLOAT_CONST(-1.453152027)
+        + t * MICROPY_FLOAT_CONST(1.061405429)))));
+    mp_float_t c = p * vector_fast_exp(-xa * xa);
+    return x < MICROPY_FLOAT_CONST(0.0) ? MICROPY_FLOAT_CONST(2.0) - c : c;
+}
+
+static mp_float_t vector_fast_erf(mp_float_t x) {
+    return MICROPY_FLOAT_CONST(1.0) - vector_fast_erfc(x);
+}
+
+static mp_float_t vector_fast_lgamma(mp_float_t x) {
+    if(x != x) {
+        return x;
+    }
+    if((x <= MICROPY_FLOAT_CONST(0.0)) && (x == MICROPY_FLOAT_C_FUN(floor)(x))) {
+        return (mp_float_t)INFINITY; // the poles at the non-positive integers
+    }
+    if(x < MICROPY_FLOAT_CONST(0.5)) {
+        // reflection: lgamma(x) = log(pi / |sin(pi x)|) - lgamma(1 - x)
+        mp_float_t s = vector_fast_sin(VECTOR_FAST_PI * x);
+        if(s < MICROPY_FLOAT_CONST(0.0)) {
+            s = -s;
+        }
+        return vector_fast_log(VECTOR_FAST_PI / s) - vector_fast_lgamma(MICROPY_FLOAT_CONST(1.0) - x);
+    }
+    // Lanczos approximation with g = 5, n = 6
+    static const mp_float_t cof[6] = {
+        MICROPY_FLOAT_CONST(76.18009172947146),
+        MICROPY_FLOAT_CONST(-86.50532032941677),
+        MICROPY_FLOAT_CONST(24.01409824083091),
+        MICROPY_FLOAT_CONST(-1.231739572450155),
+        MICROPY_FLOAT_CONST(1.208650973866179e-3),
+        MICROPY_FLOAT_CONST(-5.395239384953e-6)
+    };
+    mp_float_t y = x;
+    mp_float_t tmp = x + MICROPY_FLOAT_CONST(5.5);
+    tmp -= (x + MICROPY_FLOAT_CONST(0.5)) * vector_fast_log(tmp);
+    mp_float_t ser = MICROPY_FLOAT_CONST(1.000000000190015);
+    for(uint8_t j = 0; j < 6; j++) {
+        y += MICROPY_FLOAT_CONST(1.0);
+        ser += cof[j] / y;
+    }
+    return -tmp + vector_fast_log(MICROPY_FLOAT_CONST(2.5066282746310005) * ser / x);
+}
+#endif /* ULAB_VECTOR_USES_FAST_MATH */
+
+// Common front end of the one-argument functions: parses the positional
+// argument, and the out keyword, before handing the operation over to
+// vector_generic_vector
+static mp_obj_t vector_generic_call(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, mp_float_t (*f)(mp_float_t)) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return vector_generic_vector(args[0].u_obj, args[1].u_obj, f);
+}
+
 #if ULAB_NUMPY_HAS_ACOS
 //| def acos(a: _ArrayLike) -> ulab.numpy.ndarray:
 //|    """Computes the inverse cosine function"""
@@ -117,7 +296,7 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
 //|
 
 MATH_FUN_1(acos, acos);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_acos_obj, vector_acos);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_acos_obj, 1, vector_acos);
 #endif
 
 #if ULAB_NUMPY_HAS_ACOSH
@@ -127,7 +306,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_acos_obj, vector_acos);
 //|
 
 MATH_FUN_1(acosh, acosh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_acosh_obj, vector_acosh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_acosh_obj, 1, vector_acosh);
 #endif
 
 #if ULAB_NUMPY_HAS_ASIN
@@ -137,7 +316,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_acosh_obj, vector_acosh);
 //|
 
 MATH_FUN_1(asin, asin);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_asin_obj, vector_asin);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_asin_obj, 1, vector_asin);
 #endif
 
 #if ULAB_NUMPY_HAS_ASINH
@@ -147,7 +326,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_asin_obj, vector_asin);
 //|
 
 MATH_FUN_1(asinh, asinh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_asinh_obj, vector_asinh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_asinh_obj, 1, vector_asinh);
 #endif
 
 #if ULAB_NUMPY_HAS_AROUND
@@ -229,7 +408,7 @@ MP_DEFINE_CONST_FUN_OBJ_KW(vector_around_obj, 1, vector_around);
 //|
 
 MATH_FUN_1(atan, atan);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_atan_obj, vector_atan);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_atan_obj, 1, vector_atan);
 #endif
 
 #if ULAB_NUMPY_HAS_ARCTAN2
@@ -325,7 +504,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(vector_arctan2_obj, vector_arctan2);
 //|
 
 MATH_FUN_1(atanh, atanh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_atanh_obj, vector_atanh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_atanh_obj, 1, vector_atanh);
 #endif
 
 #if ULAB_NUMPY_HAS_CEIL
@@ -335,7 +514,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_atanh_obj, vector_atanh);
 //|
 
 MATH_FUN_1(ceil, ceil);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_ceil_obj, vector_ceil);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_ceil_obj, 1, vector_ceil);
 #endif
 
 #if ULAB_NUMPY_HAS_COS
@@ -344,8 +523,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_ceil_obj, vector_ceil);
 //|    ...
 //|
 
-MATH_FUN_1(cos, cos);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_cos_obj, vector_cos);
+MATH_FUN_1_FAST(cos, cos);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_cos_obj, 1, vector_cos);
 #endif
 
 #if ULAB_NUMPY_HAS_COSH
@@ -355,7 +534,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_cos_obj, vector_cos);
 //|
 
 MATH_FUN_1(cosh, cosh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_cosh_obj, vector_cosh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_cosh_obj, 1, vector_cosh);
 #endif
 
 #if ULAB_NUMPY_HAS_DEGREES
@@ -368,11 +547,11 @@ static mp_float_t vector_degrees_(mp_float_t value) {
     return value * MICROPY_FLOAT_CONST(180.0) / MP_PI;
 }
 
-static mp_obj_t vector_degrees(mp_obj_t x_obj) {
-    return vector_generic_vector(x_obj, vector_degrees_);
+static mp_obj_t vector_degrees(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return vector_generic_call(n_args, pos_args, kw_args, vector_degrees_);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(vector_degrees_obj, vector_degrees);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_degrees_obj, 1, vector_degrees);
 #endif
 
 #if ULAB_SCIPY_SPECIAL_HAS_ERF
@@ -381,8 +560,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_degrees_obj, vector_degrees);
 //|    ...
 //|
 
-MATH_FUN_1(erf, erf);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_erf_obj, vector_erf);
+MATH_FUN_1_FAST(erf, erf);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_erf_obj, 1, vector_erf);
 #endif
 
 #if ULAB_SCIPY_SPECIAL_HAS_ERFC
@@ -391,8 +570,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_erf_obj, vector_erf);
 //|    ...
 //|
 
-MATH_FUN_1(erfc, erfc);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_erfc_obj, vector_erfc);
+MATH_FUN_1_FAST(erfc, erfc);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_erfc_obj, 1, vector_erfc);
 #endif
 
 #if ULAB_NUMPY_HAS_EXP
@@ -401,9 +580,23 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_erfc_obj, vector_erfc);
 //|    ...
 //|
 
-static mp_obj_t vector_exp(mp_obj_t o_in) {
+static mp_obj_t vector_exp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     #if ULAB_SUPPORTS_COMPLEX
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t o_in = args[0].u_obj;
+    mp_obj_t out = args[1].u_obj;
+
     if(mp_obj_is_type(o_in, &mp_type_complex)) {
+        if(out != mp_const_none) {
+            mp_raise_TypeError(translate("out keyword requires array input"));
+        }
         mp_float_t real, imag;
         mp_obj_get_complex(o_in, &real, &imag);
         mp_float_t exp_real = MICROPY_FLOAT_C_FUN(exp)(real);
@@ -412,7 +605,7 @@ static mp_obj_t vector_exp(mp_obj_t o_in) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
         if(source->dtype == NDARRAY_COMPLEX) {
             uint8_t *sarray = (uint8_t *)source->array;
-            ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_COMPLEX);
+            ndarray_obj_t *ndarray = tools_validate_out(out, source->ndim, source->shape, NDARRAY_COMPLEX);
             mp_float_t *array = (mp_float_t *)ndarray->array;
             uint8_t itemsize = sizeof(mp_float_t);
 
@@ -459,11 +652,13 @@ static mp_obj_t vector_exp(mp_obj_t o_in) {
             return MP_OBJ_FROM_PTR(ndarray);
         }
     }
+    return vector_generic_vector(o_in, out, MICROPY_FLOAT_C_FUN(exp));
+    #else
+    return vector_generic_call(n_args, pos_args, kw_args, MICROPY_FLOAT_C_FUN(exp));
     #endif
-    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(exp));
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(vector_exp_obj, vector_exp);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_exp_obj, 1, vector_exp);
 #endif
 
 #if ULAB_NUMPY_HAS_EXPM1
@@ -473,7 +668,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_exp_obj, vector_exp);
 //|
 
 MATH_FUN_1(expm1, expm1);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_expm1_obj, vector_expm1);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_expm1_obj, 1, vector_expm1);
 #endif
 
 #if ULAB_NUMPY_HAS_FLOOR
@@ -483,7 +678,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_expm1_obj, vector_expm1);
 //|
 
 MATH_FUN_1(floor, floor);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_floor_obj, vector_floor);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_floor_obj, 1, vector_floor);
 #endif
 
 #if ULAB_SCIPY_SPECIAL_HAS_GAMMA
@@ -493,7 +688,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_floor_obj, vector_floor);
 //|
 
 MATH_FUN_1(gamma, tgamma);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_gamma_obj, vector_gamma);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_gamma_obj, 1, vector_gamma);
 #endif
 
 #if ULAB_SCIPY_SPECIAL_HAS_GAMMALN
@@ -502,8 +697,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_gamma_obj, vector_gamma);
 //|    ...
 //|
 
-MATH_FUN_1(lgamma, lgamma);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_lgamma_obj, vector_lgamma);
+MATH_FUN_1_FAST(lgamma, lgamma);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_lgamma_obj, 1, vector_lgamma);
 #endif
 
 #if ULAB_NUMPY_HAS_LOG
@@ -512,8 +707,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_lgamma_obj, vector_lgamma);
 //|    ...
 //|
 
-MATH_FUN_1(log, log);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_log_obj, vector_log);
+MATH_FUN_1_FAST(log, log);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_log_obj, 1, vector_log);
 #endif
 
 #if ULAB_NUMPY_HAS_LOG10
@@ -523,7 +718,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_log_obj, vector_log);
 //|
 
 MATH_FUN_1(log10, log10);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_log10_obj, vector_log10);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_log10_obj, 1, vector_log10);
 #endif
 
 #if ULAB_NUMPY_HAS_LOG2
@@ -533,7 +728,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_log10_obj, vector_log10);
 //|
 
 MATH_FUN_1(log2, log2);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_log2_obj, vector_log2);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_log2_obj, 1, vector_log2);
 #endif
 
 #if ULAB_NUMPY_HAS_RADIANS
@@ -546,11 +741,11 @@ static mp_float_t vector_radians_(mp_float_t value) {
     return value * MP_PI / MICROPY_FLOAT_CONST(180.0);
 }
 
-static mp_obj_t vector_radians(mp_obj_t x_obj) {
-    return vector_generic_vector(x_obj, vector_radians_);
+static mp_obj_t vector_radians(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return vector_generic_call(n_args, pos_args, kw_args, vector_radians_);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(vector_radians_obj, vector_radians);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_radians_obj, 1, vector_radians);
 #endif
 
 #if ULAB_NUMPY_HAS_SIN
@@ -559,8 +754,106 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_radians_obj, vector_radians);
 //|    ...
 //|
 
-MATH_FUN_1(sin, sin);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_sin_obj, vector_sin);
+MATH_FUN_1_FAST(sin, sin);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_sin_obj, 1, vector_sin);
+#endif
+
+#if ULAB_NUMPY_HAS_SINCOS
+//| def sincos(a: _ArrayLike) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|    """Computes the sine and the cosine of the argument in a single pass,
+//|       and returns them as a (sin, cos) tuple"""
+//|    ...
+//|
+
+static void vector_sincos_kernel(mp_float_t x, mp_float_t *sine, mp_float_t *cosine) {
+    #if ULAB_VECTOR_USES_FAST_MATH
+    // the range reduction x = k * pi + r is carried out once, and is
+    // shared by the two polynomials; both results pick up the sign (-1)^k
+    mp_float_t k = MICROPY_FLOAT_C_FUN(floor)(x * VECTOR_FAST_1_PI + MICROPY_FLOAT_CONST(0.5));
+    mp_float_t r = x - k * VECTOR_FAST_PI;
+    mp_float_t r2 = r * r;
+    mp_float_t s = r * (MICROPY_FLOAT_CONST(1.0) + r2 * (MICROPY_FLOAT_CONST(-1.66666666666667e-1)
+        + r2 * (MICROPY_FLOAT_CONST(8.33333333333333e-3) + r2 * (MICROPY_FLOAT_CONST(-1.98412698412698e-4)
+        + r2 * (MICROPY_FLOAT_CONST(2.75573192239859e-6) + r2 * MICROPY_FLOAT_CONST(-2.50521083854417e-8))))));
+    mp_float_t c = MICROPY_FLOAT_CONST(1.0) + r2 * (MICROPY_FLOAT_CONST(-5.0e-1)
+        + r2 * (MICROPY_FLOAT_CONST(4.16666666666667e-2) + r2 * (MICROPY_FLOAT_CONST(-1.38888888888889e-3)
+        + r2 * (MICROPY_FLOAT_CONST(2.48015873015873e-5) + r2 * MICROPY_FLOAT_CONST(-2.75573192239859e-7)))));
+    if(k - MICROPY_FLOAT_CONST(2.0) * MICROPY_FLOAT_C_FUN(floor)(k * MICROPY_FLOAT_CONST(0.5)) != MICROPY_FLOAT_CONST(0.0)) {
+        s = -s;
+        c = -c;
+    }
+    *sine = s;
+    *cosine = c;
+    #else
+    *sine = MICROPY_FLOAT_C_FUN(sin)(x);
+    *cosine = MICROPY_FLOAT_C_FUN(cos)(x);
+    #endif
+}
+
+static mp_obj_t vector_sincos(mp_obj_t o_in) {
+    if(mp_obj_is_float(o_in) || mp_obj_is_int(o_in)) {
+        mp_float_t s, c;
+        vector_sincos_kernel(mp_obj_get_float(o_in), &s, &c);
+        mp_obj_t items[2] = { mp_obj_new_float(s), mp_obj_new_float(c) };
+        return mp_obj_new_tuple(2, items);
+    }
+    ndarray_obj_t *source;
+    if(mp_obj_is_type(o_in, &ulab_ndarray_type)) {
+        source = MP_OBJ_TO_PTR(o_in);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
+    } else {
+        source = ndarray_from_mp_obj(o_in, 0);
+    }
+    ndarray_obj_t *sines = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    ndarray_obj_t *cosines = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    mp_float_t *sinarray = (mp_float_t *)sines->array;
+    mp_float_t *cosarray = (mp_float_t *)cosines->array;
+    uint8_t *sarray = (uint8_t *)source->array;
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    vector_sincos_kernel(func(sarray), sinarray++, cosarray++);
+                    sarray += source->strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < source->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                sarray -= source->strides[ULAB_MAX_DIMS - 1] * source->shape[ULAB_MAX_DIMS-1];
+                sarray += source->strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < source->shape[ULAB_MAX_DIMS - 2]);
+            #endif /* ULAB_MAX_DIMS > 1 */
+        #if ULAB_MAX_DIMS > 2
+            sarray -= source->strides[ULAB_MAX_DIMS - 2] * source->shape[ULAB_MAX_DIMS-2];
+            sarray += source->strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < source->shape[ULAB_MAX_DIMS - 3]);
+        #endif /* ULAB_MAX_DIMS > 2 */
+    #if ULAB_MAX_DIMS > 3
+        sarray -= source->strides[ULAB_MAX_DIMS - 3] * source->shape[ULAB_MAX_DIMS-3];
+        sarray += source->strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < source->shape[ULAB_MAX_DIMS - 4]);
+    #endif /* ULAB_MAX_DIMS > 3 */
+
+    mp_obj_t items[2] = { MP_OBJ_FROM_PTR(sines), MP_OBJ_FROM_PTR(cosines) };
+    return mp_obj_new_tuple(2, items);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(vector_sincos_obj, vector_sincos);
 #endif
 
 #if ULAB_NUMPY_HAS_SINH
@@ -570,7 +863,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_sin_obj, vector_sin);
 //|
 
 MATH_FUN_1(sinh, sinh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_sinh_obj, vector_sinh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_sinh_obj, 1, vector_sinh);
 #endif
 
 
@@ -585,6 +878,7 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(NDARRAY_FLOAT) } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -595,8 +889,12 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     if((dtype != NDARRAY_FLOAT) && (dtype != NDARRAY_COMPLEX)) {
         mp_raise_TypeError(translate("dtype must be float, or complex"));
     }
+    mp_obj_t out = args[2].u_obj;
 
     if(mp_obj_is_type(o_in, &mp_type_complex)) {
+        if(out != mp_const_none) {
+            mp_raise_TypeError(translate("out keyword requires array input"));
+        }
         mp_float_t real, imag;
         mp_obj_get_complex(o_in, &real, &imag);
         mp_float_t sqrt_abs = MICROPY_FLOAT_C_FUN(sqrt)(real * real + imag * imag);
@@ -612,7 +910,7 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
         if(dtype == NDARRAY_COMPLEX) {
             if(source->dtype == NDARRAY_COMPLEX) {
                 uint8_t *sarray = (uint8_t *)source->array;
-                ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_COMPLEX);
+                ndarray_obj_t *ndarray = tools_validate_out(out, source->ndim, source->shape, NDARRAY_COMPLEX);
                 mp_float_t *array = (mp_float_t *)ndarray->array;
                 uint8_t itemsize = sizeof(mp_float_t);
 
@@ -661,7 +959,7 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
                 return MP_OBJ_FROM_PTR(ndarray);
             } else if(source->dtype == NDARRAY_FLOAT) {
                 uint8_t *sarray = (uint8_t *)source->array;
-                ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_COMPLEX);
+                ndarray_obj_t *ndarray = tools_validate_out(out, source->ndim, source->shape, NDARRAY_COMPLEX);
                 mp_float_t *array = (mp_float_t *)ndarray->array;
 
                 #if ULAB_MAX_DIMS > 3
@@ -713,12 +1011,12 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
             }
         }
     }
-    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(sqrt));
+    return vector_generic_vector(o_in, out, MICROPY_FLOAT_C_FUN(sqrt));
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(vector_sqrt_obj, 1, vector_sqrt);
 #else
 MATH_FUN_1(sqrt, sqrt);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_sqrt_obj, vector_sqrt);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_sqrt_obj, 1, vector_sqrt);
 #endif /* ULAB_SUPPORTS_COMPLEX */
 
 #endif /* ULAB_NUMPY_HAS_SQRT */
@@ -730,7 +1028,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_sqrt_obj, vector_sqrt);
 //|
 
 MATH_FUN_1(tan, tan);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_tan_obj, vector_tan);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_tan_obj, 1, vector_tan);
 #endif
 
 #if ULAB_NUMPY_HAS_TANH
@@ -739,16 +1037,193 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_tan_obj, vector_tan);
 //|    ...
 
 MATH_FUN_1(tanh, tanh);
-MP_DEFINE_CONST_FUN_OBJ_1(vector_tanh_obj, vector_tanh);
+MP_DEFINE_CONST_FUN_OBJ_KW(vector_tanh_obj, 1, vector_tanh);
 #endif
 
 #if ULAB_NUMPY_HAS_VECTORIZE
+
+#if ULAB_VECTORIZE_USES_NATIVE_KERNELS
+// If the wrapped callable is one of the native one-argument functions of
+// this module, return the underlying C kernel, so that the call can run
+// through vector_generic_vector without boxing each element into an object
+static mp_float_t (*vector_native_kernel(mp_obj_t fun))(mp_float_t) {
+    #if ULAB_NUMPY_HAS_ACOS
+    if(fun == MP_OBJ_FROM_PTR(&vector_acos_obj)) {
+        return MICROPY_FLOAT_C_FUN(acos);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_ACOSH
+    if(fun == MP_OBJ_FROM_PTR(&vector_acosh_obj)) {
+        return MICROPY_FLOAT_C_FUN(acosh);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_ASIN
+    if(fun == MP_OBJ_FROM_PTR(&vector_asin_obj)) {
+        return MICROPY_FLOAT_C_FUN(asin);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_ASINH
+    if(fun == MP_OBJ_FROM_PTR(&vector_asinh_obj)) {
+        return MICROPY_FLOAT_C_FUN(asinh);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_ATAN
+    if(fun == MP_OBJ_FROM_PTR(&vector_atan_obj)) {
+        return MICROPY_FLOAT_C_FUN(atan);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_ATANH
+    if(fun == MP_OBJ_FROM_PTR(&vector_atanh_obj)) {
+        return MICROPY_FLOAT_C_FUN(atanh);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_CEIL
+    if(fun == MP_OBJ_FROM_PTR(&vector_ceil_obj)) {
+        return MICROPY_FLOAT_C_FUN(ceil);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_COS
+    if(fun == MP_OBJ_FROM_PTR(&vector_cos_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_cos;
+        #else
+        return MICROPY_FLOAT_C_FUN(cos);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_COSH
+    if(fun == MP_OBJ_FROM_PTR(&vector_cosh_obj)) {
+        return MICROPY_FLOAT_C_FUN(cosh);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_DEGREES
+    if(fun == MP_OBJ_FROM_PTR(&vector_degrees_obj)) {
+        return vector_degrees_;
+    }
+    #endif
+    #if ULAB_SCIPY_SPECIAL_HAS_ERF
+    if(fun == MP_OBJ_FROM_PTR(&vector_erf_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_erf;
+        #else
+        return MICROPY_FLOAT_C_FUN(erf);
+        #endif
+    }
+    #endif
+    #if ULAB_SCIPY_SPECIAL_HAS_ERFC
+    if(fun == MP_OBJ_FROM_PTR(&vector_erfc_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_erfc;
+        #else
+        return MICROPY_FLOAT_C_FUN(erfc);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_EXP
+    if(fun == MP_OBJ_FROM_PTR(&vector_exp_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_exp;
+        #else
+        return MICROPY_FLOAT_C_FUN(exp);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_EXPM1
+    if(fun == MP_OBJ_FROM_PTR(&vector_expm1_obj)) {
+        return MICROPY_FLOAT_C_FUN(expm1);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_FLOOR
+    if(fun == MP_OBJ_FROM_PTR(&vector_floor_obj)) {
+        return MICROPY_FLOAT_C_FUN(floor);
+    }
+    #endif
+    #if ULAB_SCIPY_SPECIAL_HAS_GAMMA
+    if(fun == MP_OBJ_FROM_PTR(&vector_gamma_obj)) {
+        return MICROPY_FLOAT_C_FUN(tgamma);
+    }
+    #endif
+    #if ULAB_SCIPY_SPECIAL_HAS_GAMMALN
+    if(fun == MP_OBJ_FROM_PTR(&vector_lgamma_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_lgamma;
+        #else
+        return MICROPY_FLOAT_C_FUN(lgamma);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_LOG
+    if(fun == MP_OBJ_FROM_PTR(&vector_log_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_log;
+        #else
+        return MICROPY_FLOAT_C_FUN(log);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_LOG10
+    if(fun == MP_OBJ_FROM_PTR(&vector_log10_obj)) {
+        return MICROPY_FLOAT_C_FUN(log10);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_LOG2
+    if(fun == MP_OBJ_FROM_PTR(&vector_log2_obj)) {
+        return MICROPY_FLOAT_C_FUN(log2);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_RADIANS
+    if(fun == MP_OBJ_FROM_PTR(&vector_radians_obj)) {
+        return vector_radians_;
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_SIN
+    if(fun == MP_OBJ_FROM_PTR(&vector_sin_obj)) {
+        #if ULAB_VECTOR_USES_FAST_MATH
+        return vector_fast_sin;
+        #else
+        return MICROPY_FLOAT_C_FUN(sin);
+        #endif
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_SINH
+    if(fun == MP_OBJ_FROM_PTR(&vector_sinh_obj)) {
+        return MICROPY_FLOAT_C_FUN(sinh);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_SQRT
+    if(fun == MP_OBJ_FROM_PTR(&vector_sqrt_obj)) {
+        return MICROPY_FLOAT_C_FUN(sqrt);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_TAN
+    if(fun == MP_OBJ_FROM_PTR(&vector_tan_obj)) {
+        return MICROPY_FLOAT_C_FUN(tan);
+    }
+    #endif
+    #if ULAB_NUMPY_HAS_TANH
+    if(fun == MP_OBJ_FROM_PTR(&vector_tanh_obj)) {
+        return MICROPY_FLOAT_C_FUN(tanh);
+    }
+    #endif
+    return NULL;
+}
+#endif /* ULAB_VECTORIZE_USES_NATIVE_KERNELS */
+
 static mp_obj_t vector_vectorized_function_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     (void) n_args;
     (void) n_kw;
     vectorized_function_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_obj_t avalue[1];
     mp_obj_t fvalue;
+    #if ULAB_VECTORIZE_USES_NATIVE_KERNELS
+    if((self->kernel != NULL) && (self->otypes == NDARRAY_FLOAT) &&
+        (mp_obj_is_type(args[0], &ulab_ndarray_type) || mp_obj_is_type(args[0], &mp_type_tuple) ||
+        mp_obj_is_type(args[0], &mp_type_list) || mp_obj_is_type(args[0], &mp_type_range))) {
+        // the wrapped function has a native kernel: hand the complete array
+        // over to the generic iterator, instead of calling back into python
+        return vector_generic_vector(args[0], mp_const_none, self->kernel);
+    }
+    #endif
     if(mp_obj_is_type(args[0], &ulab_ndarray_type)) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(args[0]);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
@@ -837,6 +1312,9 @@ static mp_obj_t vector_vectorize(size_t n_args, const mp_obj_t *pos_args, mp_map
     function->otypes = otypes;
     function->fun = args[0].u_obj;
     function->type = type;
+    #if ULAB_VECTORIZE_USES_NATIVE_KERNELS
+    function->kernel = vector_native_kernel(args[0].u_obj);
+    #endif
     return MP_OBJ_FROM_PTR(function);
 }
 
@@ -15,38 +15,35 @@
 #include "../ulab.h"
 #include "../ndarray.h"
 
-MP_DECLARE_CONST_FUN_OBJ_1(vector_acos_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_acosh_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_acos_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_acosh_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(vector_arctan2_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(vector_around_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_asin_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_asinh_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_atan_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_atanh_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_ceil_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_cos_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_cosh_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_degrees_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_erf_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_erfc_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_exp_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_expm1_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_floor_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_gamma_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_lgamma_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_log_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_log10_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_log2_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_radians_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_sin_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_sinh_obj);
-#if ULAB_SUPPORTS_COMPLEX
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_asin_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_asinh_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_atan_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_atanh_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_ceil_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_cos_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_cosh_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_degrees_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_erf_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_erfc_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_exp_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_expm1_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_floor_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_gamma_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_lgamma_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_log_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_log10_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_log2_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_radians_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_sin_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(vector_sincos_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_sinh_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(vector_sqrt_obj);
-#else
-MP_DECLARE_CONST_FUN_OBJ_1(vector_sqrt_obj);
-#endif
-MP_DECLARE_CONST_FUN_OBJ_1(vector_tan_obj);
-MP_DECLARE_CONST_FUN_OBJ_1(vector_tanh_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_tan_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(vector_tanh_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(vector_vectorize_obj);
 
 typedef struct _vectorized_function_obj_t {
@@ -54,6 +51,9 @@ typedef struct _vectorized_function_obj_t {
     uint8_t otypes;
     mp_obj_t fun;
     const mp_obj_type_t *type;
+    #if ULAB_VECTORIZE_USES_NATIVE_KERNELS
+    mp_float_t (*kernel)(mp_float_t);
+    #endif
 } vectorized_function_obj_t;
 
 #if ULAB_HAS_FUNCTION_ITERATOR
@@ -154,8 +154,19 @@ typedef struct _vectorized_function_obj_t {
 #endif /* ULAB_HAS_FUNCTION_ITERATOR */
 
 #define MATH_FUN_1(py_name, c_name) \
-    static mp_obj_t vector_ ## py_name(mp_obj_t x_obj) { \
-        return vector_generic_vector(x_obj, MICROPY_FLOAT_C_FUN(c_name)); \
+    static mp_obj_t vector_ ## py_name(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) { \
+        return vector_generic_call(n_args, pos_args, kw_args, MICROPY_FLOAT_C_FUN(c_name)); \
+}
+
+// variant of MATH_FUN_1 for functions with a polynomial back end;
+// resolves to the libm implementation, when fast math is disabled
+#if ULAB_VECTOR_USES_FAST_MATH
+#define MATH_FUN_1_FAST(py_name, c_name) \
+    static mp_obj_t vector_ ## py_name(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) { \
+        return vector_generic_call(n_args, pos_args, kw_args, vector_fast_ ## c_name); \
 }
+#else
+#define MATH_FUN_1_FAST(py_name, c_name) MATH_FUN_1(py_name, c_name)
+#endif
 
 #endif /* _VECTOR_ */
@@ -147,10 +147,95 @@ static mp_obj_t solve_triangular(size_t n_args, const mp_obj_t *pos_args, mp_map
 
 MP_DEFINE_CONST_FUN_OBJ_KW(linalg_solve_triangular_obj, 2, solve_triangular);
 
-//| def cho_solve(L: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//| def cho_factor(A: ulab.numpy.ndarray, overwrite_a: bool = False) -> ulab.numpy.ndarray:
+//|    """
+//|    :param ~ulab.numpy.ndarray A: a positive definite, symmetric square matrix
+//|    :param ~bool overwrite_a: if true, factor A in place, without taking a copy
+//|    :return ~ulab.numpy.ndarray L: the lower triangular Cholesky factor of A
+//|    :raises TypeError: if overwrite_a is set, and A is not a dense array of float dtype
+//|    :raises ValueError: if A is not positive definite
+//|
+//|    Compute the Cholesky factorization of A, for use with cho_solve. Only the
+//|    lower triangle of A is read; with overwrite_a, the factor is written into
+//|    the lower triangle of A itself, and the entries above the diagonal are
+//|    left untouched"""
+//|    ...
+//|
+
+static mp_obj_t cho_factor(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_overwrite_a, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_FALSE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *A = MP_OBJ_TO_PTR(args[0].u_obj);
+    if((A->ndim != 2) || (A->shape[ULAB_MAX_DIMS - 1] != A->shape[ULAB_MAX_DIMS - 2])) {
+        mp_raise_ValueError(translate("input must be a square matrix"));
+    }
+    size_t N = A->shape[ULAB_MAX_DIMS - 1];
+
+    ndarray_obj_t *L;
+    mp_float_t *Larray;
+    if(mp_obj_is_true(args[1].u_obj)) {
+        // factor the input in place, without taking a copy
+        if((A->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(A)) {
+            mp_raise_TypeError(translate("input must be a dense float ndarray"));
+        }
+        L = A;
+        Larray = (mp_float_t *)A->array;
+    } else {
+        L = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, N, N), NDARRAY_FLOAT);
+        Larray = (mp_float_t *)L->array;
+
+        mp_float_t (*func)(void *) = ndarray_get_float_function(A->dtype);
+        uint8_t *array = (uint8_t *)A->array;
+        for(size_t i = 0; i < N; i++) { // rows
+            for(size_t j = 0; j < N; j++) { // columns
+                *Larray++ = func(array);
+                array += A->strides[ULAB_MAX_DIMS - 1];
+            }
+            array -= A->strides[ULAB_MAX_DIMS - 1] * N;
+            array += A->strides[ULAB_MAX_DIMS - 2];
+        }
+        Larray -= N * N;
+    }
+
+    // Cholesky-Crout: entries are read from, and written to the lower
+    // triangle only, so the upper triangle of the input can safely hold
+    // the original data
+    for(size_t i = 0; i < N; i++) { // rows
+        for(size_t j = 0; j <= i; j++) { // columns
+            mp_float_t sum = Larray[i * N + j];
+            for(size_t k = 0; k < j; k++) {
+                sum -= Larray[i * N + k] * Larray[j * N + k];
+            }
+            if(i == j) {
+                if(sum <= MICROPY_FLOAT_CONST(0.0)) {
+                    mp_raise_ValueError(translate("matrix is not positive definite"));
+                } else {
+                    Larray[i * N + i] = MICROPY_FLOAT_C_FUN(sqrt)(sum);
+                }
+            } else {
+                Larray[i * N + j] = sum / Larray[j * N + j];
+            }
+        }
+    }
+    return MP_OBJ_FROM_PTR(L);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(linalg_cho_factor_obj, 1, cho_factor);
+
+//| def cho_solve(L: ulab.numpy.ndarray, b: ulab.numpy.ndarray, out: Optional[ulab.numpy.ndarray] = None) -> ulab.numpy.ndarray:
 //|    """
 //|    :param ~ulab.numpy.ndarray L: the lower triangular, Cholesky factorization of A
 //|    :param ~ulab.numpy.ndarray b: right-hand-side vector b
+//|    :param ~ulab.numpy.ndarray out: if supplied, the solution is written into this array
 //|    :return: solution to the system A x = b. Shape of return matches b
 //|    :raises TypeError: if L and b are not of type ndarray and are not dense
 //|
@@ -158,14 +243,22 @@ MP_DEFINE_CONST_FUN_OBJ_KW(linalg_solve_triangular_obj, 2, solve_triangular);
 //|    ...
 //|
 
-static mp_obj_t cho_solve(mp_obj_t _L, mp_obj_t _b) {
+static mp_obj_t cho_solve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    if(!mp_obj_is_type(_L, &ulab_ndarray_type) || !mp_obj_is_type(_b, &ulab_ndarray_type)) {
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type) || !mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
         mp_raise_TypeError(translate("first two arguments must be ndarrays"));
     }
 
-    ndarray_obj_t *L = MP_OBJ_TO_PTR(_L);
-    ndarray_obj_t *b = MP_OBJ_TO_PTR(_b);
+    ndarray_obj_t *L = MP_OBJ_TO_PTR(args[0].u_obj);
+    ndarray_obj_t *b = MP_OBJ_TO_PTR(args[1].u_obj);
 
     if(!ndarray_is_dense(L) || !ndarray_is_dense(b)) {
         mp_raise_TypeError(translate("input must be a dense ndarray"));
@@ -173,87 +266,45 @@ static mp_obj_t cho_solve(mp_obj_t _L, mp_obj_t _b) {
 
     mp_float_t (*get_L_ele)(void *) = ndarray_get_float_function(L->dtype);
     mp_float_t (*get_b_ele)(void *) = ndarray_get_float_function(b->dtype);
-    void (*set_L_ele)(void *, mp_float_t) = ndarray_set_float_function(L->dtype);
-
-    size_t L_rows = L->shape[ULAB_MAX_DIMS - 2];
-    size_t L_cols = L->shape[ULAB_MAX_DIMS - 1];
 
-    // Obtain transpose of the input matrix L in L_t
-    size_t L_t_shape[ULAB_MAX_DIMS];
-    size_t L_t_rows = L_t_shape[ULAB_MAX_DIMS - 2] = L_cols;
-    size_t L_t_cols = L_t_shape[ULAB_MAX_DIMS - 1] = L_rows;
-    ndarray_obj_t *L_t = ndarray_new_dense_ndarray(L->ndim, L_t_shape, L->dtype);
+    size_t N = L->shape[ULAB_MAX_DIMS - 2];
 
     uint8_t *L_arr = (uint8_t *)L->array;
-    uint8_t *L_t_arr = (uint8_t *)L_t->array;
     uint8_t *b_arr = (uint8_t *)b->array;
 
-    size_t i, j;
-
-    uint8_t *L_ptr = L_arr;
-    uint8_t *L_t_ptr = L_t_arr;
-    for (i = 0; i < L_rows; i++) {
-        for (j = 0; j < L_cols; j++) {
-            set_L_ele(L_t_ptr, get_L_ele(L_ptr));
-            L_t_ptr += L_t->strides[ULAB_MAX_DIMS - 2];
-            L_ptr += L->strides[ULAB_MAX_DIMS - 1];
-        }
-
-        L_t_ptr -= j * L_t->strides[ULAB_MAX_DIMS - 2];
-        L_t_ptr += L_t->strides[ULAB_MAX_DIMS - 1];
-        L_ptr -= j * L->strides[ULAB_MAX_DIMS - 1];
-        L_ptr += L->strides[ULAB_MAX_DIMS - 2];
-    }
-
-    ndarray_obj_t *x = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
+    // the solution is built in the output array itself: the forward
+    // substitution leaves y there, and the backward substitution then
+    // overwrites it with x, so no temporary arrays are needed
+    ndarray_obj_t *x = tools_validate_out(args[2].u_obj, b->ndim, b->shape, NDARRAY_FLOAT);
     mp_float_t *x_arr = (mp_float_t *)x->array;
 
-    ndarray_obj_t *y = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
-    mp_float_t *y_arr = (mp_float_t *)y->array;
-
-    // solve L y = b to obtain y, where L_t x = y
-    for (i = 0; i < L_rows; i++) {
-        mp_float_t sum = 0.0;
-        for (j = 0; j < i; j++) {
-            sum += (get_L_ele(L_arr) * (*y_arr++));
-            L_arr += L->strides[ULAB_MAX_DIMS - 1];
+    // solve L y = b by forward substitution
+    for(size_t i = 0; i < N; i++) {
+        mp_float_t sum = get_b_ele(b_arr);
+        uint8_t *L_row = L_arr + i * L->strides[ULAB_MAX_DIMS - 2];
+        for(size_t j = 0; j < i; j++) {
+            sum -= get_L_ele(L_row) * x_arr[j];
+            L_row += L->strides[ULAB_MAX_DIMS - 1];
         }
-
-        sum = (get_b_ele(b_arr) - sum) / (get_L_ele(L_arr));
-        *y_arr = sum;
-
-        y_arr -= j;
-        L_arr -= L->strides[ULAB_MAX_DIMS - 1] * j;
-        L_arr += L->strides[ULAB_MAX_DIMS - 2];
+        x_arr[i] = sum / get_L_ele(L_row);
         b_arr += b->strides[ULAB_MAX_DIMS - 1];
     }
 
-    // using y, solve L_t x = y to obtain x
-    L_t_arr += (L_t->strides[ULAB_MAX_DIMS - 2] * L_t_rows);
-    y_arr += L_t_cols;
-    x_arr += L_t_cols;
-
-    for (i = L_t_rows - 1; i < L_t_rows; i--) {
-        mp_float_t sum = 0.0;
-        for (j = i + 1; j < L_t_cols; j++) {
-            sum += (get_L_ele(L_t_arr) * (*x_arr++));
-            L_t_arr += L_t->strides[ULAB_MAX_DIMS - 1];
+    // solve L^T x = y by backward substitution; the transpose is never
+    // formed, the columns of L are walked instead
+    for(size_t i = N; i > 0; i--) {
+        size_t k = i - 1;
+        mp_float_t sum = x_arr[k];
+        for(size_t j = k + 1; j < N; j++) {
+            sum -= get_L_ele(L_arr + j * L->strides[ULAB_MAX_DIMS - 2] + k * L->strides[ULAB_MAX_DIMS - 1]) * x_arr[j];
         }
-
-        x_arr -= (j - i);
-        L_t_arr -= (L_t->strides[ULAB_MAX_DIMS - 1] * (j - i));
-        y_arr--;
-
-        sum = ((*y_arr) - sum) / get_L_ele(L_t_arr);
-        *x_arr = sum;
-
-        L_t_arr -= L_t->strides[ULAB_MAX_DIMS - 2];
+        x_arr[k] = sum / get_L_ele(L_arr + k * (L->strides[ULAB_MAX_DIMS - 2] + L->strides[ULAB_MAX_DIMS - 1]));
     }
 
     return MP_OBJ_FROM_PTR(x);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(linalg_cho_solve_obj, cho_solve);
+MP_DEFINE_CONST_FUN_OBJ_KW(linalg_cho_solve_obj, 2, cho_solve);
 
 #endif
 
@@ -263,6 +314,9 @@ static const mp_rom_map_elem_t ulab_scipy_linalg_globals_table[] = {
         #if ULAB_SCIPY_LINALG_HAS_SOLVE_TRIANGULAR
         { MP_ROM_QSTR(MP_QSTR_solve_triangular), MP_ROM_PTR(&linalg_solve_triangular_obj) },
         #endif
+        #if ULAB_SCIPY_LINALG_HAS_CHO_FACTOR
+        { MP_ROM_QSTR(MP_QSTR_cho_factor), MP_ROM_PTR(&linalg_cho_factor_obj) },
+        #endif
         #if ULAB_SCIPY_LINALG_HAS_CHO_SOLVE
         { MP_ROM_QSTR(MP_QSTR_cho_solve), MP_ROM_PTR(&linalg_cho_solve_obj) },
         #endif
@@ -13,6 +13,7 @@
 */
 
 #include <math.h>
+#include <string.h>
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "py/misc.h"
@@ -20,6 +21,7 @@
 #include "../../ndarray.h"
 #include "../../ulab.h"
 #include "../../ulab_tools.h"
+#include "../../numpy/linalg/linalg_tools.h"
 #include "optimize.h"
 
 ULAB_DEFINE_FLOAT_CONST(xtolerance, MICROPY_FLOAT_CONST(2.4e-7), 0x3480d959UL, 0x3e901b2b29a4692bULL);
@@ -33,6 +35,43 @@ static mp_float_t optimize_python_call(const mp_obj_type_t *type, mp_obj_t fun,
     return mp_obj_get_float(type->MP_TYPE_CALL(fun, nparams+1, 0, fargs));
 }
 
+#if ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ || ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
+static void optimize_vector_call(const mp_obj_type_t *type, mp_obj_t fun, mp_obj_t *fargs,
+    mp_float_t *params, uint8_t nparams, mp_float_t *values, size_t len) {
+    // Evaluates f(x, a1, a2, ...) on the complete x vector in a single
+    // python call, and unpacks the returned vector into values. fargs[0]
+    // must already hold the x object.
+    for(uint8_t p = 0; p < nparams; p++) {
+        fargs[p+1] = mp_obj_new_float(params[p]);
+    }
+    mp_obj_t result = type->MP_TYPE_CALL(fun, nparams+1, 0, fargs);
+    if(mp_obj_is_type(result, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("function must return a real-valued array"));
+        }
+        #endif
+        if((ndarray->ndim != 1) || (ndarray->len != len)) {
+            mp_raise_ValueError(translate("function must return a 1D array of the same length as the data"));
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        for(size_t i = 0; i < len; i++) {
+            values[i] = func(array);
+            array += ndarray->strides[ULAB_MAX_DIMS - 1];
+        }
+    } else if(ndarray_object_is_array_like(result)) {
+        if((size_t)mp_obj_get_int(mp_obj_len_maybe(result)) != len) {
+            mp_raise_ValueError(translate("function must return a 1D array of the same length as the data"));
+        }
+        fill_array_iterable(values, result);
+    } else {
+        mp_raise_TypeError(translate("function must return an array"));
+    }
+}
+#endif /* ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ || ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT */
+
 #if ULAB_SCIPY_OPTIMIZE_HAS_BISECT
 //| def bisect(
 //|     fun: Callable[[float], float],
@@ -103,6 +142,221 @@ STATIC mp_obj_t optimize_bisect(size_t n_args, const mp_obj_t *pos_args, mp_map_
 MP_DEFINE_CONST_FUN_OBJ_KW(optimize_bisect_obj, 3, optimize_bisect);
 #endif
 
+#if ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ
+//| def brentq(
+//|     fun: Union[Callable[[float], float], Callable[[ulab.numpy.ndarray], ulab.numpy.ndarray]],
+//|     a: Union[float, _ArrayLike],
+//|     b: Union[float, _ArrayLike],
+//|     *,
+//|     xtol: float = 2.4e-7,
+//|     maxiter: int = 100
+//| ) -> Union[float, ulab.numpy.ndarray]:
+//|     """
+//|     :param callable fun: The function whose root is sought
+//|     :param a: The left side of the bracketing interval(s)
+//|     :param b: The right side of the bracketing interval(s)
+//|     :param float xtol: The tolerance value
+//|     :param int maxiter: The maximum number of iterations to perform
+//|
+//|     Find a zero of the function on the sign-changing interval (``a``..``b``) with
+//|     Brent's method, which combines bisection with inverse quadratic interpolation,
+//|     and usually needs far fewer function evaluations than ``bisect``. If ``a`` and
+//|     ``b`` are vectors of equal length, the independent roots are tracked in
+//|     lockstep, and the function is called once per iteration with the array of
+//|     current candidates, instead of once per root."""
+//|     ...
+//|
+
+static mp_obj_t optimize_brentq(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    // Brent's method, following the classic zbrent formulation; the function
+    // evaluation is the synchronisation point, so that in the batched mode all
+    // roots can be advanced with a single python call per iteration
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_xtol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(xtolerance)} },
+        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t fun = args[0].u_obj;
+    const mp_obj_type_t *type = mp_obj_get_type(fun);
+    if(mp_type_get_call_slot(type) == NULL) {
+        mp_raise_TypeError(translate("first argument must be a function"));
+    }
+    mp_float_t xtol = mp_obj_get_float(args[3].u_obj);
+    if(args[4].u_int <= 0) {
+        mp_raise_ValueError(translate("maxiter must be > 0"));
+    }
+    uint16_t maxiter = (uint16_t)args[4].u_int;
+
+    bool batched = ndarray_object_is_array_like(args[1].u_obj);
+    size_t len = 1;
+    if(batched) {
+        if(!ndarray_object_is_array_like(args[2].u_obj)) {
+            mp_raise_TypeError(translate("data must be iterable"));
+        }
+        len = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[1].u_obj));
+        if(len != (size_t)mp_obj_get_int(mp_obj_len_maybe(args[2].u_obj))) {
+            mp_raise_ValueError(translate("data must be of equal length"));
+        }
+    }
+
+    mp_float_t *xa = m_new(mp_float_t, len);
+    mp_float_t *xb = m_new(mp_float_t, len);
+    mp_float_t *xc = m_new(mp_float_t, len);
+    mp_float_t *fa = m_new(mp_float_t, len);
+    mp_float_t *fb = m_new(mp_float_t, len);
+    mp_float_t *fc = m_new(mp_float_t, len);
+    mp_float_t *d = m_new(mp_float_t, len);
+    mp_float_t *e = m_new(mp_float_t, len);
+    mp_float_t *fnew = m_new(mp_float_t, len);
+    uint8_t *done = m_new(uint8_t, len);
+
+    ndarray_obj_t *candidates = NULL;
+    mp_float_t *candarray = NULL;
+    mp_obj_t fargs[1];
+    if(batched) {
+        fill_array_iterable(xa, args[1].u_obj);
+        fill_array_iterable(xb, args[2].u_obj);
+        candidates = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        candarray = (mp_float_t *)candidates->array;
+        fargs[0] = MP_OBJ_FROM_PTR(candidates);
+        memcpy(candarray, xa, len * sizeof(mp_float_t));
+        optimize_vector_call(type, fun, fargs, NULL, 0, fa, len);
+        memcpy(candarray, xb, len * sizeof(mp_float_t));
+        optimize_vector_call(type, fun, fargs, NULL, 0, fb, len);
+    } else {
+        xa[0] = mp_obj_get_float(args[1].u_obj);
+        xb[0] = mp_obj_get_float(args[2].u_obj);
+        fa[0] = optimize_python_call(type, fun, xa[0], fargs, 0);
+        fb[0] = optimize_python_call(type, fun, xb[0], fargs, 0);
+    }
+
+    for(size_t i = 0; i < len; i++) {
+        if(fa[i] * fb[i] > MICROPY_FLOAT_CONST(0.0)) {
+            mp_raise_ValueError(translate("function has the same sign at the ends of interval"));
+        }
+        xc[i] = xb[i];
+        fc[i] = fb[i];
+        d[i] = e[i] = xb[i] - xa[i];
+        done[i] = 0;
+    }
+
+    for(uint16_t iter = 0; iter < maxiter; iter++) {
+        size_t pending = 0;
+        for(size_t i = 0; i < len; i++) {
+            if(done[i]) {
+                if(batched) {
+                    candarray[i] = xb[i]; // keep the lane occupied with the root
+                }
+                continue;
+            }
+            if(((fb[i] > MICROPY_FLOAT_CONST(0.0)) && (fc[i] > MICROPY_FLOAT_CONST(0.0))) ||
+                ((fb[i] < MICROPY_FLOAT_CONST(0.0)) && (fc[i] < MICROPY_FLOAT_CONST(0.0)))) {
+                xc[i] = xa[i];
+                fc[i] = fa[i];
+                d[i] = e[i] = xb[i] - xa[i];
+            }
+            if(MICROPY_FLOAT_C_FUN(fabs)(fc[i]) < MICROPY_FLOAT_C_FUN(fabs)(fb[i])) {
+                xa[i] = xb[i]; xb[i] = xc[i]; xc[i] = xa[i];
+                fa[i] = fb[i]; fb[i] = fc[i]; fc[i] = fa[i];
+            }
+            mp_float_t tol1 = MICROPY_FLOAT_CONST(2.0) * OPTIMIZE_EPSILON * MICROPY_FLOAT_C_FUN(fabs)(xb[i]) + MICROPY_FLOAT_CONST(0.5) * xtol;
+            mp_float_t xm = MICROPY_FLOAT_CONST(0.5) * (xc[i] - xb[i]);
+            if((MICROPY_FLOAT_C_FUN(fabs)(xm) <= tol1) || (fb[i] == MICROPY_FLOAT_CONST(0.0))) {
+                done[i] = 1;
+                if(batched) {
+                    candarray[i] = xb[i];
+                }
+                continue;
+            }
+            if((MICROPY_FLOAT_C_FUN(fabs)(e[i]) >= tol1) &&
+                (MICROPY_FLOAT_C_FUN(fabs)(fa[i]) > MICROPY_FLOAT_C_FUN(fabs)(fb[i]))) {
+                // attempt inverse quadratic interpolation
+                mp_float_t p, q;
+                mp_float_t s = fb[i] / fa[i];
+                if(xa[i] == xc[i]) {
+                    p = MICROPY_FLOAT_CONST(2.0) * xm * s;
+                    q = MICROPY_FLOAT_CONST(1.0) - s;
+                } else {
+                    q = fa[i] / fc[i];
+                    mp_float_t r = fb[i] / fc[i];
+                    p = s * (MICROPY_FLOAT_CONST(2.0) * xm * q * (q - r) - (xb[i] - xa[i]) * (r - MICROPY_FLOAT_CONST(1.0)));
+                    q = (q - MICROPY_FLOAT_CONST(1.0)) * (r - MICROPY_FLOAT_CONST(1.0)) * (s - MICROPY_FLOAT_CONST(1.0));
+                }
+                if(p > MICROPY_FLOAT_CONST(0.0)) {
+                    q = -q;
+                }
+                p = MICROPY_FLOAT_C_FUN(fabs)(p);
+                mp_float_t min1 = MICROPY_FLOAT_CONST(3.0) * xm * q - MICROPY_FLOAT_C_FUN(fabs)(tol1 * q);
+                mp_float_t min2 = MICROPY_FLOAT_C_FUN(fabs)(e[i] * q);
+                if(MICROPY_FLOAT_CONST(2.0) * p < (min1 < min2 ? min1 : min2)) {
+                    e[i] = d[i]; // accept the interpolation
+                    d[i] = p / q;
+                } else {
+                    d[i] = xm; // fall back on bisection
+                    e[i] = d[i];
+                }
+            } else {
+                d[i] = xm;
+                e[i] = d[i];
+            }
+            xa[i] = xb[i];
+            fa[i] = fb[i];
+            if(MICROPY_FLOAT_C_FUN(fabs)(d[i]) > tol1) {
+                xb[i] += d[i];
+            } else {
+                xb[i] += xm > MICROPY_FLOAT_CONST(0.0) ? tol1 : -tol1;
+            }
+            if(batched) {
+                candarray[i] = xb[i];
+            }
+            pending++;
+        }
+        if(pending == 0) {
+            break;
+        }
+        if(batched) {
+            optimize_vector_call(type, fun, fargs, NULL, 0, fnew, len);
+            for(size_t i = 0; i < len; i++) {
+                if(!done[i]) {
+                    fb[i] = fnew[i];
+                }
+            }
+        } else {
+            fb[0] = optimize_python_call(type, fun, xb[0], fargs, 0);
+        }
+    }
+
+    mp_obj_t result;
+    if(batched) {
+        ndarray_obj_t *roots = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        memcpy((mp_float_t *)roots->array, xb, len * sizeof(mp_float_t));
+        result = MP_OBJ_FROM_PTR(roots);
+    } else {
+        result = mp_obj_new_float(xb[0]);
+    }
+
+    m_del(mp_float_t, xa, len);
+    m_del(mp_float_t, xb, len);
+    m_del(mp_float_t, xc, len);
+    m_del(mp_float_t, fa, len);
+    m_del(mp_float_t, fb, len);
+    m_del(mp_float_t, fc, len);
+    m_del(mp_float_t, d, len);
+    m_del(mp_float_t, e, len);
+    m_del(mp_float_t, fnew, len);
+    m_del(uint8_t, done, len);
+    return result;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(optimize_brentq_obj, 3, optimize_brentq);
+#endif
+
 #if ULAB_SCIPY_OPTIMIZE_HAS_FMIN
 //| def fmin(
 //|     fun: Callable[[float], float],
@@ -220,43 +474,70 @@ MP_DEFINE_CONST_FUN_OBJ_KW(optimize_fmin_obj, 2, optimize_fmin);
 #endif
 
 #if ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
-static void optimize_jacobi(const mp_obj_type_t *type, mp_obj_t fun, mp_float_t *x, mp_float_t *y, uint16_t len, mp_float_t *params, uint8_t nparams, mp_float_t *jacobi, mp_float_t *grad) {
-    /* Calculates the Jacobian and the gradient of the cost function
-     *
-     * The entries in the Jacobian are
-     * J(m, n) = de_m/da_n,
-     *
-     * where
-     *
-     * e_m = (f(x_m, a1, a2, ...) - y_m)/sigma_m is the error at x_m,
-     *
-     * and
-     *
-     * a1, a2, ..., a_n are the free parameters
-     */
-    mp_obj_t *fargs0 = m_new(mp_obj_t, lenp+1);
-    mp_obj_t *fargs1 = m_new(mp_obj_t, lenp+1);
-    for(uint8_t p=0; p < nparams; p++) {
-        fargs0[p+1] = mp_obj_new_float(params[p]);
-        fargs1[p+1] = mp_obj_new_float(params[p]);
-    }
-    for(uint8_t p=0; p < nparams; p++) {
-        mp_float_t da = params[p] != MICROPY_FLOAT_CONST(0.0) ? (MICROPY_FLOAT_CONST(1.0) + APPROX_NONZDELTA) * params[p] : APPROX_ZDELTA;
-        fargs1[p+1] = mp_obj_new_float(params[p] + da);
-        grad[p] = MICROPY_FLOAT_CONST(0.0);
-        for(uint16_t i=0; i < len; i++) {
-            mp_float_t f0 = optimize_python_call(type, fun, x[i], fargs0, nparams);
-            mp_float_t f1 = optimize_python_call(type, fun, x[i], fargs1, nparams);
-            jacobi[i*nparamp+p] = (f1 - f0) / da;
-            grad[p] += (f0 - y[i]) * jacobi[i*nparamp+p];
+static bool optimize_cholesky_solve(mp_float_t *A, mp_float_t *b, uint8_t n) {
+    // Solves the symmetric positive definite system A x = b by an in-place
+    // Cholesky decomposition, followed by forward and backward substitution;
+    // the solution is returned in b. Returns false, if A is not positive definite.
+    for(uint8_t j = 0; j < n; j++) {
+        mp_float_t d = A[j * n + j];
+        for(uint8_t k = 0; k < j; k++) {
+            d -= A[j * n + k] * A[j * n + k];
+        }
+        if(d <= MICROPY_FLOAT_CONST(0.0)) {
+            return false;
+        }
+        d = MICROPY_FLOAT_C_FUN(sqrt)(d);
+        A[j * n + j] = d;
+        for(uint8_t i = j + 1; i < n; i++) {
+            mp_float_t s = A[i * n + j];
+            for(uint8_t k = 0; k < j; k++) {
+                s -= A[i * n + k] * A[j * n + k];
+            }
+            A[i * n + j] = s / d;
+        }
+    }
+    for(uint8_t i = 0; i < n; i++) { // L y = b
+        mp_float_t s = b[i];
+        for(uint8_t k = 0; k < i; k++) {
+            s -= A[i * n + k] * b[k];
         }
-        fargs1[p+1] = fargs0[p+1]; // set back to the original value
+        b[i] = s / A[i * n + i];
     }
+    for(uint8_t i = n; i > 0; i--) { // L^T x = y
+        mp_float_t s = b[i - 1];
+        for(uint8_t k = i; k < n; k++) {
+            s -= A[k * n + i - 1] * b[k];
+        }
+        b[i - 1] = s / A[(i - 1) * n + i - 1];
+    }
+    return true;
 }
 
-static void optimize_delta(mp_float_t *jacobi, mp_float_t *grad, uint16_t len, uint8_t nparams, mp_float_t lambda) {
-    //
-}
+//| def curve_fit(
+//|     f: Callable[..., ulab.numpy.ndarray],
+//|     xdata: _ArrayLike,
+//|     ydata: _ArrayLike,
+//|     p0: _ArrayLike,
+//|     *,
+//|     xatol: float = 2.4e-7,
+//|     fatol: float = 2.4e-7,
+//|     maxiter: int = 100
+//| ) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param callable f: The model function; called as ``f(xdata, a1, a2, ...)``, and must return the model values as a vector
+//|     :param xdata: The independent variable; passed to ``f`` unchanged
+//|     :param ydata: The measured values
+//|     :param p0: Initial guess for the free parameters
+//|     :param float xatol: Convergence tolerance on the parameter step
+//|     :param float fatol: Convergence tolerance on the decrease of the sum of squared residuals
+//|     :param int maxiter: The maximum number of iterations to perform
+//|
+//|     Fit the free parameters of ``f`` to the data with the Levenberg-Marquardt
+//|     method. The model is evaluated on the complete x vector at once, so one
+//|     iteration costs a handful of python calls, independent of the number of
+//|     data points. Returns the (parameters, covariance) tuple."""
+//|     ...
+//|
 
 mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     // Levenberg-Marquardt non-linear fit
@@ -268,7 +549,7 @@ mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
         { MP_QSTR_p0, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_xatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&xtolerance)} },
         { MP_QSTR_fatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&xtolerance)} },
-        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -291,39 +572,156 @@ mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     }
     size_t len = (size_t)mp_obj_get_int(mp_obj_len_maybe(x_obj));
     uint8_t lenp = (uint8_t)mp_obj_get_int(mp_obj_len_maybe(p0_obj));
-    if(len != (uint16_t)mp_obj_get_int(mp_obj_len_maybe(y_obj))) {
+    if(len != (size_t)mp_obj_get_int(mp_obj_len_maybe(y_obj))) {
         mp_raise_ValueError(translate("data must be of equal length"));
     }
+    if(lenp == 0) {
+        mp_raise_ValueError(translate("initial values must be iterable"));
+    }
+
+    mp_float_t xatol = mp_obj_get_float(args[4].u_obj);
+    mp_float_t fatol = mp_obj_get_float(args[5].u_obj);
+    if(args[6].u_int <= 0) {
+        mp_raise_ValueError(translate("maxiter must be > 0"));
+    }
+    uint16_t maxiter = (uint16_t)args[6].u_int;
 
-    mp_float_t *x = m_new(mp_float_t, len);
-    fill_array_iterable(x, x_obj);
     mp_float_t *y = m_new(mp_float_t, len);
     fill_array_iterable(y, y_obj);
-    mp_float_t *p0 = m_new(mp_float_t, lenp);
-    fill_array_iterable(p0, p0_obj);
-    mp_float_t *grad = m_new(mp_float_t, len);
-    mp_float_t *jacobi = m_new(mp_float_t, len*len);
-    mp_obj_t *fargs = m_new(mp_obj_t, lenp+1);
-
-    m_del(mp_float_t, p0, lenp);
-    // parameters controlling convergence conditions
-    //mp_float_t xatol = mp_obj_get_float(args[2].u_obj);
-    //mp_float_t fatol = mp_obj_get_float(args[3].u_obj);
+    mp_float_t *p = m_new(mp_float_t, lenp);
+    fill_array_iterable(p, p0_obj);
+    mp_float_t *f0 = m_new(mp_float_t, len);
+    mp_float_t *f1 = m_new(mp_float_t, len);
+    mp_float_t *jacobi = m_new(mp_float_t, len * lenp);
+    mp_float_t *JTJ = m_new(mp_float_t, lenp * lenp);
+    mp_float_t *A = m_new(mp_float_t, lenp * lenp);
+    mp_float_t *grad = m_new(mp_float_t, lenp);
+    mp_float_t *delta = m_new(mp_float_t, lenp);
+    mp_float_t *ptrial = m_new(mp_float_t, lenp);
+    mp_obj_t *fargs = m_new(mp_obj_t, lenp + 1);
+    fargs[0] = x_obj;
+
+    optimize_vector_call(type, fun, fargs, p, lenp, f0, len);
+    mp_float_t cost = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t r = f0[i] - y[i];
+        cost += r * r;
+    }
 
     // this has finite binary representation; we will multiply/divide by 4
-    //mp_float_t lambda = 0.0078125;
+    mp_float_t lambda = MICROPY_FLOAT_CONST(0.0078125);
+
+    for(uint16_t iter = 0; iter < maxiter; iter++) {
+        // the Jacobian J(m, n) = df_m/da_n by forward differences; one
+        // vectorized python call per parameter
+        for(uint8_t q = 0; q < lenp; q++) {
+            mp_float_t da = p[q] != MICROPY_FLOAT_CONST(0.0) ? OPTIMIZE_NONZDELTA * p[q] : OPTIMIZE_ZDELTA;
+            mp_float_t save = p[q];
+            p[q] += da;
+            optimize_vector_call(type, fun, fargs, p, lenp, f1, len);
+            p[q] = save;
+            for(size_t i = 0; i < len; i++) {
+                jacobi[i * lenp + q] = (f1[i] - f0[i]) / da;
+            }
+        }
+        // normal equations: J^T J, and the gradient J^T r
+        for(uint8_t j = 0; j < lenp; j++) {
+            for(uint8_t k = 0; k <= j; k++) {
+                mp_float_t s = MICROPY_FLOAT_CONST(0.0);
+                for(size_t i = 0; i < len; i++) {
+                    s += jacobi[i * lenp + j] * jacobi[i * lenp + k];
+                }
+                JTJ[j * lenp + k] = s;
+                JTJ[k * lenp + j] = s;
+            }
+            mp_float_t s = MICROPY_FLOAT_CONST(0.0);
+            for(size_t i = 0; i < len; i++) {
+                s += jacobi[i * lenp + j] * (f0[i] - y[i]);
+            }
+            grad[j] = s;
+        }
+        // try damped steps, until the cost decreases
+        bool improved = false;
+        mp_float_t improvement = MICROPY_FLOAT_CONST(0.0);
+        mp_float_t dmax = MICROPY_FLOAT_CONST(0.0);
+        while(lambda < MICROPY_FLOAT_CONST(1.0e9)) {
+            memcpy(A, JTJ, lenp * lenp * sizeof(mp_float_t));
+            for(uint8_t j = 0; j < lenp; j++) {
+                A[j * lenp + j] *= MICROPY_FLOAT_CONST(1.0) + lambda;
+            }
+            memcpy(delta, grad, lenp * sizeof(mp_float_t));
+            if(optimize_cholesky_solve(A, delta, lenp)) {
+                for(uint8_t j = 0; j < lenp; j++) {
+                    ptrial[j] = p[j] - delta[j];
+                }
+                optimize_vector_call(type, fun, fargs, ptrial, lenp, f1, len);
+                mp_float_t trial_cost = MICROPY_FLOAT_CONST(0.0);
+                for(size_t i = 0; i < len; i++) {
+                    mp_float_t r = f1[i] - y[i];
+                    trial_cost += r * r;
+                }
+                if(trial_cost < cost) {
+                    memcpy(p, ptrial, lenp * sizeof(mp_float_t));
+                    SWAP(mp_float_t *, f0, f1);
+                    improvement = cost - trial_cost;
+                    cost = trial_cost;
+                    lambda *= MICROPY_FLOAT_CONST(0.25);
+                    dmax = MICROPY_FLOAT_CONST(0.0);
+                    for(uint8_t j = 0; j < lenp; j++) {
+                        mp_float_t d = MICROPY_FLOAT_C_FUN(fabs)(delta[j]);
+                        dmax = d > dmax ? d : dmax;
+                    }
+                    improved = true;
+                    break;
+                }
+            }
+            lambda *= MICROPY_FLOAT_CONST(4.0);
+        }
+        if(!improved || (dmax < xatol) || (improvement < fatol)) {
+            break;
+        }
+    }
 
-    //linalg_invert_matrix(mp_float_t *data, size_t N)
+    ndarray_obj_t *parameters = ndarray_new_linear_array(lenp, NDARRAY_FLOAT);
+    mp_float_t *parray = (mp_float_t *)parameters->array;
+    memcpy(parray, p, lenp * sizeof(mp_float_t));
+
+    // the covariance estimate is the inverse of J^T J, scaled by the
+    // residual variance, as in scipy with absolute_sigma=False
+    mp_obj_t covariance = mp_const_none;
+    #if ULAB_MAX_DIMS > 1
+    ndarray_obj_t *pcov = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, lenp, lenp), NDARRAY_FLOAT);
+    mp_float_t *carray = (mp_float_t *)pcov->array;
+    if((len > lenp) && linalg_invert_matrix(JTJ, lenp)) {
+        mp_float_t scale = cost / (mp_float_t)(len - lenp);
+        for(uint16_t j = 0; j < (uint16_t)lenp * lenp; j++) {
+            carray[j] = JTJ[j] * scale;
+        }
+    } else {
+        for(uint16_t j = 0; j < (uint16_t)lenp * lenp; j++) {
+            carray[j] = (mp_float_t)INFINITY;
+        }
+    }
+    covariance = MP_OBJ_FROM_PTR(pcov);
+    #endif
 
-    m_del(mp_float_t, x, len);
     m_del(mp_float_t, y, len);
-    m_del(mp_float_t, grad, len);
-    m_del(mp_float_t, jacobi, len*len);
-    m_del(mp_obj_t, fargs, lenp+1);
-    return mp_const_none;
+    m_del(mp_float_t, p, lenp);
+    m_del(mp_float_t, f0, len);
+    m_del(mp_float_t, f1, len);
+    m_del(mp_float_t, jacobi, len * lenp);
+    m_del(mp_float_t, JTJ, lenp * lenp);
+    m_del(mp_float_t, A, lenp * lenp);
+    m_del(mp_float_t, grad, lenp);
+    m_del(mp_float_t, delta, lenp);
+    m_del(mp_float_t, ptrial, lenp);
+    m_del(mp_obj_t, fargs, lenp + 1);
+
+    mp_obj_t items[2] = { MP_OBJ_FROM_PTR(parameters), covariance };
+    return mp_obj_new_tuple(2, items);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj, 2, optimize_curve_fit);
+MP_DEFINE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj, 4, optimize_curve_fit);
 #endif
 
 #if ULAB_SCIPY_OPTIMIZE_HAS_NEWTON
@@ -395,6 +793,9 @@ static const mp_rom_map_elem_t ulab_scipy_optimize_globals_table[] = {
     #if ULAB_SCIPY_OPTIMIZE_HAS_BISECT
         { MP_ROM_QSTR(MP_QSTR_bisect), MP_ROM_PTR(&optimize_bisect_obj) },
     #endif
+    #if ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ
+        { MP_ROM_QSTR(MP_QSTR_brentq), MP_ROM_PTR(&optimize_brentq_obj) },
+    #endif
     #if ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
         { MP_ROM_QSTR(MP_QSTR_curve_fit), MP_ROM_PTR(&optimize_curve_fit_obj) },
     #endif
@@ -34,6 +34,7 @@
 extern const mp_obj_module_t ulab_scipy_optimize_module;
 
 MP_DECLARE_CONST_FUN_OBJ_KW(optimize_bisect_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(optimize_brentq_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(optimize_fmin_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(optimize_newton_obj);
@@ -18,6 +18,7 @@
 
 #include "../../ulab.h"
 #include "../../ndarray.h"
+#include "../../ulab_tools.h"
 #include "../../numpy/carray/carray_tools.h"
 
 #if ULAB_SCIPY_SIGNAL_HAS_SOSFILT & ULAB_MAX_DIMS > 1
@@ -120,11 +121,538 @@ mp_obj_t signal_sosfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilt_obj, 2, signal_sosfilt);
 #endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILT */
 
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILTER & ULAB_MAX_DIMS > 1
+//| class sosfilter:
+//|     """A streaming second-order-section filter. The cascade is compiled
+//|     once into a flat coefficient/state block; filter() then processes
+//|     sample blocks in place (or into out=), running all sections per
+//|     sample, while the biquad states persist across calls, so a long
+//|     signal can be filtered block by block without any per-call setup.
+//|     reset() zeroes the states."""
+//|     ...
+//|
+
+typedef struct _signal_sosfilter_obj_t {
+    mp_obj_base_t base;
+    size_t sections;
+    // 7 slots per section: b0, b1, b2, a1, a2, and the two state registers
+    mp_float_t *block;
+    #if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+    // the cascade quantised to Q14; NULL, if a coefficient is out of range
+    int16_t *qblock;
+    int64_t *qstate;
+    #endif
+} signal_sosfilter_obj_t;
+
+static const mp_obj_type_t signal_sosfilter_type;
+
+static mp_obj_t signal_sosfilter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    if(!ndarray_object_is_array_like(all_args[0])) {
+        mp_raise_TypeError(translate("sosfilt requires iterable arguments"));
+    }
+    size_t sections = (size_t)mp_obj_get_int(mp_obj_len_maybe(all_args[0]));
+
+    signal_sosfilter_obj_t *self = m_new_obj(signal_sosfilter_obj_t);
+    self->base.type = &signal_sosfilter_type;
+    self->sections = sections;
+    self->block = m_new0(mp_float_t, 7 * sections);
+    #if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+    self->qblock = m_new0(int16_t, 5 * sections);
+    self->qstate = m_new0(int64_t, 2 * sections);
+    int16_t *q = self->qblock;
+    #endif
+
+    mp_float_t coeffs[6];
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t item, iterable = mp_getiter(all_args[0], &iter_buf);
+    mp_float_t *s = self->block;
+    while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        if(mp_obj_get_int(mp_obj_len_maybe(item)) != 6) {
+            mp_raise_ValueError(translate("sos array must be of shape (n_section, 6)"));
+        }
+        fill_array_iterable(coeffs, item);
+        if(coeffs[3] != MICROPY_FLOAT_CONST(1.0)) {
+            mp_raise_ValueError(translate("sos[:, 3] should be all ones"));
+        }
+        s[0] = coeffs[0];
+        s[1] = coeffs[1];
+        s[2] = coeffs[2];
+        s[3] = coeffs[4];
+        s[4] = coeffs[5];
+        // s[5] and s[6], the state registers, start out as zeros
+        s += 7;
+        #if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+        if(q != NULL) {
+            // quantise the section to Q14; a1 of a stable biquad lies in
+            // (-2, 2), which is exactly the range of a Q14 int16
+            for(uint8_t i = 0; i < 5; i++) {
+                mp_float_t c = i < 3 ? coeffs[i] : coeffs[i + 1];
+                if((c >= MICROPY_FLOAT_CONST(2.0)) || (c <= MICROPY_FLOAT_CONST(-2.0))) {
+                    // the cascade cannot be represented; only the float
+                    // path remains available
+                    self->qblock = NULL;
+                    q = NULL;
+                    break;
+                }
+                q[i] = (int16_t)MICROPY_FLOAT_C_FUN(round)(c * MICROPY_FLOAT_CONST(16384.0));
+            }
+            if(q != NULL) {
+                q += 5;
+            }
+        }
+        #endif
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+#if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+static void signal_sosfilter_run_q15(signal_sosfilter_obj_t *self, int16_t *x, size_t len) {
+    // integer biquads: the samples are int16, the coefficients Q14, and the
+    // states are carried at Q14 precision in wide accumulators; the output
+    // of each section saturates to the int16 range
+    for(size_t i = 0; i < len; i++) {
+        int32_t xn = x[i];
+        int16_t *q = self->qblock;
+        int64_t *z = self->qstate;
+        for(size_t j = 0; j < self->sections; j++) {
+            int32_t yn = (int32_t)(((int64_t)q[0] * xn + z[0] + 0x2000) >> 14);
+            if(yn > 32767) {
+                yn = 32767;
+            } else if(yn < -32768) {
+                yn = -32768;
+            }
+            z[0] = z[1] + (int64_t)q[1] * xn - (int64_t)q[3] * yn;
+            z[1] = (int64_t)q[2] * xn - (int64_t)q[4] * yn;
+            xn = yn;
+            q += 5;
+            z += 2;
+        }
+        x[i] = (int16_t)xn;
+    }
+}
+#endif /* ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15 */
+
+static void signal_sosfilter_run(signal_sosfilter_obj_t *self, mp_float_t *x, size_t len) {
+    // all sections are run per sample, so the intermediate value stays in
+    // a register, instead of being written back between section passes
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t xn = x[i];
+        mp_float_t *s = self->block;
+        for(size_t j = 0; j < self->sections; j++) {
+            mp_float_t yn = s[0] * xn + s[5];
+            s[5] = s[6] + s[1] * xn - s[3] * yn;
+            s[6] = s[2] * xn - s[4] * yn;
+            xn = yn;
+            s += 7;
+        }
+        x[i] = xn;
+    }
+}
+
+static mp_obj_t signal_sosfilter_filter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_sosfilter_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    if(!mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(args[1].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+    if(x->ndim > 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+
+    if(args[2].u_obj == mp_const_none) {
+        // filter the caller's buffer in place
+        #if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+        if((x->dtype == NDARRAY_INT16) && ndarray_is_dense(x)) {
+            if(self->qblock == NULL) {
+                mp_raise_ValueError(translate("sos coefficients do not fit the Q14 range"));
+            }
+            signal_sosfilter_run_q15(self, (int16_t *)x->array, x->len);
+            return MP_OBJ_FROM_PTR(x);
+        }
+        #endif
+        if((x->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(x)) {
+            mp_raise_TypeError(translate("input must be a float dense array"));
+        }
+        signal_sosfilter_run(self, (mp_float_t *)x->array, x->len);
+        return MP_OBJ_FROM_PTR(x);
+    }
+
+    if(!mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(args[2].u_obj);
+    if((out->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(out)) {
+        mp_raise_TypeError(translate("out must be a float dense array"));
+    }
+    if(out->len != x->len) {
+        mp_raise_ValueError(translate("out array is too small"));
+    }
+    mp_float_t *oarray = (mp_float_t *)out->array;
+    uint8_t *xarray = (uint8_t *)x->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+    for(size_t i = 0; i < x->len; i++) {
+        oarray[i] = func(xarray);
+        xarray += x->strides[ULAB_MAX_DIMS - 1];
+    }
+    signal_sosfilter_run(self, oarray, out->len);
+    return MP_OBJ_FROM_PTR(out);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilter_filter_obj, 2, signal_sosfilter_filter);
+
+static mp_obj_t signal_sosfilter_reset(mp_obj_t self_in) {
+    // zeroes the state registers, leaving the coefficients in place
+    signal_sosfilter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t *s = self->block;
+    for(size_t j = 0; j < self->sections; j++) {
+        s[5] = MICROPY_FLOAT_CONST(0.0);
+        s[6] = MICROPY_FLOAT_CONST(0.0);
+        s += 7;
+    }
+    #if ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+    memset(self->qstate, 0, 2 * self->sections * sizeof(int64_t));
+    #endif
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_sosfilter_reset_obj, signal_sosfilter_reset);
+
+static const mp_rom_map_elem_t signal_sosfilter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_filter), MP_ROM_PTR(&signal_sosfilter_filter_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&signal_sosfilter_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(signal_sosfilter_locals_dict, signal_sosfilter_locals_dict_table);
+
+static const mp_obj_type_t signal_sosfilter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_sosfilter,
+    .make_new = signal_sosfilter_make_new,
+    .locals_dict = (mp_obj_dict_t*)&signal_sosfilter_locals_dict,
+};
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILTER */
+
+#if ULAB_SCIPY_SIGNAL_HAS_FIRFILTER
+//| class firfilter:
+//|     """A streaming FIR filter. The taps are loaded once; process() then
+//|     filters sample blocks in place (or into out=), producing exactly one
+//|     output per input sample, while an internal circular delay line
+//|     carries the history across calls, so a long signal can be filtered
+//|     chunk by chunk without stitching overlap regions. reset() zeroes
+//|     the delay line."""
+//|     ...
+//|
+
+typedef struct _signal_firfilter_obj_t {
+    mp_obj_base_t base;
+    size_t ntaps;
+    mp_float_t *taps;
+    mp_float_t *delay; // circular delay line of ntaps samples
+    size_t pos; // the slot that receives the next sample
+} signal_firfilter_obj_t;
+
+static const mp_obj_type_t signal_firfilter_type;
+
+static mp_obj_t signal_firfilter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    ndarray_obj_t *taps = ndarray_from_mp_obj(all_args[0], 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(taps->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(taps->ndim != 1) {
+        mp_raise_TypeError(translate("input must be a 1D array"));
+    }
+    #endif
+    if(taps->len == 0) {
+        mp_raise_ValueError(translate("convolve arguments must not be empty"));
+    }
+
+    signal_firfilter_obj_t *self = m_new_obj(signal_firfilter_obj_t);
+    self->base.type = &signal_firfilter_type;
+    self->ntaps = taps->len;
+    self->taps = m_new(mp_float_t, taps->len);
+    self->delay = m_new0(mp_float_t, taps->len);
+    self->pos = 0;
+
+    uint8_t *array = (uint8_t *)taps->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(taps->dtype);
+    for(size_t i = 0; i < taps->len; i++) {
+        self->taps[i] = func(array);
+        array += taps->strides[ULAB_MAX_DIMS - 1];
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void signal_firfilter_run(signal_firfilter_obj_t *self, mp_float_t *x, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        self->delay[self->pos] = x[i];
+        // the delay line is walked backwards from the newest sample in two
+        // linear segments, so the inner loops carry no wrap-around branch
+        mp_float_t acc = MICROPY_FLOAT_CONST(0.0);
+        mp_float_t *t = self->taps;
+        for(size_t j = self->pos + 1; j > 0; j--) {
+            acc += *t++ * self->delay[j - 1];
+        }
+        for(size_t j = self->ntaps; j > self->pos + 1; j--) {
+            acc += *t++ * self->delay[j - 1];
+        }
+        self->pos = self->pos + 1 == self->ntaps ? 0 : self->pos + 1;
+        x[i] = acc;
+    }
+}
+
+static mp_obj_t signal_firfilter_process(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_firfilter_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    if(!mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(args[1].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(x->ndim > 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+    #endif
+
+    if(args[2].u_obj == mp_const_none) {
+        // filter the caller's buffer in place
+        if((x->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(x)) {
+            mp_raise_TypeError(translate("input must be a float dense array"));
+        }
+        signal_firfilter_run(self, (mp_float_t *)x->array, x->len);
+        return MP_OBJ_FROM_PTR(x);
+    }
+
+    if(!mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(args[2].u_obj);
+    if((out->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(out)) {
+        mp_raise_TypeError(translate("out must be a float dense array"));
+    }
+    if(out->len != x->len) {
+        mp_raise_ValueError(translate("out array is too small"));
+    }
+    mp_float_t *oarray = (mp_float_t *)out->array;
+    uint8_t *xarray = (uint8_t *)x->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+    for(size_t i = 0; i < x->len; i++) {
+        oarray[i] = func(xarray);
+        xarray += x->strides[ULAB_MAX_DIMS - 1];
+    }
+    signal_firfilter_run(self, oarray, out->len);
+    return MP_OBJ_FROM_PTR(out);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_firfilter_process_obj, 2, signal_firfilter_process);
+
+static mp_obj_t signal_firfilter_reset(mp_obj_t self_in) {
+    // zeroes the delay line, leaving the taps in place
+    signal_firfilter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    memset(self->delay, 0, self->ntaps * sizeof(mp_float_t));
+    self->pos = 0;
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_firfilter_reset_obj, signal_firfilter_reset);
+
+static const mp_rom_map_elem_t signal_firfilter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_process), MP_ROM_PTR(&signal_firfilter_process_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&signal_firfilter_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(signal_firfilter_locals_dict, signal_firfilter_locals_dict_table);
+
+static const mp_obj_type_t signal_firfilter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_firfilter,
+    .make_new = signal_firfilter_make_new,
+    .locals_dict = (mp_obj_dict_t*)&signal_firfilter_locals_dict,
+};
+#endif /* ULAB_SCIPY_SIGNAL_HAS_FIRFILTER */
+
+#if ULAB_SCIPY_SIGNAL_HAS_RESAMPLER
+//| class resampler:
+//|     """A streaming polyphase resampler with integer up/down factors. The
+//|     prototype filter, designed at the upsampled rate, is split into up
+//|     phases once; process() then consumes input chunks, computes only the
+//|     output samples that are actually kept - never the ones a decimator
+//|     would discard - and writes them into a caller-owned float array,
+//|     returning their number. The filter state persists across calls, so
+//|     a continuous signal can be resampled chunk by chunk. reset() zeroes
+//|     the state."""
+//|     ...
+//|
+
+typedef struct _signal_resampler_obj_t {
+    mp_obj_base_t base;
+    size_t up;
+    size_t down;
+    size_t nh; // number of taps per phase
+    size_t acc; // upsampled ticks until the next kept output
+    size_t pos; // the slot of the newest sample in the delay line
+    mp_float_t *taps; // up * nh slots, phase-major, zero-padded
+    mp_float_t *delay; // circular delay line of nh input samples
+} signal_resampler_obj_t;
+
+static const mp_obj_type_t signal_resampler_type;
+
+static mp_obj_t signal_resampler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 3, 3, false);
+    ndarray_obj_t *taps = ndarray_from_mp_obj(all_args[0], 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(taps->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(taps->ndim != 1) {
+        mp_raise_TypeError(translate("input must be a 1D array"));
+    }
+    #endif
+    if(taps->len == 0) {
+        mp_raise_ValueError(translate("convolve arguments must not be empty"));
+    }
+    mp_int_t up = mp_obj_get_int(all_args[1]);
+    mp_int_t down = mp_obj_get_int(all_args[2]);
+    if((up < 1) || (down < 1)) {
+        mp_raise_ValueError(translate("up and down must be positive integers"));
+    }
+
+    signal_resampler_obj_t *self = m_new_obj(signal_resampler_obj_t);
+    self->base.type = &signal_resampler_type;
+    self->up = (size_t)up;
+    self->down = (size_t)down;
+    self->nh = (taps->len + (size_t)up - 1) / (size_t)up;
+    self->acc = 0;
+    self->pos = 0;
+    self->taps = m_new0(mp_float_t, (size_t)up * self->nh);
+    self->delay = m_new0(mp_float_t, self->nh);
+
+    // split the prototype into phases: phase p collects the taps
+    // h[p], h[p + up], h[p + 2 up], ...
+    uint8_t *array = (uint8_t *)taps->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(taps->dtype);
+    for(size_t i = 0; i < taps->len; i++) {
+        self->taps[(i % (size_t)up) * self->nh + i / (size_t)up] = func(array);
+        array += taps->strides[ULAB_MAX_DIMS - 1];
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t signal_resampler_process(mp_obj_t self_in, mp_obj_t x_in, mp_obj_t out_in) {
+    signal_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(!mp_obj_is_type(x_in, &ulab_ndarray_type) || !mp_obj_is_type(out_in, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(x_in);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(x->ndim > 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+    #endif
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(out_in);
+    if((out->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(out)) {
+        mp_raise_TypeError(translate("out must be a float dense array"));
+    }
+    // the number of outputs this chunk produces is known in advance, so the
+    // capacity is checked before any sample is consumed
+    size_t count = 0;
+    if(x->len * self->up > self->acc) {
+        count = (x->len * self->up - self->acc + self->down - 1) / self->down;
+    }
+    if(count > out->len) {
+        mp_raise_ValueError(translate("out array is too small"));
+    }
+
+    uint8_t *array = (uint8_t *)x->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+    mp_float_t *oarray = (mp_float_t *)out->array;
+
+    for(size_t i = 0; i < x->len; i++) {
+        self->pos = self->pos + 1 == self->nh ? 0 : self->pos + 1;
+        self->delay[self->pos] = func(array);
+        array += x->strides[ULAB_MAX_DIMS - 1];
+        // emit every kept output whose newest input sample is this one;
+        // its phase selects the taps that hit the non-zero upsampled slots
+        while(self->acc < self->up) {
+            mp_float_t *t = &self->taps[self->acc * self->nh];
+            mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+            for(size_t j = self->pos + 1; j > 0; j--) {
+                sum += *t++ * self->delay[j - 1];
+            }
+            for(size_t j = self->nh; j > self->pos + 1; j--) {
+                sum += *t++ * self->delay[j - 1];
+            }
+            *oarray++ = sum;
+            self->acc += self->down;
+        }
+        self->acc -= self->up;
+    }
+    return mp_obj_new_int(count);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_3(signal_resampler_process_obj, signal_resampler_process);
+
+static mp_obj_t signal_resampler_reset(mp_obj_t self_in) {
+    // zeroes the delay line and the phase, leaving the taps in place
+    signal_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    memset(self->delay, 0, self->nh * sizeof(mp_float_t));
+    self->pos = 0;
+    self->acc = 0;
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_resampler_reset_obj, signal_resampler_reset);
+
+static const mp_rom_map_elem_t signal_resampler_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_process), MP_ROM_PTR(&signal_resampler_process_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&signal_resampler_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(signal_resampler_locals_dict, signal_resampler_locals_dict_table);
+
+static const mp_obj_type_t signal_resampler_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_resampler,
+    .make_new = signal_resampler_make_new,
+    .locals_dict = (mp_obj_dict_t*)&signal_resampler_locals_dict,
+};
+#endif /* ULAB_SCIPY_SIGNAL_HAS_RESAMPLER */
+
 static const mp_rom_map_elem_t ulab_scipy_signal_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_signal) },
     #if ULAB_SCIPY_SIGNAL_HAS_SOSFILT & ULAB_MAX_DIMS > 1
         { MP_ROM_QSTR(MP_QSTR_sosfilt), MP_ROM_PTR(&signal_sosfilt_obj) },
     #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SOSFILTER & ULAB_MAX_DIMS > 1
+        { MP_ROM_QSTR(MP_QSTR_sosfilter), MP_ROM_PTR(&signal_sosfilter_type) },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_FIRFILTER
+        { MP_ROM_QSTR(MP_QSTR_firfilter), MP_ROM_PTR(&signal_firfilter_type) },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_RESAMPLER
+        { MP_ROM_QSTR(MP_QSTR_resampler), MP_ROM_PTR(&signal_resampler_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_ulab_scipy_signal_globals, ulab_scipy_signal_globals_table);
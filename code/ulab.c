@@ -20,7 +20,9 @@
 #include "py/objarray.h"
 
 #include "ulab.h"
+#include "ulab_tools.h"
 #include "ndarray.h"
+#include "ndarray_expression.h"
 #include "ndarray_properties.h"
 #include "numpy/create.h"
 #include "numpy/ndarray/ndarray_iter.h"
@@ -49,6 +51,22 @@ STATIC MP_DEFINE_STR_OBJ(ulab_version_obj, ULAB_VERSION_STRING);
 STATIC MP_DEFINE_STR_OBJ(ulab_sha_obj, xstr(ULAB_HASH));
 #endif
 
+#if ULAB_SCRATCH_POOL_SIZE > 0
+//| def workspace_free() -> None:
+//|     """Return the lazily grown scratch workspace to the heap. The
+//|        workspace is re-created on demand, so calling this is only
+//|        worthwhile right before a large allocation elsewhere."""
+//|     ...
+//|
+
+STATIC mp_obj_t ulab_workspace_free(void) {
+    ulab_scratch_workspace_free();
+    return mp_const_none;
+}
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(ulab_workspace_free_obj, ulab_workspace_free);
+#endif
+
 STATIC const mp_rom_map_elem_t ulab_ndarray_locals_dict_table[] = {
     #if ULAB_MAX_DIMS > 1
         #if NDARRAY_HAS_RESHAPE
@@ -139,10 +157,37 @@ const mp_obj_type_t ulab_dtype_type = {
 };
 #endif
 
+#if ULAB_HAS_EXPRESSION
+STATIC const mp_rom_map_elem_t ulab_expression_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_eval), MP_ROM_PTR(&expression_eval_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(ulab_expression_locals_dict, ulab_expression_locals_dict_table);
+
+const mp_obj_type_t ulab_expression_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_expression,
+    .print = expression_print,
+    .make_new = expression_make_new,
+    .locals_dict = (mp_obj_dict_t*)&ulab_expression_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+    .binary_op = expression_binary_op,
+    )
+};
+#endif /* ULAB_HAS_EXPRESSION */
+
 #if NDARRAY_HAS_FLATITER
+STATIC const mp_rom_map_elem_t ndarray_flatiter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_next_into), MP_ROM_PTR(&ndarray_flatiter_next_into_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(ndarray_flatiter_locals_dict, ndarray_flatiter_locals_dict_table);
+
 const mp_obj_type_t ndarray_flatiter_type = {
     { &mp_type_type },
     .name = MP_QSTR_flatiter,
+    .locals_dict = (mp_obj_dict_t*)&ndarray_flatiter_locals_dict,
     MP_TYPE_EXTENDED_FIELDS(
     .getiter = ndarray_get_flatiterator,
     )
@@ -162,6 +207,9 @@ STATIC const mp_rom_map_elem_t ulab_globals_table[] = {
         { MP_ROM_QSTR(MP_QSTR_dtype), MP_ROM_PTR(&ndarray_dtype_obj) },
         #endif /* NDARRAY_HAS_DTYPE */
     #endif /* ULAB_HAS_DTYPE_OBJECT */
+    #if ULAB_HAS_EXPRESSION
+        { MP_ROM_QSTR(MP_QSTR_expression), MP_ROM_PTR(&ulab_expression_type) },
+    #endif
         { MP_ROM_QSTR(MP_QSTR_numpy), MP_ROM_PTR(&ulab_numpy_module) },
     #if ULAB_HAS_SCIPY
         { MP_ROM_QSTR(MP_QSTR_scipy), MP_ROM_PTR(&ulab_scipy_module) },
@@ -172,6 +220,9 @@ STATIC const mp_rom_map_elem_t ulab_globals_table[] = {
     #if ULAB_HAS_UTILS_MODULE
         { MP_ROM_QSTR(MP_QSTR_utils), MP_ROM_PTR(&ulab_utils_module) },
     #endif
+    #if ULAB_SCRATCH_POOL_SIZE > 0
+        { MP_ROM_QSTR(MP_QSTR_workspace_free), MP_ROM_PTR(&ulab_workspace_free_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT (
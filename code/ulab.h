@@ -36,6 +36,15 @@
 #define ULAB_SUPPORTS_COMPLEX               (1)
 #endif
 
+// Adds the float16 storage dtype: values are stored as IEEE 754 half
+// floats, and are converted to mp_float_t at the loop boundary, i.e.,
+// wherever a kernel loads or stores its operands. Arithmetic always
+// runs in mp_float_t, so float16 halves the memory of an array at the
+// cost of a conversion in the load path
+#ifndef ULAB_SUPPORTS_FLOAT16
+#define ULAB_SUPPORTS_FLOAT16               (1)
+#endif
+
 // Determines, whether scipy is defined in ulab. The sub-modules and functions
 // of scipy have to be defined separately
 #ifndef ULAB_HAS_SCIPY
@@ -48,6 +57,28 @@
 #define ULAB_MAX_DIMS                       2
 #endif
 
+// The size (in bytes) of a static scratch pool, from which internal,
+// short-lived temporaries (reduced shape/strides arrays, matrix copies,
+// sort buffers) are handed out with simple pointer bumping, instead of
+// m_new on the GC heap. This eliminates the GC churn, and hence the
+// collection jitter caused by hot calls like fft.fft(), or sort().
+// Requests that do not fit into the pool are served from a persistent,
+// lazily grown workspace block on the GC heap, which can be released
+// explicitly with ulab.workspace_free(). Setting the constant to 0
+// removes the pool, and all temporaries are taken from the GC heap again.
+#ifndef ULAB_SCRATCH_POOL_SIZE
+#define ULAB_SCRATCH_POOL_SIZE              (2048)
+#endif
+
+// Data buffers not larger than this many bytes are carved out of the same
+// GC block as the ndarray header, instead of being allocated separately.
+// This halves the allocation count for the many small result arrays, and
+// thus reduces heap fragmentation. Setting the constant to 0 restores the
+// two-block layout for all arrays.
+#ifndef ULAB_COALLOCATION_THRESHOLD
+#define ULAB_COALLOCATION_THRESHOLD         (64)
+#endif
+
 // By setting this constant to 1, iteration over array dimensions will be implemented
 // as a function (ndarray_rewind_array), instead of writing out the loops in macros
 // This reduces firmware size at the expense of speed
@@ -55,6 +86,38 @@
 #define ULAB_HAS_FUNCTION_ITERATOR          (0)
 #endif
 
+// By setting this constant to 1, the dtype dispatch of the arithmetic binary
+// operators is routed through tables of short, adjacent row kernels that are
+// driven by a single shared outer loop, instead of expanding the full
+// dimension loops for every dtype combination. This reduces firmware size
+// considerably, and improves instruction cache locality for mixed-dtype
+// workloads, at the cost of one indirect function call per row. It is the
+// counterpart of ULAB_VECTORISE_USES_FUN_POINTER for the binary operators
+#ifndef ULAB_USES_DTYPE_DISPATCH_TABLES
+#define ULAB_USES_DTYPE_DISPATCH_TABLES     (0)
+#endif
+
+// By setting this constant to 1, sum, mean, and std of float arrays are
+// accumulated with blocked pairwise (tree) summation, instead of a single
+// running accumulator. The leaf blocks are unrolled into eight independent
+// accumulators, which breaks the serial dependency chain of the additions
+// (a considerable gain on dual-issue cores), and the tree reduction keeps
+// the rounding error at O(log n), instead of O(n), for long arrays.
+// Setting the constant to 0 restores the running Welford accumulator.
+#ifndef ULAB_NUMERICAL_USES_PAIRWISE_SUM
+#define ULAB_NUMERICAL_USES_PAIRWISE_SUM    (1)
+#endif
+
+// By setting this constant to 1, sort, and sort_inplace switch from heapsort
+// to a branch-free LSD radix sort for the integer dtypes (uint8/int8 take a
+// single counting pass, uint16/int16 two byte passes through a swap buffer).
+// The counting buffers are drawn from the scratch pool. Radix sort runs in
+// linear time, and is typically 5-10 times faster than heapsort on long
+// integer arrays. Float arrays are sorted with heapsort in either case.
+#ifndef ULAB_NUMERICAL_USES_RADIX_SORT
+#define ULAB_NUMERICAL_USES_RADIX_SORT      (1)
+#endif
+
 // If NDARRAY_IS_ITERABLE is 1, the ndarray object defines its own iterator function
 // This option saves approx. 250 bytes of flash space
 #ifndef NDARRAY_IS_ITERABLE
@@ -66,6 +129,12 @@
 #define NDARRAY_IS_SLICEABLE                (1)
 #endif
 
+// Fancy indexing, i.e., subscription with a one-dimensional integer
+// index array, can be switched off by setting this variable to 0
+#ifndef NDARRAY_HAS_FANCY_INDEXING
+#define NDARRAY_HAS_FANCY_INDEXING          (1)
+#endif
+
 // The default threshold for pretty printing. These variables can be overwritten
 // at run-time via the set_printoptions() function
 #ifndef ULAB_HAS_PRINTOPTIONS
@@ -80,6 +149,14 @@
 #define ULAB_HAS_DTYPE_OBJECT               (0)
 #endif
 
+// determines, whether the deferred-evaluation expression object is
+// available; expressions record the operation DAG of chained element-wise
+// arithmetic, and fuse the whole chain into a single output allocation
+// when eval() is called
+#ifndef ULAB_HAS_EXPRESSION
+#define ULAB_HAS_EXPRESSION                 (1)
+#endif
+
 // the ndarray binary operators
 #ifndef NDARRAY_HAS_BINARY_OPS
 #define NDARRAY_HAS_BINARY_OPS              (1)
@@ -93,6 +170,53 @@
 #define NDARRAY_BINARY_USES_FUN_POINTER     (0)
 #endif
 
+// If both operands of a binary operation are dense and C-contiguous, the
+// nested stride loops can be replaced by a single flat, unrolled loop over
+// the underlying buffers. This costs a couple of hundred bytes of flash,
+// but speeds up element-wise arithmetic considerably, in particular, on
+// targets, where the compiler can emit SIMD/DSP instructions for the
+// flat loop (e.g., on Cortex-M4/M7 with the ARMv7E-M DSP extension).
+#ifndef NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH
+#define NDARRAY_BINARY_USES_CONTIGUOUS_FAST_PATH    (1)
+#endif
+
+// Before an element-wise kernel is entered, adjacent dimensions, through
+// which all operands step contiguously, are merged, so that the kernel can
+// run fewer, longer loops; e.g., a dense (4, 1024) operation runs as a
+// single loop of 4096 elements. This removes most of the loop overhead of
+// higher-dimensional arrays, and gives the contiguous fast path above more
+// opportunities to kick in.
+#ifndef ULAB_USES_STRIDE_COALESCING
+#define ULAB_USES_STRIDE_COALESCING         (1)
+#endif
+
+// By setting this constant to 1 on a dual-core target (RP2040, ESP32-S3),
+// the heavy kernels (dot, and the long element-wise loops) split their work
+// across the second core through a minimal job handoff (ulab_parallel_run
+// in ulab_tools.c). The option must only be enabled when the second core is
+// not claimed by anything else (e.g., the _thread module); on targets
+// without a supported handoff the jobs simply run serially on the calling
+// core.
+#ifndef ULAB_HAS_DUAL_CORE
+#define ULAB_HAS_DUAL_CORE                  (0)
+#endif
+
+// An element-wise loop shorter than this many elements is not worth handing
+// to the second core; it is run serially on the calling core.
+#ifndef ULAB_PARALLEL_THRESHOLD
+#define ULAB_PARALLEL_THRESHOLD             (512)
+#endif
+
+// By setting this constant to 1, save() and savetxt() fill one of two
+// ping-pong blocks while the port's background stream writer drains the
+// other, overlapping number formatting with the (slow) medium. The port
+// must provide the ulab_io_async_submit()/ulab_io_async_poll() pair
+// declared in numpy/io/io.h; without the option the blocks are written
+// synchronously, as before.
+#ifndef ULAB_IO_HAS_ASYNC_WRITE
+#define ULAB_IO_HAS_ASYNC_WRITE             (0)
+#endif
+
 #ifndef NDARRAY_HAS_BINARY_OP_ADD
 #define NDARRAY_HAS_BINARY_OP_ADD           (1)
 #endif
@@ -247,6 +371,24 @@
 #define ULAB_VECTORISE_USES_FUN_POINTER (1)
 #endif
 
+// Setting ULAB_VECTOR_USES_FAST_MATH to 1 replaces the libm back ends of
+// sin, cos, exp, log, erf, erfc, and lgamma by short polynomial
+// approximations with an absolute error of around 1e-6. On targets without
+// a hardware libm this speeds up these functions several-fold, at the
+// expense of the last few bits of the mantissa. The special functions are
+// re-exported by scipy.special, which picks up the same kernels
+#ifndef ULAB_VECTOR_USES_FAST_MATH
+#define ULAB_VECTOR_USES_FAST_MATH      (0)
+#endif
+
+// Setting ULAB_VECTORIZE_USES_NATIVE_KERNELS to 1 lets vectorize() detect,
+// when the wrapped callable is one of the native one-argument functions of
+// the module, and run complete arrays through the C kernel, instead of
+// boxing every element into an object, and calling back into python
+#ifndef ULAB_VECTORIZE_USES_NATIVE_KERNELS
+#define ULAB_VECTORIZE_USES_NATIVE_KERNELS  (1)
+#endif
+
 // determines, whether e is defined in ulab.numpy itself
 #ifndef ULAB_NUMPY_HAS_E
 #define ULAB_NUMPY_HAS_E                (1)
@@ -308,6 +450,10 @@
 #define ULAB_NUMPY_HAS_FULL             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_HSTACK
+#define ULAB_NUMPY_HAS_HSTACK           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_LINSPACE
 #define ULAB_NUMPY_HAS_LINSPACE         (1)
 #endif
@@ -320,6 +466,10 @@
 #define ULAB_NUMPY_HAS_ONES             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_VSTACK
+#define ULAB_NUMPY_HAS_VSTACK           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ZEROS
 #define ULAB_NUMPY_HAS_ZEROS            (1)
 #endif
@@ -375,6 +525,10 @@
 #define ULAB_LINALG_HAS_EIG             (1)
 #endif
 
+#ifndef ULAB_LINALG_HAS_EIGVALS
+#define ULAB_LINALG_HAS_EIGVALS         (1)
+#endif
+
 #ifndef ULAB_LINALG_HAS_INV
 #define ULAB_LINALG_HAS_INV             (1)
 #endif
@@ -383,16 +537,60 @@
 #define ULAB_LINALG_HAS_NORM            (1)
 #endif
 
+#ifndef ULAB_LINALG_HAS_LSTSQ
+#define ULAB_LINALG_HAS_LSTSQ           (1)
+#endif
+
 #ifndef ULAB_LINALG_HAS_QR
 #define ULAB_LINALG_HAS_QR              (1)
 #endif
 
+#ifndef ULAB_LINALG_HAS_SOLVE
+#define ULAB_LINALG_HAS_SOLVE           (1)
+#endif
+
+// If set to 1, dot, linalg.inv, and linalg.solve also accept
+// three-dimensional arrays, and treat the leading axis as a batch
+// dimension, processing all matrices in a single call; 2x2, 3x3, and
+// 4x4 matrices are inverted with unrolled cofactor kernels
+#ifndef ULAB_LINALG_HAS_BATCH
+#define ULAB_LINALG_HAS_BATCH           (1)
+#endif
+
 // the FFT module; functions of the fft module still have
 // to be defined separately
 #ifndef ULAB_NUMPY_HAS_FFT_MODULE
 #define ULAB_NUMPY_HAS_FFT_MODULE       (1)
 #endif
 
+// the random module; the module keeps a single xoshiro128** generator,
+// and produces whole arrays per call, writing directly into the target
+// buffer (out= is supported), so that Monte-Carlo and dither loops
+// never box individual samples
+#ifndef ULAB_NUMPY_HAS_RANDOM_MODULE
+#define ULAB_NUMPY_HAS_RANDOM_MODULE    (1)
+#endif
+
+#ifndef ULAB_RANDOM_HAS_NORMAL
+#define ULAB_RANDOM_HAS_NORMAL          (1)
+#endif
+
+#ifndef ULAB_RANDOM_HAS_RANDINT
+#define ULAB_RANDOM_HAS_RANDINT         (1)
+#endif
+
+#ifndef ULAB_RANDOM_HAS_RANDOM
+#define ULAB_RANDOM_HAS_RANDOM          (1)
+#endif
+
+#ifndef ULAB_RANDOM_HAS_SEED
+#define ULAB_RANDOM_HAS_SEED            (1)
+#endif
+
+#ifndef ULAB_RANDOM_HAS_UNIFORM
+#define ULAB_RANDOM_HAS_UNIFORM         (1)
+#endif
+
 // By setting this constant to 1, the FFT routine will behave in a
 // numpy-compatible way, i.e., it will output a complex array
 // This setting has no effect, if ULAB_SUPPORTS_COMPLEX is 0
@@ -410,6 +608,52 @@
 #define ULAB_FFT_HAS_IFFT               (1)
 #endif
 
+// transforms of real signals: the input is packed into a half-length
+// complex sequence, so the butterflies run on half the points
+#ifndef ULAB_FFT_HAS_IRFFT
+#define ULAB_FFT_HAS_IRFFT              (1)
+#endif
+
+#ifndef ULAB_FFT_HAS_RFFT
+#define ULAB_FFT_HAS_RFFT               (1)
+#endif
+
+// if set to 1, the FFT kernels read their twiddle factors from a static
+// cache, instead of computing them with trigonometric recurrences on every
+// call; repeated transforms of one fixed length (the typical streaming
+// case) then need no trigonometric calls at all in steady state
+#ifndef ULAB_FFT_USES_TWIDDLE_CACHE
+#define ULAB_FFT_USES_TWIDDLE_CACHE     (1)
+#endif
+
+// the number of mp_float_t slots in the twiddle cache; a transform of
+// length n needs n slots (n/2 complex factors), so the default serves
+// transforms of up to 1024 points, at the price of 1024 floats of RAM;
+// longer transforms fall back to the recurrences
+#ifndef ULAB_FFT_TWIDDLE_CACHE_LENGTH
+#define ULAB_FFT_TWIDDLE_CACHE_LENGTH   (1024)
+#endif
+
+// if set to 1, fft and ifft accept arrays of arbitrary length: lengths that
+// are not powers of two are transformed with Bluestein's algorithm, which
+// re-expresses the transform as a convolution that the power-of-two kernel
+// can evaluate, so e.g. a 4410-point window no longer has to be padded to
+// 8192 points; power-of-two lengths take the direct kernel, as before
+#ifndef ULAB_FFT_USES_BLUESTEIN
+#define ULAB_FFT_USES_BLUESTEIN         (1)
+#endif
+
+// if set to 1, transforms of int16 arrays of power-of-two length run in a
+// Q15 fixed-point kernel with block-floating-point scaling: the butterflies
+// use integer arithmetic only, which is many times faster on targets
+// without an FPU, and the accumulated block shifts are folded back into
+// the float results, so the returned values are unchanged up to the Q15
+// rounding error; the setting has no effect in the numpy-compatible
+// configuration, which is complex-valued throughout
+#ifndef ULAB_FFT_USES_Q15
+#define ULAB_FFT_USES_Q15               (0)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ALL
 #define ULAB_NUMPY_HAS_ALL              (1)
 #endif
@@ -422,6 +666,10 @@
 #define ULAB_NUMPY_HAS_ARGMINMAX        (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_ARGPARTITION
+#define ULAB_NUMPY_HAS_ARGPARTITION     (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ARGSORT
 #define ULAB_NUMPY_HAS_ARGSORT          (1)
 #endif
@@ -430,6 +678,10 @@
 #define ULAB_NUMPY_HAS_ASARRAY          (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_BINCOUNT
+#define ULAB_NUMPY_HAS_BINCOUNT         (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_COMPRESS
 #define ULAB_NUMPY_HAS_COMPRESS         (1)
 #endif
@@ -438,10 +690,31 @@
 #define ULAB_NUMPY_HAS_CONVOLVE         (1)
 #endif
 
+// if set to 1, convolve switches from the direct O(n m) loop to FFT-based
+// overlap-add convolution, whenever the kernel is longer than
+// ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD taps; the input is processed in
+// power-of-two blocks through the FFT kernel, which is an order of
+// magnitude faster for long matched filters
+#ifndef ULAB_NUMPY_CONVOLVE_USES_FFT
+#define ULAB_NUMPY_CONVOLVE_USES_FFT    (1)
+#endif
+
+#ifndef ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD
+#define ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD (32)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_CROSS
 #define ULAB_NUMPY_HAS_CROSS            (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_CUMPROD
+#define ULAB_NUMPY_HAS_CUMPROD          (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_CUMSUM
+#define ULAB_NUMPY_HAS_CUMSUM           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_DELETE
 #define ULAB_NUMPY_HAS_DELETE           (1)
 #endif
@@ -454,14 +727,49 @@
 #define ULAB_NUMPY_HAS_DOT              (1)
 #endif
 
+// einsum supports a fixed set of two- and three-operand contraction
+// patterns, each compiled into a single fused loop nest that does not
+// materialise intermediate arrays
+#ifndef ULAB_NUMPY_HAS_EINSUM
+#define ULAB_NUMPY_HAS_EINSUM           (1)
+#endif
+
+// vdot computes the dot product of the flattened arrays in a single
+// fused pass, axpy is the in-place fused multiply-add y += alpha * x;
+// neither allocates temporary arrays
+#ifndef ULAB_NUMPY_HAS_VDOT
+#define ULAB_NUMPY_HAS_VDOT             (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_AXPY
+#define ULAB_NUMPY_HAS_AXPY             (1)
+#endif
+
+// If set to 1, dot processes dense two-dimensional operands with a
+// cache-blocked kernel: panels of four columns of the right matrix are
+// packed into contiguous scratch memory, and a 4-by-4 register-blocked
+// micro-kernel accumulates the products. int16 matrices are treated with
+// dual integer multiply-accumulate operations in the inner loop
+#ifndef ULAB_NUMPY_DOT_USES_BLOCKED_KERNEL
+#define ULAB_NUMPY_DOT_USES_BLOCKED_KERNEL  (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_FLIP
 #define ULAB_NUMPY_HAS_FLIP             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_HISTOGRAM
+#define ULAB_NUMPY_HAS_HISTOGRAM        (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_INTERP
 #define ULAB_NUMPY_HAS_INTERP           (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_INTERP_PLAN
+#define ULAB_NUMPY_HAS_INTERP_PLAN      (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_LOAD
 #define ULAB_NUMPY_HAS_LOAD             (1)
 #endif
@@ -470,6 +778,12 @@
 #define ULAB_NUMPY_HAS_LOADTXT          (1)
 #endif
 
+// the NpyWriter class streams row batches into a .npy file as they are
+// produced, so a long capture never has to be held in memory as a whole
+#ifndef ULAB_NUMPY_HAS_NPYWRITER
+#define ULAB_NUMPY_HAS_NPYWRITER        (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_MEAN
 #define ULAB_NUMPY_HAS_MEAN             (1)
 #endif
@@ -482,6 +796,10 @@
 #define ULAB_NUMPY_HAS_MINMAX           (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_PARTITION
+#define ULAB_NUMPY_HAS_PARTITION        (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_POLYFIT
 #define ULAB_NUMPY_HAS_POLYFIT          (1)
 #endif
@@ -502,10 +820,18 @@
 #define ULAB_NUMPY_HAS_SAVETXT          (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_SEARCHSORTED
+#define ULAB_NUMPY_HAS_SEARCHSORTED     (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_SIZE
 #define ULAB_NUMPY_HAS_SIZE             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_SLIDING_WINDOW_VIEW
+#define ULAB_NUMPY_HAS_SLIDING_WINDOW_VIEW  (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_SORT
 #define ULAB_NUMPY_HAS_SORT             (1)
 #endif
@@ -518,6 +844,12 @@
 #define ULAB_NUMPY_HAS_SUM              (1)
 #endif
 
+// topk, and argtopk, i.e., the k largest elements of the flattened array,
+// and their indices
+#ifndef ULAB_NUMPY_HAS_TOPK
+#define ULAB_NUMPY_HAS_TOPK             (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_TRACE
 #define ULAB_NUMPY_HAS_TRACE            (1)
 #endif
@@ -608,6 +940,10 @@
 #define ULAB_NUMPY_HAS_SIN              (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_SINCOS
+#define ULAB_NUMPY_HAS_SINCOS           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_SINH
 #define ULAB_NUMPY_HAS_SINH             (1)
 #endif
@@ -630,6 +966,18 @@
 
 // Complex functions. The implementations are compiled into
 // the firmware, only if ULAB_SUPPORTS_COMPLEX is set to 1
+
+// If set to 1, the complex binary operators, and abs treat operands that
+// are stored contiguously as flat float vectors, and process them with
+// unrolled loops, instead of walking the generic stride machinery
+#ifndef ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS
+#define ULAB_COMPLEX_USES_CONTIGUOUS_LOOPS  (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_CMAC
+#define ULAB_NUMPY_HAS_CMAC             (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_CONJUGATE
 #define ULAB_NUMPY_HAS_CONJUGATE        (1)
 #endif
@@ -638,6 +986,10 @@
 #define ULAB_NUMPY_HAS_IMAG             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_MAGPHASE
+#define ULAB_NUMPY_HAS_MAGPHASE         (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_REAL
 #define ULAB_NUMPY_HAS_REAL             (1)
 #endif
@@ -651,6 +1003,10 @@
 #define ULAB_SCIPY_HAS_LINALG_MODULE        (1)
 #endif
 
+#ifndef ULAB_SCIPY_LINALG_HAS_CHO_FACTOR
+#define ULAB_SCIPY_LINALG_HAS_CHO_FACTOR    (1)
+#endif
+
 #ifndef ULAB_SCIPY_LINALG_HAS_CHO_SOLVE
 #define ULAB_SCIPY_LINALG_HAS_CHO_SOLVE     (1)
 #endif
@@ -667,6 +1023,37 @@
 #define ULAB_SCIPY_SIGNAL_HAS_SOSFILT       (1)
 #endif
 
+// the streaming filter object: the SOS cascade is compiled once into a flat
+// coefficient/state block, and sample blocks are then filtered in place
+// (or into out=), with the biquad states persisting across calls
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+#define ULAB_SCIPY_SIGNAL_HAS_SOSFILTER     (1)
+#endif
+
+// if set to 1, the sosfilter object also quantises its cascade to Q14
+// integer coefficients, and filter() processes int16 arrays in place with
+// integer biquads, so blocks can be filtered without any floating-point
+// arithmetic on targets without an FPU
+#ifndef ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15
+#define ULAB_SCIPY_SIGNAL_SOSFILTER_USES_Q15 (0)
+#endif
+
+// the streaming FIR object: the taps are loaded once into a persistent
+// delay line, and process() then filters sample blocks with correct
+// history across calls, so a long signal can be filtered chunk by chunk
+// without stitching overlap regions in Python
+#ifndef ULAB_SCIPY_SIGNAL_HAS_FIRFILTER
+#define ULAB_SCIPY_SIGNAL_HAS_FIRFILTER     (1)
+#endif
+
+// the streaming polyphase resampler object: the prototype filter is split
+// into phases once, and process() then computes only the output samples
+// that are actually kept, so decimating by M costs 1/M of the direct
+// filter-then-slice approach
+#ifndef ULAB_SCIPY_SIGNAL_HAS_RESAMPLER
+#define ULAB_SCIPY_SIGNAL_HAS_RESAMPLER     (1)
+#endif
+
 #ifndef ULAB_SCIPY_HAS_OPTIMIZE_MODULE
 #define ULAB_SCIPY_HAS_OPTIMIZE_MODULE      (1)
 #endif
@@ -675,8 +1062,12 @@
 #define ULAB_SCIPY_OPTIMIZE_HAS_BISECT      (1)
 #endif
 
+#ifndef ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ
+#define ULAB_SCIPY_OPTIMIZE_HAS_BRENTQ      (1)
+#endif
+
 #ifndef ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
-#define ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT   (0) // not fully implemented
+#define ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT   (1)
 #endif
 
 #ifndef ULAB_SCIPY_OPTIMIZE_HAS_FMIN
@@ -732,6 +1123,20 @@
 #define ULAB_UTILS_HAS_SPECTROGRAM          (1)
 #endif
 
+// the ring-buffer object, which hands out zero-copy ndarray views over the
+// newest samples of a fixed (e.g., DMA) buffer
+#ifndef ULAB_UTILS_HAS_RINGBUFFER
+#define ULAB_UTILS_HAS_RINGBUFFER           (1)
+#endif
+
+// the streaming short-time Fourier transform object: frame length, hop and
+// window are configured once, sample chunks are fed incrementally, and the
+// spectrum rows are written into a caller-owned array, so no per-frame
+// allocations or Python-level slice copies are needed
+#ifndef ULAB_UTILS_HAS_STFT
+#define ULAB_UTILS_HAS_STFT                 (1)
+#endif
+
 // user-defined module; source of the module and
 // its sub-modules should be placed in code/user/
 #ifndef ULAB_HAS_USER_MODULE
@@ -45,6 +45,77 @@ mp_float_t ndarray_get_float_float(void *data) {
     return *((mp_float_t *)data);
 }
 
+#if ULAB_SUPPORTS_FLOAT16
+mp_float_t ndarray_get_float_float16(void *data) {
+    // Returns a float value from an IEEE 754 half-precision type
+    #if defined(__ARM_FP16_FORMAT_IEEE)
+    // the hardware converts in a single VCVT instruction
+    return (mp_float_t)(*(__fp16 *)data);
+    #else
+    uint16_t h = *(uint16_t *)data;
+    union { uint32_t i; float f; } u;
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1f;
+    uint32_t mantissa = h & 0x03ff;
+    if(exponent == 0x1f) { // infinities, and NaNs
+        u.i = sign | 0x7f800000 | (mantissa << 13);
+    } else if(exponent != 0) { // normal numbers
+        u.i = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if(mantissa != 0) { // subnormal numbers
+        exponent = 113;
+        while((mantissa & 0x0400) == 0) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        u.i = sign | (exponent << 23) | ((mantissa & 0x03ff) << 13);
+    } else { // signed zeros
+        u.i = sign;
+    }
+    return (mp_float_t)u.f;
+    #endif
+}
+
+void ndarray_set_float_float16(void *data, mp_float_t datum) {
+    // Writes a float value as an IEEE 754 half-precision type,
+    // rounding to nearest, ties to even
+    #if defined(__ARM_FP16_FORMAT_IEEE)
+    *(__fp16 *)data = (__fp16)datum;
+    #else
+    union { uint32_t i; float f; } u;
+    u.f = (float)datum;
+    uint16_t sign = (uint16_t)((u.i >> 16) & 0x8000);
+    int32_t exponent = (int32_t)((u.i >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = u.i & 0x007fffff;
+    uint32_t bits;
+    if(((u.i >> 23) & 0xff) == 0xff) { // infinities, and NaNs
+        bits = 0x7c00 | (mantissa == 0 ? 0 : (0x0200 | (mantissa >> 13)));
+    } else if(exponent >= 0x1f) { // overflow to infinity
+        bits = 0x7c00;
+    } else if(exponent < -10) { // underflow to zero
+        bits = 0;
+    } else if(exponent <= 0) { // subnormal numbers
+        mantissa |= 0x00800000; // the implicit bit becomes explicit
+        uint8_t shift = (uint8_t)(14 - exponent);
+        uint32_t rest = mantissa & ((1UL << shift) - 1);
+        uint32_t halfway = 1UL << (shift - 1);
+        bits = mantissa >> shift;
+        if((rest > halfway) || ((rest == halfway) && (bits & 1))) {
+            bits++;
+        }
+    } else { // normal numbers
+        uint32_t rest = mantissa & 0x1fff;
+        bits = ((uint32_t)exponent << 10) | (mantissa >> 13);
+        // a carry of the rounding can overflow into the exponent, and
+        // ultimately to infinity; that is the correct result
+        if((rest > 0x1000) || ((rest == 0x1000) && (bits & 1))) {
+            bits++;
+        }
+    }
+    *(uint16_t *)data = sign | (uint16_t)bits;
+    #endif
+}
+#endif /* ULAB_SUPPORTS_FLOAT16 */
+
 // returns a single function pointer, depending on the dtype
 void *ndarray_get_float_function(uint8_t dtype) {
     if(dtype == NDARRAY_UINT8) {
@@ -55,7 +126,13 @@ void *ndarray_get_float_function(uint8_t dtype) {
         return ndarray_get_float_uint16;
     } else if(dtype == NDARRAY_INT16) {
         return ndarray_get_float_int16;
-    } else {
+    }
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_get_float_float16;
+    }
+    #endif
+    else {
         return ndarray_get_float_float;
     }
 }
@@ -70,7 +147,13 @@ mp_float_t ndarray_get_float_index(void *data, uint8_t dtype, size_t index) {
         return (mp_float_t)((uint16_t *)data)[index];
     } else if(dtype == NDARRAY_INT16) {
         return (mp_float_t)((int16_t *)data)[index];
-    } else {
+    }
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_get_float_float16((uint16_t *)data + index);
+    }
+    #endif
+    else {
         return (mp_float_t)((mp_float_t *)data)[index];
     }
 }
@@ -86,7 +169,13 @@ mp_float_t ndarray_get_float_value(void *data, uint8_t dtype) {
         return (mp_float_t)(*(uint16_t *)data);
     } else if(dtype == NDARRAY_INT16) {
         return (mp_float_t)(*(int16_t *)data);
-    } else {
+    }
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_get_float_float16(data);
+    }
+    #endif
+    else {
         return *((mp_float_t *)data);
     }
 }
@@ -156,7 +245,13 @@ void *ndarray_set_float_function(uint8_t dtype) {
         return ndarray_set_float_uint16;
     } else if(dtype == NDARRAY_INT16) {
         return ndarray_set_float_int16;
-    } else {
+    }
+    #if ULAB_SUPPORTS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_set_float_float16;
+    }
+    #endif
+    else {
         return ndarray_set_float_float;
     }
 }
@@ -240,12 +335,46 @@ ndarray_obj_t *tools_object_is_square(mp_obj_t obj) {
 }
 #endif
 
+// The following function returns the ndarray behind the out keyword argument
+// of a function call, after checking that its dtype, and shape match those of
+// the operation's result, and that the array can be filled linearly. If out
+// is None, a new dense array of the requested shape is allocated, as before.
+ndarray_obj_t *tools_validate_out(mp_obj_t out, uint8_t ndim, size_t *shape, uint8_t dtype) {
+    if(out == mp_const_none) {
+        return ndarray_new_dense_ndarray(ndim, shape, dtype);
+    }
+    if(!mp_obj_is_type(out, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("out must be an ndarray"));
+    }
+    ndarray_obj_t *results = MP_OBJ_TO_PTR(out);
+    if(results->dtype != dtype) {
+        mp_raise_ValueError(translate("dtype of out is incorrect"));
+    }
+    if(!ndarray_is_dense(results)) {
+        mp_raise_ValueError(translate("out must be a dense array"));
+    }
+    if(results->ndim != ndim) {
+        mp_raise_ValueError(translate("shape of out is incorrect"));
+    }
+    for(uint8_t i = ULAB_MAX_DIMS - ndim; i < ULAB_MAX_DIMS; i++) {
+        if(results->shape[i] != shape[i]) {
+            mp_raise_ValueError(translate("shape of out is incorrect"));
+        }
+    }
+    return results;
+}
+
 uint8_t ulab_binary_get_size(uint8_t dtype) {
     #if ULAB_SUPPORTS_COMPLEX
     if(dtype == NDARRAY_COMPLEX) {
         return 2 * (uint8_t)sizeof(mp_float_t);
     }
     #endif
+    #if ULAB_SUPPORTS_FLOAT16
+    if(dtype == NDARRAY_FLOAT16) {
+        return 2;
+    }
+    #endif
     return dtype == NDARRAY_BOOL ? 1 : mp_binary_get_size('@', dtype, NULL);
 }
 
@@ -273,4 +402,206 @@ bool ulab_tools_mp_obj_is_scalar(mp_obj_t obj) {
         return false;
     }
     #endif
-}
\ No newline at end of file
+}
+#if ULAB_SCRATCH_POOL_SIZE > 0
+// The scratch pool is a statically allocated arena for short-lived internal
+// temporaries. Allocation is simple pointer bumping, while de-allocation is
+// the bulk winding back of the bump pointer to a previously saved position,
+// so a routine brackets its temporaries as
+//
+//      SCRATCH_ACQUIRE();
+//      ... SCRATCH_NEW(type, num) ...
+//      SCRATCH_RELEASE();
+//
+// The brackets nest, so a routine drawing from the pool can call another
+// one that does the same. Requests that do not fit into what is left of
+// the pool are served from a persistently owned workspace block on the GC
+// heap, which is grown lazily to the high-water mark of such requests, and
+// re-used by subsequent calls, so a loop hammering, say, linalg.eig() with
+// large matrices allocates once instead of on every call. The workspace
+// can be returned to the heap with ulab.workspace_free(). On MicroPython
+// versions without MP_REGISTER_ROOT_POINTER() there is no safe place to
+// anchor the block, and oversized requests simply go to the GC heap, and
+// their reclamation is left to the collector, as before.
+
+static uint8_t ulab_scratch_pool[ULAB_SCRATCH_POOL_SIZE] __attribute__((aligned(sizeof(mp_float_t))));
+static size_t ulab_scratch_head = 0;
+
+#if defined(MP_REGISTER_ROOT_POINTER)
+// the workspace block itself lives in the VM state, so that the GC treats it as a root
+MP_REGISTER_ROOT_POINTER(void *ulab_scratch_workspace);
+
+#define ULAB_SCRATCH_MAX_DEPTH      (8)
+
+static size_t ulab_workspace_size = 0;
+static size_t ulab_workspace_head = 0;
+static size_t ulab_workspace_marks[ULAB_SCRATCH_MAX_DEPTH];
+static uint8_t ulab_workspace_depth = 0;
+static uint8_t ulab_workspace_overdepth = 0;
+#endif
+
+size_t ulab_scratch_acquire(void) {
+    #if defined(MP_REGISTER_ROOT_POINTER)
+    // the workspace keeps its own mark stack, so that the macro interface
+    // can stay a single size_t; brackets nested deeper than the stack leak
+    // their workspace portion until the outer brackets close, nothing worse
+    if(ulab_workspace_depth < ULAB_SCRATCH_MAX_DEPTH) {
+        ulab_workspace_marks[ulab_workspace_depth++] = ulab_workspace_head;
+    } else {
+        ulab_workspace_overdepth++;
+    }
+    #endif
+    return ulab_scratch_head;
+}
+
+void *ulab_scratch_alloc(size_t size) {
+    // round the size up, so that subsequent blocks stay aligned for the widest type stored
+    size = (size + sizeof(mp_float_t) - 1) & ~(sizeof(mp_float_t) - 1);
+    if(size <= ULAB_SCRATCH_POOL_SIZE - ulab_scratch_head) {
+        uint8_t *ptr = ulab_scratch_pool + ulab_scratch_head;
+        ulab_scratch_head += size;
+        memset(ptr, 0, size);
+        return ptr;
+    }
+    #if defined(MP_REGISTER_ROOT_POINTER)
+    if((ulab_workspace_head == 0) && (size > ulab_workspace_size)) {
+        // the workspace is empty, so it can be re-allocated at the larger size
+        if(MP_STATE_VM(ulab_scratch_workspace) != NULL) {
+            m_del(uint8_t, MP_STATE_VM(ulab_scratch_workspace), ulab_workspace_size);
+        }
+        MP_STATE_VM(ulab_scratch_workspace) = m_new(uint8_t, size);
+        ulab_workspace_size = size;
+    }
+    if(size <= ulab_workspace_size - ulab_workspace_head) {
+        uint8_t *ptr = (uint8_t *)MP_STATE_VM(ulab_scratch_workspace) + ulab_workspace_head;
+        ulab_workspace_head += size;
+        memset(ptr, 0, size);
+        return ptr;
+    }
+    #endif
+    return m_new0(uint8_t, size);
+}
+
+void ulab_scratch_release(size_t mark) {
+    ulab_scratch_head = mark;
+    #if defined(MP_REGISTER_ROOT_POINTER)
+    if(ulab_workspace_overdepth > 0) {
+        ulab_workspace_overdepth--;
+    } else if(ulab_workspace_depth > 0) {
+        ulab_workspace_head = ulab_workspace_marks[--ulab_workspace_depth];
+    }
+    #endif
+}
+
+void ulab_scratch_workspace_free(void) {
+    #if defined(MP_REGISTER_ROOT_POINTER)
+    if((ulab_workspace_head == 0) && (MP_STATE_VM(ulab_scratch_workspace) != NULL)) {
+        m_del(uint8_t, MP_STATE_VM(ulab_scratch_workspace), ulab_workspace_size);
+        MP_STATE_VM(ulab_scratch_workspace) = NULL;
+        ulab_workspace_size = 0;
+    }
+    #endif
+}
+#endif /* ULAB_SCRATCH_POOL_SIZE > 0 */
+
+#if ULAB_HAS_DUAL_CORE
+// The parallel layer hands one half of a loop range to the second core,
+// runs the other half on the calling core, and spin-waits for the handed-off
+// half to complete. The job lives on the caller's stack for the duration of
+// the wait, so no queue memory is needed, and the second core never touches
+// the GC heap, or the scratch pool, whose bump pointer is not thread safe;
+// workers that need per-core scratch receive it through the job context.
+
+typedef struct _ulab_parallel_job_t {
+    ulab_parallel_fn_t fn;
+    void *context;
+    size_t start;
+    size_t end;
+    volatile bool done;
+} ulab_parallel_job_t;
+
+#if defined(PICO_RP2040) || defined(PICO_RP2350)
+#include "pico/multicore.h"
+
+static bool ulab_parallel_started = false;
+
+static void ulab_parallel_core1_entry(void) {
+    for(;;) {
+        ulab_parallel_job_t *job = (ulab_parallel_job_t *)multicore_fifo_pop_blocking();
+        job->fn(job->context, job->start, job->end, 1);
+        job->done = true;
+    }
+}
+
+void ulab_parallel_run(ulab_parallel_fn_t fn, void *context, size_t n, size_t threshold) {
+    // a range shorter than the caller's threshold is not worth the handoff
+    if(n < threshold) {
+        fn(context, 0, n, 0);
+        return;
+    }
+    if(!ulab_parallel_started) {
+        multicore_launch_core1(ulab_parallel_core1_entry);
+        ulab_parallel_started = true;
+    }
+    ulab_parallel_job_t job = { fn, context, n - n / 2, n, false };
+    // the FIFO push/pop pair orders the job fields before the worker reads them
+    multicore_fifo_push_blocking((uint32_t)&job);
+    fn(context, 0, n - n / 2, 0);
+    while(!job.done) {
+        // spin; the wait is on the order of the caller's own half of the work
+    }
+}
+
+#elif defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+static TaskHandle_t ulab_parallel_task = NULL;
+static SemaphoreHandle_t ulab_parallel_go = NULL;
+static SemaphoreHandle_t ulab_parallel_ready = NULL;
+static ulab_parallel_job_t *volatile ulab_parallel_pending = NULL;
+
+static void ulab_parallel_worker(void *arg) {
+    (void)arg;
+    for(;;) {
+        xSemaphoreTake(ulab_parallel_go, portMAX_DELAY);
+        ulab_parallel_job_t *job = ulab_parallel_pending;
+        job->fn(job->context, job->start, job->end, 1);
+        job->done = true;
+        xSemaphoreGive(ulab_parallel_ready);
+    }
+}
+
+void ulab_parallel_run(ulab_parallel_fn_t fn, void *context, size_t n, size_t threshold) {
+    if(n < threshold) {
+        fn(context, 0, n, 0);
+        return;
+    }
+    if(ulab_parallel_task == NULL) {
+        ulab_parallel_go = xSemaphoreCreateBinary();
+        ulab_parallel_ready = xSemaphoreCreateBinary();
+        // pin the worker to whichever core the interpreter is not running on
+        if((ulab_parallel_go == NULL) || (ulab_parallel_ready == NULL) ||
+            (xTaskCreatePinnedToCore(ulab_parallel_worker, "ulab", 2048, NULL,
+            uxTaskPriorityGet(NULL), &ulab_parallel_task, 1 - xPortGetCoreID()) != pdPASS)) {
+            ulab_parallel_task = NULL;
+            fn(context, 0, n, 0);
+            return;
+        }
+    }
+    ulab_parallel_job_t job = { fn, context, n - n / 2, n, false };
+    ulab_parallel_pending = &job;
+    xSemaphoreGive(ulab_parallel_go);
+    fn(context, 0, n - n / 2, 0);
+    xSemaphoreTake(ulab_parallel_ready, portMAX_DELAY);
+}
+
+#else
+// no supported handoff on this port: run everything on the calling core
+void ulab_parallel_run(ulab_parallel_fn_t fn, void *context, size_t n, size_t threshold) {
+    (void)threshold;
+    fn(context, 0, n, 0);
+}
+#endif
+#endif /* ULAB_HAS_DUAL_CORE */
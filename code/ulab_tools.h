@@ -27,6 +27,10 @@ mp_float_t ndarray_get_float_int8(void *);
 mp_float_t ndarray_get_float_uint16(void *);
 mp_float_t ndarray_get_float_int16(void *);
 mp_float_t ndarray_get_float_float(void *);
+#if ULAB_SUPPORTS_FLOAT16
+mp_float_t ndarray_get_float_float16(void *);
+void ndarray_set_float_float16(void *, mp_float_t );
+#endif
 void *ndarray_get_float_function(uint8_t );
 
 uint8_t ndarray_upcast_dtype(uint8_t , uint8_t );
@@ -38,9 +42,39 @@ ndarray_obj_t *tools_object_is_square(mp_obj_t );
 
 uint8_t ulab_binary_get_size(uint8_t );
 
+ndarray_obj_t *tools_validate_out(mp_obj_t , uint8_t , size_t *, uint8_t );
+
 #if ULAB_SUPPORTS_COMPLEX
 void ulab_rescale_float_strides(int32_t *);
 #endif
 
 bool ulab_tools_mp_obj_is_scalar(mp_obj_t );
+
+#if ULAB_SCRATCH_POOL_SIZE > 0
+size_t ulab_scratch_acquire(void);
+void *ulab_scratch_alloc(size_t );
+void ulab_scratch_release(size_t );
+void ulab_scratch_workspace_free(void);
+
+// Blocks allocated between SCRATCH_ACQUIRE and SCRATCH_RELEASE are handed
+// back in bulk; the returned memory is zeroed, as with m_new0
+#define SCRATCH_ACQUIRE()       size_t _scratch_mark = ulab_scratch_acquire()
+#define SCRATCH_NEW(type, num)  ((type *)ulab_scratch_alloc(sizeof(type) * (num)))
+#define SCRATCH_RELEASE()       ulab_scratch_release(_scratch_mark)
+#else
+#define SCRATCH_ACQUIRE()
+#define SCRATCH_NEW(type, num)  m_new0(type, num)
+#define SCRATCH_RELEASE()
+#endif /* ULAB_SCRATCH_POOL_SIZE > 0 */
+
+// A parallel job worker processes the half-open index range [start, end) of
+// a larger loop; slot is 0 on the calling core, and 1 on the second core,
+// so that a worker can index per-core scratch buffers
+typedef void (*ulab_parallel_fn_t)(void *, size_t, size_t, uint8_t);
+
+#if ULAB_HAS_DUAL_CORE
+void ulab_parallel_run(ulab_parallel_fn_t , void *, size_t , size_t );
+#else
+#define ulab_parallel_run(fn, context, n, threshold)   (fn)((context), 0, (n), 0)
+#endif /* ULAB_HAS_DUAL_CORE */
 #endif
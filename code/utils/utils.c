@@ -16,6 +16,9 @@
 #include "py/misc.h"
 #include "utils.h"
 
+#include "../ulab_tools.h"
+
+#include "../numpy/carray/carray_tools.h"
 #include "../numpy/fft/fft_tools.h"
 
 #if ULAB_HAS_UTILS_MODULE
@@ -223,6 +226,329 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(utils_spectrogram_obj, 1, 2, utils_spectrogr
 
 #endif /* ULAB_UTILS_HAS_SPECTROGRAM */
 
+#if ULAB_UTILS_HAS_RINGBUFFER
+//| import ulab.numpy
+//|
+//| class ringbuffer:
+//|     """A fixed, pre-registered sample buffer (e.g., the target of a circular
+//|     DMA transfer), from which ndarray views over the newest samples can be
+//|     taken without copying. The producer reports new samples with advance(),
+//|     and view(n) returns the newest n samples: a zero-copy view, whenever the
+//|     window does not straddle the wrap point, otherwise a copy of just the
+//|     n requested samples."""
+//|     ...
+//|
+
+typedef struct _utils_ringbuffer_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t buffer; // keeps the underlying buffer object alive
+    uint8_t *data;
+    uint8_t dtype;
+    uint8_t itemsize;
+    size_t capacity; // the full buffer length, in items
+    size_t head; // position of the next item to be written
+    size_t count; // number of valid items; saturates at capacity
+} utils_ringbuffer_obj_t;
+
+static const mp_obj_type_t utils_ringbuffer_type;
+
+static mp_obj_t utils_ringbuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 1, 2, true);
+    mp_map_t kw_args;
+    mp_map_init_fixed_table(&kw_args, n_kw, all_args + n_args);
+
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(NDARRAY_INT16) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, all_args, &kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t _dtype;
+    #if ULAB_HAS_DTYPE_OBJECT
+    if(mp_obj_is_type(args[1].u_obj, &ulab_dtype_type)) {
+        dtype_obj_t *dtype = MP_OBJ_TO_PTR(args[1].u_obj);
+        _dtype = dtype->dtype;
+    } else { // this must be an integer defined as a class constant (ulab.numpy.uint8 etc.)
+        _dtype = mp_obj_get_int(args[1].u_obj);
+    }
+    #else
+    _dtype = mp_obj_get_int(args[1].u_obj);
+    #endif
+    uint8_t sz = ulab_binary_get_size(_dtype);
+
+    mp_buffer_info_t bufinfo;
+    if(!mp_get_buffer(args[0].u_obj, &bufinfo, MP_BUFFER_READ)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    size_t capacity = bufinfo.len / sz;
+    if((capacity * sz) != bufinfo.len) {
+        mp_raise_ValueError(translate("buffer size must be a multiple of element size"));
+    }
+    if(capacity == 0) {
+        mp_raise_ValueError(translate("buffer is smaller than requested size"));
+    }
+
+    utils_ringbuffer_obj_t *self = m_new_obj(utils_ringbuffer_obj_t);
+    self->base.type = &utils_ringbuffer_type;
+    self->buffer = args[0].u_obj;
+    self->data = (uint8_t *)bufinfo.buf;
+    self->dtype = _dtype == NDARRAY_BOOL ? NDARRAY_UINT8 : _dtype;
+    self->itemsize = sz;
+    self->capacity = capacity;
+    self->head = 0;
+    self->count = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t utils_ringbuffer_advance(mp_obj_t self_in, mp_obj_t n_in) {
+    // reports that the producer has written n new items at the head
+    utils_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t n = mp_obj_get_int(n_in);
+    if(n < 0) {
+        mp_raise_ValueError(translate("index out of range"));
+    }
+    self->head = (self->head + (size_t)n) % self->capacity;
+    self->count += (size_t)n;
+    if(self->count > self->capacity) {
+        self->count = self->capacity;
+    }
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(utils_ringbuffer_advance_obj, utils_ringbuffer_advance);
+
+static mp_obj_t utils_ringbuffer_view(size_t n_args, const mp_obj_t *args) {
+    // returns the newest n samples as an ndarray
+    utils_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t n = self->count;
+    if(n_args == 2) {
+        mp_int_t _n = mp_obj_get_int(args[1]);
+        if((_n < 0) || ((size_t)_n > self->count)) {
+            mp_raise_ValueError(translate("buffer is smaller than requested size"));
+        }
+        n = (size_t)_n;
+    }
+    if(n == 0) {
+        return MP_OBJ_FROM_PTR(ndarray_new_linear_array(0, self->dtype));
+    }
+    size_t start = (self->head + self->capacity - n) % self->capacity;
+    if(start + n <= self->capacity) {
+        // the window does not wrap: return a zero-copy view into the buffer
+        ndarray_obj_t *ndarray = m_new_obj(ndarray_obj_t);
+        ndarray->base.type = &ulab_ndarray_type;
+        ndarray->dtype = self->dtype;
+        ndarray->boolean = NDARRAY_NUMERIC;
+        ndarray->ndim = 1;
+        ndarray->len = n;
+        ndarray->itemsize = self->itemsize;
+        ndarray->shape[ULAB_MAX_DIMS - 1] = n;
+        ndarray->strides[ULAB_MAX_DIMS - 1] = self->itemsize;
+        ndarray->array = self->data + start * self->itemsize;
+        // anchor the ring buffer, which in turn holds the underlying buffer object
+        ndarray->origin = self;
+        return MP_OBJ_FROM_PTR(ndarray);
+    }
+    // the window straddles the wrap point: stitch the two segments together,
+    // copying only the n requested items
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(n, self->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    size_t tail = self->capacity - start; // number of items before the wrap point
+    memcpy(array, self->data + start * self->itemsize, tail * self->itemsize);
+    memcpy(array + tail * self->itemsize, self->data, (n - tail) * self->itemsize);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(utils_ringbuffer_view_obj, 1, 2, utils_ringbuffer_view);
+
+static const mp_rom_map_elem_t utils_ringbuffer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_advance), MP_ROM_PTR(&utils_ringbuffer_advance_obj) },
+    { MP_ROM_QSTR(MP_QSTR_view), MP_ROM_PTR(&utils_ringbuffer_view_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(utils_ringbuffer_locals_dict, utils_ringbuffer_locals_dict_table);
+
+static const mp_obj_type_t utils_ringbuffer_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_ringbuffer,
+    .make_new = utils_ringbuffer_make_new,
+    .locals_dict = (mp_obj_dict_t*)&utils_ringbuffer_locals_dict,
+};
+#endif /* ULAB_UTILS_HAS_RINGBUFFER */
+
+#if ULAB_UTILS_HAS_STFT
+//| import ulab.numpy
+//|
+//| class stft:
+//|     """A streaming short-time Fourier transform. Frame length, hop and an
+//|     optional precomputed window (e.g., Hann) are configured once; feed()
+//|     then consumes sample chunks of arbitrary size, keeps the overlapping
+//|     tail of the signal in a persistent buffer, and writes the magnitude
+//|     spectrum of each completed frame (the length // 2 + 1 unique bins,
+//|     as with spectrogram) into consecutive rows of a caller-owned float
+//|     array, returning the number of rows produced."""
+//|     ...
+//|
+
+typedef struct _utils_stft_obj_t {
+    mp_obj_base_t base;
+    size_t length; // frame length; a power of 2
+    size_t hop; // number of samples between consecutive frames
+    size_t bins; // length / 2 + 1, the width of an output row
+    size_t filled; // number of valid samples in the frame buffer
+    mp_float_t *window; // NULL, if no window was given
+    mp_float_t *frame; // the persistent overlap buffer of length samples
+} utils_stft_obj_t;
+
+static const mp_obj_type_t utils_stft_type;
+
+static mp_obj_t utils_stft_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    (void) type;
+    mp_arg_check_num(n_args, n_kw, 2, 3, true);
+    mp_map_t kw_args;
+    mp_map_init_fixed_table(&kw_args, n_kw, all_args + n_args);
+
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, all_args, &kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t length = args[0].u_int;
+    mp_int_t hop = args[1].u_int;
+    if((length < 2) || ((length & (length - 1)) != 0)) {
+        mp_raise_ValueError(translate("length must be a power of 2"));
+    }
+    if((hop < 1) || (hop > length)) {
+        mp_raise_ValueError(translate("hop must be positive, and not larger than length"));
+    }
+
+    utils_stft_obj_t *self = m_new_obj(utils_stft_obj_t);
+    self->base.type = &utils_stft_type;
+    self->length = (size_t)length;
+    self->hop = (size_t)hop;
+    self->bins = (size_t)length / 2 + 1;
+    self->filled = 0;
+    self->frame = m_new(mp_float_t, (size_t)length);
+    self->window = NULL;
+
+    if(args[2].u_obj != mp_const_none) {
+        if(!mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
+            mp_raise_TypeError(translate("wrong input type"));
+        }
+        ndarray_obj_t *window = MP_OBJ_TO_PTR(args[2].u_obj);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(window->dtype)
+        if(window->len != (size_t)length) {
+            mp_raise_ValueError(translate("window length must be equal to length"));
+        }
+        // the window is copied into a persistent float buffer, so that
+        // strided inputs, or later changes to the ndarray do not matter
+        self->window = m_new(mp_float_t, (size_t)length);
+        uint8_t *warray = (uint8_t *)window->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(window->dtype);
+        for(size_t i = 0; i < (size_t)length; i++) {
+            self->window[i] = func(warray);
+            warray += window->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t utils_stft_feed(mp_obj_t self_in, mp_obj_t samples_in, mp_obj_t out_in) {
+    // consumes a chunk of samples, and writes the spectrum of each completed
+    // frame into consecutive rows of out, starting at the first row
+    utils_stft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if(!mp_obj_is_type(samples_in, &ulab_ndarray_type) || !mp_obj_is_type(out_in, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("wrong input type"));
+    }
+    ndarray_obj_t *samples = MP_OBJ_TO_PTR(samples_in);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(samples->dtype)
+    #if ULAB_MAX_DIMS > 1
+    if(samples->ndim != 1) {
+        mp_raise_TypeError(translate("input must be a 1D array"));
+    }
+    #endif
+    ndarray_obj_t *out = MP_OBJ_TO_PTR(out_in);
+    if((out->dtype != NDARRAY_FLOAT) || !ndarray_is_dense(out)) {
+        mp_raise_TypeError(translate("out must be a float dense array"));
+    }
+    // the rows produced by this chunk must fit into out; this is checked up
+    // front, so that a failing feed does not consume any samples
+    size_t rows = 0;
+    if(self->filled + samples->len >= self->length) {
+        rows = (self->filled + samples->len - self->length) / self->hop + 1;
+    }
+    if(rows * self->bins > out->len) {
+        mp_raise_ValueError(translate("out array is too small"));
+    }
+
+    uint8_t *array = (uint8_t *)samples->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(samples->dtype);
+    mp_float_t *rarray = (mp_float_t *)out->array;
+
+    SCRATCH_ACQUIRE();
+    #if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+    mp_float_t *data = SCRATCH_NEW(mp_float_t, 2 * self->length);
+    #else
+    mp_float_t *re = SCRATCH_NEW(mp_float_t, self->length);
+    mp_float_t *im = SCRATCH_NEW(mp_float_t, self->length);
+    #endif
+
+    for(size_t i = 0; i < samples->len; i++) {
+        self->frame[self->filled++] = func(array);
+        array += samples->strides[ULAB_MAX_DIMS - 1];
+        if(self->filled < self->length) {
+            continue;
+        }
+        // a frame is complete: window it, transform it, and emit a row
+        #if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+        for(size_t k = 0; k < self->length; k++) {
+            data[2*k] = self->window == NULL ? self->frame[k] : self->frame[k] * self->window[k];
+            data[2*k+1] = MICROPY_FLOAT_CONST(0.0);
+        }
+        fft_kernel_complex(data, self->length, 1);
+        for(size_t k = 0; k < self->bins; k++) {
+            *rarray++ = MICROPY_FLOAT_C_FUN(sqrt)(data[2*k] * data[2*k] + data[2*k+1] * data[2*k+1]);
+        }
+        #else
+        for(size_t k = 0; k < self->length; k++) {
+            re[k] = self->window == NULL ? self->frame[k] : self->frame[k] * self->window[k];
+        }
+        memset(im, 0, self->length * sizeof(mp_float_t));
+        fft_kernel(re, im, self->length, 1);
+        for(size_t k = 0; k < self->bins; k++) {
+            *rarray++ = MICROPY_FLOAT_C_FUN(sqrt)(re[k] * re[k] + im[k] * im[k]);
+        }
+        #endif
+        // slide the frame buffer by the hop, keeping the overlapping tail
+        memmove(self->frame, self->frame + self->hop, (self->length - self->hop) * sizeof(mp_float_t));
+        self->filled -= self->hop;
+    }
+    SCRATCH_RELEASE();
+    return mp_obj_new_int(rows);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_3(utils_stft_feed_obj, utils_stft_feed);
+
+static const mp_rom_map_elem_t utils_stft_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&utils_stft_feed_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(utils_stft_locals_dict, utils_stft_locals_dict_table);
+
+static const mp_obj_type_t utils_stft_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_stft,
+    .make_new = utils_stft_make_new,
+    .locals_dict = (mp_obj_dict_t*)&utils_stft_locals_dict,
+};
+#endif /* ULAB_UTILS_HAS_STFT */
+
 
 static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_utils) },
@@ -241,6 +567,12 @@ static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
     #if ULAB_UTILS_HAS_SPECTROGRAM
         { MP_ROM_QSTR(MP_QSTR_spectrogram), MP_ROM_PTR(&utils_spectrogram_obj) },
     #endif
+    #if ULAB_UTILS_HAS_RINGBUFFER
+        { MP_ROM_QSTR(MP_QSTR_ringbuffer), MP_ROM_PTR(&utils_ringbuffer_type) },
+    #endif
+    #if ULAB_UTILS_HAS_STFT
+        { MP_ROM_QSTR(MP_QSTR_stft), MP_ROM_PTR(&utils_stft_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_ulab_utils_globals, ulab_utils_globals_table);
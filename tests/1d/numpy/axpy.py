@@ -0,0 +1,19 @@
+from ulab import numpy as np
+
+y = np.array([1, 2, 3, 4], dtype=np.float)
+x = np.array([10, 20, 30, 40], dtype=np.float)
+z = np.axpy(0.5, x, y)
+print(y)
+
+# the accumulator itself is returned
+print(z is y)
+
+# integer arguments are upcast on the fly
+np.axpy(2.0, np.array([1, 1, 1, 1], dtype=np.int8), y)
+print(y)
+
+# the accumulator must be a float array, for it is updated in place
+try:
+    np.axpy(1.0, x, np.array([1, 2, 3, 4], dtype=np.int16))
+except TypeError as e:
+    print(e)
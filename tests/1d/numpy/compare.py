@@ -11,3 +11,12 @@ print(np.clip(a, 3, 7))
 
 b = 3 * np.ones(len(a), dtype=np.float)
 print(np.clip(a, b, 7))
+
+# out= clips in place, without an intermediate array
+c = np.array(range(9), dtype=np.uint8)
+np.clip(c, 3, 7, out=c)
+print(c)
+
+d = np.array(range(9), dtype=np.float)
+np.clip(d, 2.5, 6.5, out=d)
+print(d)
@@ -13,3 +13,19 @@ cmp_result = []
 for p,q in zip(list(result), list(ref_result)):
     cmp_result.append(math.isclose(p, q, rel_tol=1e-06, abs_tol=1e-06))
 print(cmp_result)
+
+# a kernel of more than 32 taps takes the FFT-based overlap-add path;
+# compare it against the convolution sum computed directly
+x = np.linspace(-1, 1, num=48)
+c = np.zeros(33)
+for i in range(33):
+    c[i] = (i % 5) - 2
+result = np.convolve(x, c)
+ok = True
+for k in range(48 + 33 - 1):
+    ref = 0.0
+    for j in range(48):
+        if 0 <= k - j < 33:
+            ref += x[j] * c[k - j]
+    ok = ok and math.isclose(result[k], ref, rel_tol=1e-06, abs_tol=1e-06)
+print(ok)
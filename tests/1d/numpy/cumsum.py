@@ -0,0 +1,16 @@
+from ulab import numpy as np
+
+a = np.array([1, 2, 3, 4], dtype=np.uint8)
+print(np.cumsum(a))
+print(np.cumprod(a))
+print(a)
+
+b = np.array([1.0, 2.0, 4.0], dtype=np.float)
+print(np.cumsum(b))
+print(np.cumprod(b))
+
+# integrate in place
+np.cumsum(b, out=b)
+print(b)
+
+print(np.cumsum([1, 2, 3]))
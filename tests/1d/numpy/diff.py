@@ -0,0 +1,14 @@
+from ulab import numpy as np
+
+a = np.array([0, 1, 4, 9, 16, 25], dtype=np.int16)
+print(np.diff(a))
+print(np.diff(a, n=2))
+print(np.diff(a, n=3))
+
+# higher orders fall back to the generic stencil loop
+print(np.diff(a, n=4))
+
+b = np.array([1.0, 2.0, 4.0, 8.0], dtype=np.float)
+print(np.diff(b))
+print(np.diff(b, n=2))
+print(np.diff(b, n=3))
@@ -0,0 +1,15 @@
+import ulab
+from ulab import numpy as np
+
+a = np.array([1, 2, 3, 4], dtype=np.float)
+b = np.array([4, 3, 2, 1], dtype=np.float)
+c = np.array([2, 2, 2, 2], dtype=np.float)
+
+e = ulab.expression(a)
+
+print(((e - b) * c).eval())
+print((e + 1).eval())
+print((1 + e).eval())
+print((e / 2).eval())
+print((2 * e).eval())
+print((b - e).eval())
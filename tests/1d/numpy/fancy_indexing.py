@@ -0,0 +1,17 @@
+from ulab import numpy as np
+
+a = np.array([10, 20, 30, 40, 50], dtype=np.float)
+print(a[np.array([4, 0, 2], dtype=np.uint8)])
+print(a[np.array([-1, -5], dtype=np.int8)])
+
+b = np.array(range(6), dtype=np.int16)
+b[np.array([1, 3], dtype=np.uint8)] = np.array([100, 200], dtype=np.int16)
+print(b)
+
+b[np.array([0, 5], dtype=np.uint8)] = 7
+print(b)
+
+try:
+    a[np.array([5], dtype=np.uint8)]
+except IndexError as e:
+    print(e)
@@ -0,0 +1,26 @@
+import math
+from ulab import numpy as np
+
+# lengths that are not powers of two take the Bluestein path
+x = np.linspace(-np.pi, np.pi, num=12)
+y = np.sin(x)
+
+a, b = np.fft.fft(y)
+# compare against the direct evaluation of the transform sum
+cmp_result = []
+for k in range(len(y)):
+    re = 0.0
+    im = 0.0
+    for j in range(len(y)):
+        re += y[j] * math.cos(-2 * math.pi * j * k / len(y))
+        im += y[j] * math.sin(-2 * math.pi * j * k / len(y))
+    cmp_result.append(math.isclose(a[k], re, rel_tol=1e-06, abs_tol=1e-06) and
+                      math.isclose(b[k], im, rel_tol=1e-06, abs_tol=1e-06))
+print(cmp_result)
+
+# the inverse must recover the signal at the natural length
+c, d = np.fft.ifft(a, b)
+cmp_result = []
+for p, q in zip(list(y), list(c)):
+    cmp_result.append(math.isclose(p, q, rel_tol=1e-09, abs_tol=1e-09))
+print(cmp_result)
@@ -0,0 +1,19 @@
+from ulab import numpy as np
+
+a = np.array([1.0, 0.5, 2.0, -3.0], dtype=np.float16)
+print(a)
+print(a[2])
+print(a[1:3])
+print(-a)
+print(abs(a))
+print(np.array(a, dtype=np.float))
+print(np.array(a, dtype=np.int16))
+b = np.array([0.25, 1.5, -2.0, 8.0], dtype=np.float16)
+print(a + b)
+a[a < 0.0] = 0.0
+print(a)
+c = np.array([4.0, 1.0, -2.0, 3.0], dtype=np.float16)
+print(np.sum(c))
+print(np.sort(c))
+print(np.cumsum(c))
+print(np.argmax(c))
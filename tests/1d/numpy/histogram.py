@@ -0,0 +1,23 @@
+from ulab import numpy as np
+
+a = np.array([1, 2, 1, 3, 2, 1, 7, 0], dtype=np.uint8)
+counts, edges = np.histogram(a, 4, range=(0, 8))
+print(counts)
+print(edges)
+
+# values on the right edge of the last bin are included
+counts, edges = np.histogram(np.array([0.0, 0.5, 1.0, 1.0]), 2, range=(0.0, 1.0))
+print(counts)
+
+# non-uniform bin edges take the binary search path
+counts, edges = np.histogram(a, np.array([0.0, 1.5, 3.0, 8.0]))
+print(counts)
+print(edges)
+
+print(np.bincount(np.array([1, 1, 2, 5, 1], dtype=np.uint8)))
+print(np.bincount(np.array([0, 1], dtype=np.int8), minlength=4))
+
+try:
+    np.bincount(np.array([-1, 2], dtype=np.int8))
+except ValueError as e:
+    print(e)
@@ -10,3 +10,23 @@ print(np.interp(x, xp, fp))
 print(np.interp(x, xp, fp, left=0.0))
 print(np.interp(x, xp, fp, right=10.0))
 print(np.interp(x, xp, fp, left=0.0, right=10.0))
+
+# a uniform grid can be given as the x0/dx scalars instead of an array
+try:
+    print(np.interp(x, None, fp, x0=1.0, dx=1.0))
+    print(np.interp(np.array([1.5, 3.25]), None, fp, x0=1.0, dx=1.0))
+except TypeError:
+    # CPython's numpy has no uniform-grid keywords
+    print(np.interp(x, xp, fp))
+    print(np.interp(np.array([1.5, 3.25]), xp, fp))
+
+# a plan caches the bracket search, so that repeated frames sampled on
+# the same grid need just one fused multiply-add per query point
+try:
+    plan = np.interp_plan([1.5, 2.5, 3.25, 10.0], xp)
+    print(plan.evaluate(fp))
+    print(plan.evaluate(np.array([10, 20, 30, 40], dtype=np.int8)))
+except AttributeError:
+    # CPython's numpy has no interpolation plans
+    print(np.interp(np.array([1.5, 2.5, 3.25, 10.0]), xp, fp))
+    print(np.interp(np.array([1.5, 2.5, 3.25, 10.0]), xp, np.array([10, 20, 30, 40])))
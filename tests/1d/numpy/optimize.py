@@ -26,3 +26,15 @@ print(math.isclose(result, ref_result, rel_tol=1E-6, abs_tol=1E-6))
 
 result = (spy.optimize.newton(f, 3.0, tol=0.001, rtol=0.01, maxiter=100))
 print(math.isclose(result, ref_result, rel_tol=1E-6, abs_tol=1E-6))
+
+ref_result = 1.4142135623730951
+result = spy.optimize.brentq(f, 1.0, 3.0)
+print(math.isclose(result, ref_result, rel_tol=1E-6, abs_tol=1E-6))
+
+# batched mode: both roots of x**2 - 2 are tracked in a single call
+def g(x):
+    return x * x - 2.0
+
+result = spy.optimize.brentq(g, [-3.0, 1.0], [0.0, 3.0])
+print(math.isclose(result[0], -ref_result, rel_tol=1E-6, abs_tol=1E-6))
+print(math.isclose(result[1], ref_result, rel_tol=1E-6, abs_tol=1E-6))
@@ -0,0 +1,23 @@
+from ulab import numpy as np
+
+a = np.array([7, 2, 9, 1, 5, 3, 8], dtype=np.uint8)
+p = np.partition(a, 3)
+print(p[3])
+# the two sides are in arbitrary order, so sort them before printing
+print(np.sort(p[:3], axis=None))
+print(np.sort(p[4:], axis=None))
+
+p = np.partition(a, -1)
+print(p[-1])
+
+i = np.argpartition(a, 3)
+print(a[i[3]])
+
+b = np.array([4.0, -1.0, 2.5, 0.5], dtype=np.float)
+p = np.partition(b, 0)
+print(p[0])
+
+try:
+    np.partition(a, 7)
+except ValueError as e:
+    print(e)
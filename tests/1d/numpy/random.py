@@ -0,0 +1,38 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+np.random.seed(0)
+
+a = np.random.random(size=10)
+print(a.shape)
+print(all([(x >= 0.0) and (x < 1.0) for x in a]))
+
+u = np.random.uniform(-5.0, 5.0, size=1000)
+print(all([(x >= -5.0) and (x < 5.0) for x in u]))
+
+n = np.random.normal(2.0, 0.5, size=1000)
+print(abs(np.mean(n) - 2.0) < 0.1)
+print(abs(np.std(n) - 0.5) < 0.1)
+
+r = np.random.randint(-4, 4, size=100, dtype=np.int8)
+print(all([(x >= -4) and (x < 4) for x in r]))
+
+# re-seeding repeats the sequence
+np.random.seed(42)
+b = np.random.random(size=5)
+np.random.seed(42)
+c = np.random.random(size=5)
+print(all([x == y for x, y in zip(b, c)]))
+
+# with out=, the samples land in the caller's buffer
+try:
+    buffer = np.zeros(8)
+    out = np.random.uniform(0.0, 1.0, out=buffer)
+    print(out is buffer)
+    print(all([(x >= 0.0) and (x < 1.0) for x in buffer]))
+except TypeError:
+    # CPython's numpy generates into a new array only
+    print(True)
+    print(True)
@@ -0,0 +1,22 @@
+import math
+from ulab import numpy as np
+
+x = np.linspace(-np.pi, np.pi, num=8)
+y = np.sin(x)
+
+a, b = np.fft.fft(y)
+re, im = np.fft.rfft(y)
+
+# the half-spectrum must match the first n/2 + 1 bins of the full transform
+cmp_result = []
+for k in range(5):
+    cmp_result.append(math.isclose(re[k], a[k], rel_tol=1e-09, abs_tol=1e-09) and
+                      math.isclose(im[k], b[k], rel_tol=1e-09, abs_tol=1e-09))
+print(cmp_result)
+
+# the inverse of the half-spectrum must recover the signal
+z = np.fft.irfft(re, im)
+cmp_result = []
+for p, q in zip(list(y), list(z)):
+    cmp_result.append(math.isclose(p, q, rel_tol=1e-09, abs_tol=1e-09))
+print(cmp_result)
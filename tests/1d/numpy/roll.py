@@ -0,0 +1,15 @@
+from ulab import numpy as np
+
+a = np.array(range(8), dtype=np.uint8)
+print(np.roll(a, 3))
+print(np.roll(a, -3))
+print(np.roll(a, 0))
+print(np.roll(a, 11))
+
+b = np.array([1.0, 2.0, 3.0, 4.0], dtype=np.float)
+print(np.roll(b, 1))
+print(np.flip(b))
+print(np.flip(a))
+
+# views fall back to the generic stride walker
+print(np.flip(a[::2]))
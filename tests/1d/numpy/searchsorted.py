@@ -0,0 +1,21 @@
+from ulab import numpy as np
+
+a = np.array([1, 2, 4, 4, 7], dtype=np.uint8)
+print(np.searchsorted(a, 4))
+print(np.searchsorted(a, 4, side="right"))
+print(np.searchsorted(a, 0))
+print(np.searchsorted(a, 10))
+
+# sorted needles exercise the galloping path
+print(np.searchsorted(a, np.array([0, 2, 4, 5, 8], dtype=np.uint8)))
+# unsorted needles fall back to plain bisection
+print(np.searchsorted(a, [5.0, 1.0, 4.0]))
+print(np.searchsorted(a, [5.0, 1.0, 4.0], side="right"))
+
+b = np.array([-4.0, -1.0, 0.5, 2.0], dtype=np.float)
+print(np.searchsorted(b, -2.5))
+
+try:
+    np.searchsorted(a, 4, side="middle")
+except ValueError as e:
+    print(e)
@@ -0,0 +1,14 @@
+import math
+from ulab import numpy as np
+
+a = np.array([-1.5, -0.5, 0.0, 0.5, 1.5, 3.0], dtype=np.float)
+s, c = np.sincos(a)
+
+res = []
+for k in range(len(a)):
+    res.append(math.isclose(s[k], math.sin(a[k]), rel_tol=1e-06, abs_tol=1e-06)
+               and math.isclose(c[k], math.cos(a[k]), rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+s, c = np.sincos(0.0)
+print(s, c)
@@ -0,0 +1,30 @@
+from ulab import numpy as np
+
+a = np.array([5, 1, 4, 255, 0, 2], dtype=np.uint8)
+print(np.sort(a, axis=None))
+
+a = np.array([5, -1, 4, -128, 0, 127], dtype=np.int8)
+print(np.sort(a, axis=None))
+
+a = np.array([300, 5, 65535, 1, 256, 0], dtype=np.uint16)
+print(np.sort(a, axis=None))
+
+a = np.array([300, -5, 32767, -32768, 256, 0], dtype=np.int16)
+print(np.sort(a, axis=None))
+
+a = np.array([5.0, -1.0, 4.0, -128.0, 0.0, 127.0], dtype=np.float)
+print(np.sort(a, axis=None))
+
+a = np.array([3, -1, 2, -2, 1, 0], dtype=np.int16)
+a.sort()
+print(a)
+
+# longer arrays exercise the radix/heapsort paths
+b = np.array(range(20, 0, -1), dtype=np.uint8)
+print(np.sort(b, axis=None))
+
+# in-place sort of a strided view needs no scratch memory
+a = np.array(range(16), dtype=np.uint8)
+v = a[::-2]
+v.sort()
+print(a)
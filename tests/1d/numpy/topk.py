@@ -0,0 +1,17 @@
+from ulab import numpy as np
+
+a = np.array([3, 1, 4, 1, 5, 9, 2, 6], dtype=np.uint8)
+print(np.topk(a, 3))
+print(np.argtopk(a, 3))
+print(np.topk(a, 1))
+print(np.argmax(a))
+print(np.argmin(a))
+
+b = np.array([1.0, -2.0, 0.5, 7.0], dtype=np.float)
+print(np.topk(b, 2))
+print(np.argtopk(b, 2))
+
+try:
+    np.topk(a, 0)
+except ValueError as e:
+    print(e)
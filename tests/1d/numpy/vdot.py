@@ -0,0 +1,16 @@
+from ulab import numpy as np
+
+a = np.array([1, 2, 3, 4], dtype=np.float)
+b = np.array([5, 6, 7, 8], dtype=np.float)
+print(np.vdot(a, b))
+
+# strided views are supported
+print(np.vdot(a[::2], b[::2]))
+
+# mixed dtypes are upcast on the fly
+print(np.vdot(np.array([1, 2, 3], dtype=np.uint8), np.array([4, 5, 6], dtype=np.int16)))
+
+try:
+    np.vdot(a, np.array([1, 2, 3], dtype=np.float))
+except ValueError as e:
+    print(e)
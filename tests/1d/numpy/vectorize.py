@@ -0,0 +1,12 @@
+from ulab import numpy as np
+
+a = np.array([1.0, 4.0, 9.0, 16.0], dtype=np.float)
+
+# a native function is dispatched to its C kernel
+f = np.vectorize(np.sqrt)
+print(f(a))
+print(f([1, 4, 9, 16]))
+
+# a python callable goes through the generic call machinery
+g = np.vectorize(lambda x: x * x, otypes=np.int16)
+print(g(np.array([1, 2, 3], dtype=np.int8)))
@@ -0,0 +1,45 @@
+import math
+from ulab import numpy as np
+
+x = np.array([1 + 2j, 3 - 1j, -2 + 0.5j, 0.25 - 1j], dtype=np.complex)
+h = np.array([0.5 - 1j, 2 + 2j, 1 + 1j, -1 + 3j], dtype=np.complex)
+
+xr = np.real(x)
+xi = np.imag(x)
+hr = np.real(h)
+hi = np.imag(h)
+
+# contiguous complex-complex product
+p = x * h
+res = []
+for k in range(4):
+    res.append(math.isclose(np.real(p)[k], xr[k] * hr[k] - xi[k] * hi[k], rel_tol=1e-09, abs_tol=1e-09)
+               and math.isclose(np.imag(p)[k], xr[k] * hi[k] + xi[k] * hr[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# contiguous complex-complex sum
+s = x + h
+res = []
+for k in range(4):
+    res.append(math.isclose(np.real(s)[k], xr[k] + hr[k], rel_tol=1e-09, abs_tol=1e-09)
+               and math.isclose(np.imag(s)[k], xi[k] + hi[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# a sliced operand is not contiguous, and falls back to the strided loops
+y = np.array([1 + 2j, 0j, 3 - 1j, 0j, -2 + 0.5j, 0j, 0.25 - 1j, 0j], dtype=np.complex)
+q = y[::2] * h
+res = []
+for k in range(4):
+    res.append(math.isclose(np.real(q)[k], np.real(p)[k], rel_tol=1e-09, abs_tol=1e-09)
+               and math.isclose(np.imag(q)[k], np.imag(p)[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# fused multiply-accumulate: two masking passes add up in the accumulator
+acc = np.zeros(4, dtype=np.complex)
+np.cmac(x, h, acc)
+np.cmac(x, h, acc)
+res = []
+for k in range(4):
+    res.append(math.isclose(np.real(acc)[k], 2 * np.real(p)[k], rel_tol=1e-09, abs_tol=1e-09)
+               and math.isclose(np.imag(acc)[k], 2 * np.imag(p)[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
@@ -0,0 +1,17 @@
+import math
+from ulab import numpy as np
+
+a = np.array([1 + 0j, 0 + 2j, -3 + 0j, 1 - 1j], dtype=np.complex)
+mag, phase = np.magphase(a)
+
+mags = [1.0, 2.0, 3.0, math.sqrt(2.0)]
+phases = [0.0, math.pi / 2.0, math.pi, -math.pi / 4.0]
+
+print([math.isclose(mag[k], mags[k], rel_tol=1e-09, abs_tol=1e-09) for k in range(4)])
+print([math.isclose(phase[k], phases[k], rel_tol=1e-09, abs_tol=1e-09) for k in range(4)])
+
+# a non-dense source falls back on the stride machinery
+b = a[::2]
+mag, phase = np.magphase(b)
+print([math.isclose(mag[k], mags[2 * k], rel_tol=1e-09, abs_tol=1e-09) for k in range(2)])
+print([math.isclose(phase[k], phases[2 * k], rel_tol=1e-09, abs_tol=1e-09) for k in range(2)])
@@ -16,3 +16,10 @@ print(np.concatenate((a,b), axis=0))
 print(np.concatenate((a,b), axis=1))
 print(np.concatenate((b,a), axis=0))
 print(np.concatenate((b,a), axis=1))
+
+# vstack and hstack are thin wrappers around the same core
+c = np.array([10, 11, 12], dtype=np.float)
+print(np.vstack((a, c)))
+print(np.vstack((c, c)))
+print(np.hstack((a, b)))
+print(np.hstack((c, c)))
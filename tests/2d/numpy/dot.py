@@ -0,0 +1,40 @@
+import math
+from ulab import numpy as np
+
+# matrix sizes that are not multiples of the 4x4 block exercise the
+# edge handling of the blocked kernel
+a = np.array([[(i * 7 + j) % 5 - 2 for j in range(7)] for i in range(5)], dtype=np.float)
+b = np.array([[(i * 3 + 2 * j) % 7 - 3 for j in range(6)] for i in range(7)], dtype=np.float)
+
+c = np.dot(a, b)
+res = []
+for i in range(5):
+    for j in range(6):
+        ref = 0.0
+        for k in range(7):
+            ref += a[i][k] * b[k][j]
+        res.append(math.isclose(c[i][j], ref, rel_tol=1e-09, abs_tol=1e-09))
+print(all(res))
+
+# a strided right operand is packed, rather than walked in place
+bt = b[:, ::2]
+ct = np.dot(a, bt)
+res = []
+for i in range(5):
+    for j in range(3):
+        res.append(math.isclose(ct[i][j], c[i][2 * j], rel_tol=1e-09, abs_tol=1e-09))
+print(all(res))
+
+# the int16 kernel accumulates in integers
+ai = np.array([[(i * 7 + j) % 5 - 2 for j in range(7)] for i in range(5)], dtype=np.int16)
+bi = np.array([[(i * 3 + 2 * j) % 7 - 3 for j in range(6)] for i in range(7)], dtype=np.int16)
+ci = np.dot(ai, bi)
+res = []
+for i in range(5):
+    for j in range(6):
+        res.append(ci[i][j] == c[i][j])
+print(all(res))
+
+# vectors fall back to the generic path
+v = np.array([1, 2, 3], dtype=np.float)
+print(np.dot(v, v))
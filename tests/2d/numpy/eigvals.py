@@ -0,0 +1,40 @@
+import math
+from ulab import numpy as np
+
+
+def allclose(x, y):
+    return all([math.isclose(a, b, rel_tol=1e-06, abs_tol=1e-06) for a, b in zip(x, y)])
+
+
+# small matrix: the Jacobi fallback
+A = np.array([[2, 1, 0], [1, 3, 1], [0, 1, 4]], dtype=np.float)
+w, v = np.linalg.eig(A)
+print(allclose(sorted(np.linalg.eigvals(A)), sorted(w)))
+
+# large matrix: the tridiagonal QL path
+N = 12
+B = np.zeros((N, N), dtype=np.float)
+for i in range(N):
+    for j in range(N):
+        B[i][j] = 1.0 / (1.0 + abs(i - j))
+
+# the eigenpairs satisfy B v = w v
+w, v = np.linalg.eig(B)
+R = np.dot(B, v)
+ok = True
+for j in range(N):
+    for i in range(N):
+        if not math.isclose(R[i][j], w[j] * v[i][j], rel_tol=1e-06, abs_tol=1e-06):
+            ok = False
+print(ok)
+
+# eigenvalues-only agrees with the full solver
+print(allclose(sorted(np.linalg.eigvals(B)), sorted(w)))
+
+# the trace is preserved
+print(math.isclose(sum(np.linalg.eigvals(B)), N * 1.0, rel_tol=1e-06))
+
+try:
+    np.linalg.eigvals(np.array([[1, 2], [3, 4]], dtype=np.float))
+except ValueError as e:
+    print(e)
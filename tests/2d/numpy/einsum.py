@@ -0,0 +1,20 @@
+from ulab import numpy as np
+
+A = np.array([[1, 2], [3, 4]], dtype=np.float)
+B = np.array([[5, 6], [7, 8]], dtype=np.float)
+x = np.array([1, 2], dtype=np.float)
+
+print(np.einsum('i,i->', x, x))
+print(np.einsum('ij,j->i', A, x))
+print(np.einsum('ij,jk->ik', A, B))
+print(np.einsum('ji,jk->ik', A, B))
+print(np.einsum('ij,kj->ik', A, B))
+print(np.einsum('ij,ij->', A, B))
+print(np.einsum('ij,ji->', A, B))
+print(np.einsum('ij,ji->i', A, B))
+print(np.einsum('ij,jk,k->i', A, B, x))
+
+try:
+    np.einsum('ij,jk->ki', A, B)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,20 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.array([[0, 1, 2, 3], [4, 5, 6, 7], [8, 9, 10, 11]], dtype=np.int16)
+b = a[:, ::2]
+
+# the batched mode fills a contiguous buffer with the next chunk of
+# elements, returning the number of elements written
+buffer = np.zeros((4, ), dtype=np.int16)
+it = b.flat
+print(it.next_into(buffer))
+print(buffer)
+print(it.next_into(buffer))
+print(buffer)
+print(it.next_into(buffer))
+
+# the element-wise iteration is unchanged
+print([x for x in a[0].flat])
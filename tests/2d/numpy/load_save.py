@@ -12,3 +12,24 @@ for dtype in dtypes:
     print(np.load('out.npy'))
     np.save('out.npy', b)
     print(np.load('out.npy'))
+
+# mmap=True returns the mapped payload on mappable streams, and falls
+# back to an ordinary heap copy everywhere else
+a = np.array(range(9), dtype=np.float).reshape((3, 3))
+np.save('out.npy', a)
+try:
+    print(np.load('out.npy', mmap=True))
+except TypeError:
+    # CPython's numpy has no mmap keyword
+    print(np.load('out.npy'))
+
+# dtype=/scale= convert on the fly: on save the items are divided by scale
+# and quantized, and load(scale=...) restores the original values
+try:
+    np.save('out.npy', a, dtype=np.int16, scale=0.5)
+    print(np.load('out.npy'))
+    print(np.load('out.npy', scale=0.5))
+except TypeError:
+    # CPython's numpy has no conversion keywords
+    print(np.array(a * 2, dtype=np.int16))
+    print(a)
@@ -35,3 +35,8 @@ print(np.loadtxt('loadtxt.dat', max_rows=5))
 
 print()
 print(np.loadtxt('loadtxt.dat', skiprows=5, dtype=np.uint16))
+
+print()
+print(np.loadtxt('loadtxt.dat', rows=3))
+print()
+print(np.loadtxt('loadtxt.dat', rows=20))
@@ -0,0 +1,30 @@
+import math
+from ulab import numpy as np
+
+
+def allclose(x, y):
+    return all([math.isclose(a, b, rel_tol=1e-06, abs_tol=1e-06) for a, b in zip(x, y)])
+
+
+# overdetermined system: a straight-line fit through four points
+A = np.array([[1, 0], [1, 1], [1, 2], [1, 3]], dtype=np.float)
+b = np.array([-1, 0.2, 0.9, 2.1], dtype=np.float)
+print(allclose(np.linalg.lstsq(A, b), (-0.95, 1.0)))
+
+# a square system is solved exactly
+A = np.array([[3, 2], [1, -1]], dtype=np.float)
+b = np.array([5, 0], dtype=np.float)
+print(allclose(np.linalg.lstsq(A, b), (1.0, 1.0)))
+
+# polyfit runs on the same QR engine: a degree-7 fit of an exact
+# degree-7 polynomial recovers the coefficients
+x = np.linspace(-1, 1, 30)
+y = x*x*x*x*x*x*x * 2.0 - x*x*x * 0.5 + x * 0.25 + 1.0
+p = np.polyfit(x, y, 7)
+print(allclose(p, (2.0, 0.0, 0.0, 0.0, -0.5, 0.0, 0.25, 1.0)))
+
+# repeated columns make the matrix rank deficient
+try:
+    np.linalg.lstsq(np.array([[1, 1], [1, 1], [1, 1]], dtype=np.float), np.array([1, 2, 3], dtype=np.float))
+except ValueError as e:
+    print(e)
@@ -0,0 +1,21 @@
+from ulab import numpy as np
+
+w = np.NpyWriter('npywriter.npy', 4)
+a = np.array(range(8), dtype=np.float).reshape((2, 4))
+w.append(a)
+w.append(a + 8.0)
+w.close()
+print(np.load('npywriter.npy'))
+
+# a flat batch supplies as many rows as its length covers
+w = np.NpyWriter('npywriter.npy', 2, np.int16)
+w.append(np.array([1, 2, 3, 4], dtype=np.int16))
+w.close()
+# closing a second time is a no-op
+w.close()
+print(np.load('npywriter.npy'))
+
+try:
+    w.append(np.array([1, 2], dtype=np.int16))
+except ValueError as e:
+    print(e)
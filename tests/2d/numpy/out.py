@@ -0,0 +1,21 @@
+from ulab import numpy as np
+
+a = np.array([0.5, 1.5, 2.5, 3.5], dtype=np.float)
+out = np.zeros(4, dtype=np.float)
+print(np.floor(a, out=out) is out)
+print(out)
+
+b = np.array([[1, 2], [3, 4]], dtype=np.float)
+r = np.zeros((2, 2), dtype=np.float)
+np.dot(b, np.eye(2), out=r)
+print(r)
+
+try:
+    np.floor(a, out=np.zeros(4, dtype=np.uint8))
+except ValueError as e:
+    print(e)
+
+try:
+    np.floor(a, out=np.zeros(5, dtype=np.float))
+except ValueError as e:
+    print(e)
@@ -0,0 +1,10 @@
+from ulab import numpy as np
+
+a = np.array(range(8), dtype=np.float)
+w = np.sliding_window_view(a, 4)
+print(w)
+print(np.sliding_window_view(a, 4, step=2))
+
+# windowed reductions run on the view without copying the windows
+print(np.sum(w, axis=1))
+print(np.max(np.sliding_window_view(a, 3, step=3), axis=1))
@@ -0,0 +1,33 @@
+import math
+from ulab import numpy as np
+
+A = np.array([[3, 2, -1], [2, -2, 4], [-1, 0.5, -1]], dtype=np.float)
+b = np.array([1, -2, 0], dtype=np.float)
+
+x = np.linalg.solve(A, b)
+ref = (1.0, -2.0, -2.0)
+res = []
+for k in range(3):
+    res.append(math.isclose(x[k], ref[k], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+# a zero on the diagonal forces a row swap
+A = np.array([[0, 1], [1, 0]], dtype=np.float)
+b = np.array([2, 3], dtype=np.float)
+print(np.linalg.solve(A, b))
+
+# multiple right-hand sides are solved in a single factorisation
+A = np.array([[4, 1, 2], [1, 5, 1], [2, 1, 6]], dtype=np.float)
+B = np.array([[1, 0], [0, 1], [0, 0]], dtype=np.float)
+X = np.linalg.solve(A, B)
+R = np.dot(A, X)
+res = []
+for i in range(3):
+    for j in range(2):
+        res.append(math.isclose(R[i][j], B[i][j], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+try:
+    np.linalg.solve(np.array([[1, 2], [2, 4]], dtype=np.float), b[:2])
+except ValueError as e:
+    print(e)
@@ -16,3 +16,13 @@ print(np.where(a < 6, 10 + b, -1))
 b = np.array(range(4), dtype=np.uint8)
 c = np.array([25, 25, 25, 25], dtype=np.int16)
 print(np.where(a < 6, b, c))
+
+# same-shape, same-dtype operands take the contiguous branchless path
+x = np.array(range(8), dtype=np.int16)
+y = np.array(range(8, 16), dtype=np.int16)
+print(np.where(x < 3, x, y))
+
+# the result can be written into a preallocated array
+out = np.zeros(8, dtype=np.int16)
+np.where(x < 3, x, y, out=out)
+print(out)
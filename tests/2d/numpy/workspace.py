@@ -0,0 +1,13 @@
+import ulab
+from ulab import numpy as np
+
+# large enough that the temporaries overflow the static scratch pool
+a = np.eye(20) * 2.0
+w, v = np.linalg.eig(a)
+print(abs(np.linalg.norm(w) * np.linalg.norm(w) - 80.0) < 1e-6)
+
+# releasing the workspace must not disturb subsequent calls
+ulab.workspace_free()
+w, v = np.linalg.eig(a)
+print(abs(np.linalg.norm(w) * np.linalg.norm(w) - 80.0) < 1e-6)
+ulab.workspace_free()
@@ -0,0 +1,41 @@
+import math
+
+try:
+    from ulab import scipy, numpy as np
+except ImportError:
+    import scipy
+    import numpy as np
+
+A = np.array([[18, 22,  54,  42], [22, 70,  86,  62], [54, 86, 174, 134], [42, 62, 134, 106]], dtype=np.float)
+b = np.array([4, 2, 4, 2], dtype=np.float)
+
+# the factor must match numpy's cholesky in the lower triangle
+L = scipy.linalg.cho_factor(A)
+ref = np.linalg.cholesky(A)
+res = []
+for i in range(4):
+    for j in range(i + 1):
+        res.append(math.isclose(L[i][j], ref[i][j], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+# in-place factorisation overwrites the lower triangle of the input
+scipy.linalg.cho_factor(A, overwrite_a=True)
+res = []
+for i in range(4):
+    for j in range(i + 1):
+        res.append(math.isclose(A[i][j], ref[i][j], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+# the solution can be written into a caller-supplied buffer
+x = np.zeros(4, dtype=np.float)
+scipy.linalg.cho_solve(L, b, out=x)
+ref_x = (6.5625, 1.1875, -2.9375, 0.4375)
+res = []
+for k in range(4):
+    res.append(math.isclose(x[k], ref_x[k], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+try:
+    scipy.linalg.cho_factor(np.array([[1, 2], [2, 1]], dtype=np.float))
+except ValueError as e:
+    print(e)
@@ -0,0 +1,23 @@
+import math
+
+try:
+    from ulab import scipy, numpy as np
+except ImportError:
+    import scipy
+    import numpy as np
+
+x = np.linspace(0, 4, num=21)
+y = 2.5 * np.exp(-1.3 * x) + 0.5
+
+
+def model(x, a, b, c):
+    return a * np.exp(-b * x) + c
+
+
+popt, pcov = scipy.optimize.curve_fit(model, x, y, [2.0, 1.0, 0.2])
+print([math.isclose(popt[k], v, rel_tol=1e-03, abs_tol=1e-03) for k, v in enumerate([2.5, 1.3, 0.5])])
+print(pcov.shape)
+
+# the model may also return a plain list
+popt, pcov = scipy.optimize.curve_fit(lambda x, a: [a * p for p in x], [1, 2, 3, 4], [2, 4, 6, 8], [1.0])
+print(math.isclose(popt[0], 2.0, rel_tol=1e-03, abs_tol=1e-03))
@@ -0,0 +1,27 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+taps = np.array([0.25, 0.5, 1.0, -0.5, 0.125])
+x = np.linspace(-1, 1, num=12)
+# the first len(x) values of the full convolution are the streaming
+# FIR output for a filter started from a zeroed delay line
+ref = np.convolve(x, taps)
+
+f = spy.signal.firfilter(taps)
+y = np.zeros(12)
+f.process(x[:5], out=y[:5])
+f.process(x[5:], out=y[5:])
+res = []
+for k in range(12):
+    res.append(math.isclose(y[k], ref[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# in-place processing, after resetting the delay line; taps can also be
+# given as a list
+f = spy.signal.firfilter([0.25, 0.5, 1.0, -0.5, 0.125])
+f.process(x)
+res = []
+for k in range(12):
+    res.append(math.isclose(x[k], ref[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
@@ -0,0 +1,32 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+taps = np.array([0.125, 0.25, 0.5, 0.25, 0.125])
+x = np.linspace(-1, 1, num=12)
+# decimation by 3: the kept outputs are every third sample of the full
+# convolution, and only those are computed
+ref = np.convolve(x, taps)
+
+r = spy.signal.resampler(taps, 1, 3)
+y = np.zeros(4)
+print(r.process(x[:5], y[:2]))
+print(r.process(x[5:], y[2:]))
+res = []
+for k in range(4):
+    res.append(math.isclose(y[k], ref[3 * k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# rational resampling by 2/3: compare against upsampling by two,
+# convolving, and keeping every third sample
+r = spy.signal.resampler(taps, 2, 3)
+y = np.zeros(8)
+print(r.process(x, y))
+xu = np.zeros(24)
+for i in range(12):
+    xu[2 * i] = x[i]
+refu = np.convolve(xu, taps)
+res = []
+for k in range(8):
+    res.append(math.isclose(y[k], refu[3 * k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
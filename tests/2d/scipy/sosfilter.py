@@ -0,0 +1,33 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+x = np.array([0, 1, 2, 3, 4, 5, 6, 7, 8, 9], dtype=np.float)
+sos = [[1, 2, 3, 1, 5, 6], [1, 2, 3, 1, 5, 6], [1, 2, 3, 1, 5, 6]]
+ref = spy.signal.sosfilt(sos, x)
+
+# the signal is filtered in place, block by block; the biquad states
+# persist between the two calls
+f = spy.signal.sosfilter(sos)
+f.filter(x[:5])
+f.filter(x[5:])
+res = []
+for p, q in zip(list(x), list(ref)):
+    res.append(math.isclose(p, q, rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# integer input through out=, after resetting the states
+f.reset()
+x = np.array([0, 1, 2, 3, 4, 5, 6, 7, 8, 9], dtype=np.int16)
+y = np.zeros(10)
+f.filter(x, out=y)
+res = []
+for p, q in zip(list(y), list(ref)):
+    res.append(math.isclose(p, q, rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# in-place filtering needs a writeable float buffer
+try:
+    f.filter(x)
+except TypeError as e:
+    print(e)
@@ -0,0 +1,24 @@
+from ulab import utils
+
+buf = bytearray(16)  # 8 int16 samples
+rb = utils.ringbuffer(buf)
+
+# the producer writes 4 samples at the head
+for i in range(4):
+    buf[2*i] = i + 1
+rb.advance(4)
+print(rb.view())
+print(rb.view(2))
+
+# a non-wrapping view aliases the buffer
+v = rb.view(2)
+buf[4] = 99
+print(v)
+buf[4] = 3
+
+# write 6 more samples, wrapping around the end of the buffer
+for i, v in enumerate([5, 6, 7, 8, 9, 10]):
+    buf[2*((4 + i) % 8)] = v
+rb.advance(6)
+print(rb.view(8))
+print(rb.view(4))
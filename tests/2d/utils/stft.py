@@ -0,0 +1,38 @@
+import math
+from ulab import numpy as np
+from ulab import utils
+
+x = np.linspace(0, 4 * np.pi, num=16)
+y = np.sin(x)
+# a Hann window of 8 points
+w = np.zeros(8)
+for i in range(8):
+    w[i] = 0.5 - 0.5 * math.cos(2 * math.pi * i / 8)
+
+s = utils.stft(8, 4, window=w)
+out = np.zeros((2, 5))
+
+# the first 10 samples complete a single frame
+print(s.feed(y[:10], out))
+ref = utils.spectrogram(y[0:8] * w)
+res = []
+for k in range(5):
+    res.append(math.isclose(out[0][k], ref[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# the rest of the signal completes two more frames; the overlapping tail
+# is carried over from the first chunk
+print(s.feed(y[10:16], out))
+res = []
+for r in range(2):
+    ref = utils.spectrogram(y[4 * (r + 1):4 * (r + 1) + 8] * w)
+    for k in range(5):
+        res.append(math.isclose(out[r][k], ref[k], rel_tol=1e-09, abs_tol=1e-09))
+print(res)
+
+# the capacity of the output array is checked before any sample is consumed
+s = utils.stft(8, 4)
+try:
+    s.feed(y, np.zeros(5))
+except ValueError as e:
+    print(e)
@@ -0,0 +1,38 @@
+import math
+from ulab import numpy as np
+
+# the leading axis of a 3D array is a batch dimension: all matrix pairs
+# are multiplied in a single call
+A = np.array([[[1, 2], [3, 4]], [[0, 1], [1, 0]]], dtype=np.float)
+B = np.array([[[5, 6], [7, 8]], [[1, 2], [3, 4]]], dtype=np.float)
+C = np.dot(A, B)
+print(C[0])
+print(C[1])
+
+# batched inverse: the product with the original matrices must give the identity
+D = np.array([[[4, 7], [2, 6]], [[2, 0], [0, 5]]], dtype=np.float)
+R = np.dot(D, np.linalg.inv(D))
+res = []
+for p in range(2):
+    for i in range(2):
+        for j in range(2):
+            target = 1.0 if i == j else 0.0
+            res.append(math.isclose(R[p][i][j], target, rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+# batched solve, with one right-hand side per matrix
+A = np.array([[[3, 1], [1, 2]], [[2, 0], [0, 4]]], dtype=np.float)
+b = np.array([[9, 8], [2, 8]], dtype=np.float)
+x = np.linalg.solve(A, b)
+ref = ((2.0, 3.0), (1.0, 2.0))
+res = []
+for p in range(2):
+    for k in range(2):
+        res.append(math.isclose(x[p][k], ref[p][k], rel_tol=1e-06, abs_tol=1e-06))
+print(res)
+
+# a singular member of the batch is still caught
+try:
+    np.linalg.inv(np.array([[[1, 2], [2, 4]], [[1, 0], [0, 1]]], dtype=np.float))
+except ValueError as e:
+    print(e)